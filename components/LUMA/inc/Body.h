@@ -77,14 +77,12 @@ protected:
 
 	virtual void addMarker(double x, double y, double z, int markerID);		// Add a marker (can be overrriden)
 	MarkerData* getMarkerData(double x, double y, double z);				// Retireve nearest marker data
-	void passToVoxelFilter(double x, double y, double z, int markerID,
-		int& curr_mark, std::vector<int>& counter);							// Voxelising marker adder
+	void passToVoxelFilter(double x, double y, double z, int markerID, int& curr_mark, 
+		std::vector<int>& counter, std::unordered_map<int, int>& voxelMarkers);	// Voxelising marker adder
 	void deleteRecvLayerMarkers();											// Delete any markers which are on receiver layer
 	void deleteOffRankMarkers();											// Delete any markers which don't exist on this rank
 
 private:
-	bool isInVoxel(double x, double y, double z, int curr_mark);			// Check a point is inside an existing marker voxel
-	bool isVoxelMarkerVoxel(double x, double y, double z);					// Check whether nearest voxel is a marker voxel
 	int assignOwningRank(int id);											// Assign owning rank based on which ranks own which grids
 
 
@@ -629,31 +627,23 @@ MarkerData* Body<MarkerType>::getMarkerData(double x, double y, double z) {
 ///	\param	markerID	requested rank independent ID of marker within body
 /// \param	curr_mark	is a reference to the index of last marker added
 ///	\param	counter		is a reference to the total number of markers in the body
+///	\param	voxelMarkers	is a reference to the map from flattened voxel index to marker index
 template <typename MarkerType>
-void Body<MarkerType>::passToVoxelFilter(double x, double y, double z, int markerID, int& curr_mark, std::vector<int>& counter) {
-
-	// If point in current voxel
-	if (isInVoxel(x, y, z, curr_mark)) {
-
-		// Increment point counter
-		counter[curr_mark]++;
-
-		// Update position of marker in current voxel
-		markers[curr_mark].position[0] =
-			((markers[curr_mark].position[0] * (counter[curr_mark] - 1)) + x) / counter[curr_mark];
-		markers[curr_mark].position[1] =
-			((markers[curr_mark].position[1] * (counter[curr_mark] - 1)) + y) / counter[curr_mark];
-		markers[curr_mark].position[2] =
-			((markers[curr_mark].position[2] * (counter[curr_mark] - 1)) + z) / counter[curr_mark];
+void Body<MarkerType>::passToVoxelFilter(double x, double y, double z, int markerID, int& curr_mark, 
+	std::vector<int>& counter, std::unordered_map<int, int>& voxelMarkers) {
 
+	// Get voxel containing the point
+	std::vector<int> vox;
+	eLocationOnRank loc = eNone;
+	bool onRank = GridUtils::isOnThisRank(x, y, z, &loc, _Owner, &vox);
+	int voxID = onRank ? vox[2] + vox[1] * _Owner->K_lim + vox[0] * _Owner->K_lim * _Owner->M_lim : -1;
 
-		// If point is in an existing voxel
-	}
-	else if (isVoxelMarkerVoxel(x, y, z)) {
+	// If point is in an existing marker voxel
+	auto it = voxelMarkers.find(voxID);
+	if (onRank && it != voxelMarkers.end()) {
 
 		// Recover voxel number
-		MarkerData* m_data = getMarkerData(x, y, z);
-		curr_mark = m_data->ID;
+		curr_mark = it->second;
 
 		// Increment point counter
 		counter[curr_mark]++;
@@ -666,8 +656,6 @@ void Body<MarkerType>::passToVoxelFilter(double x, double y, double z, int marke
 		markers[curr_mark].position[2] =
 			((markers[curr_mark].position[2] * (counter[curr_mark] - 1)) + z) / counter[curr_mark];
 
-		delete m_data;
-			
 	}
 	// Must be in a new marker voxel
 	else {
@@ -678,79 +666,11 @@ void Body<MarkerType>::passToVoxelFilter(double x, double y, double z, int marke
 
 		// Create new marker as this is a new marker voxel
 		addMarker(x, y, z, markerID);
+		if (onRank) voxelMarkers[voxID] = curr_mark;
 	}
 
 };
 
-/*********************************************/
-/// \brief	Determines whether a point is inside another marker's support voxel
-///
-///			Typically called indirectly by the voxel-grid filter method and not directly.
-///
-/// \param	x				X-position of point
-/// \param	y				Y-position of point
-/// \param	z				Z-position of point
-/// \param	curr_mark		ID of the marker
-/// \returns				true or false
-template <typename MarkerType>
-bool Body<MarkerType>::isInVoxel(double x, double y, double z, int curr_mark) {
-
-	try {
-
-		// Try to retrieve the position of the voxel centre belonging to <curr_mark>
-		// Assume that first support point is the closest to the marker position
-		double vx = _Owner->XPos[markers[curr_mark].supp_i[0]];
-		double vy = _Owner->YPos[markers[curr_mark].supp_j[0]];
-		double vz = _Owner->ZPos[markers[curr_mark].supp_k[0]];
-
-		// Test within
-		if ((x >= vx - (_Owner->dh / 2.0) && x < vx + (_Owner->dh / 2.0)) &&
-			(y >= vy - (_Owner->dh / 2.0) && y < vy + (_Owner->dh / 2.0)) &&
-			(z >= vz - (_Owner->dh / 2.0) && z < vz + (_Owner->dh / 2.0))
-			) return true;
-
-		// Catch all
-	}
-	catch (...) {
-
-		// If failed, marker probably doesn't exist so return false
-		return false;
-
-	}
-
-	return false;
-
-};
-
-/*********************************************/
-/// \brief	Determines whether a point is inside an existing marker's support voxel
-///
-///			Typically called indirectly by the voxel-grid filter method and not directly.
-///
-/// \param	x				X-position of point
-/// \param	y				Y-position of point
-/// \param	z				Z-position of point
-/// \returns				true or false
-template <typename MarkerType>
-bool Body<MarkerType>::isVoxelMarkerVoxel(double x, double y, double z) {
-
-	// Try get the MarkerData store
-	MarkerData* m_data = getMarkerData(x, y, z);
-
-	// True if the data store is not empty
-	if (m_data->isValid()) {
-
-		delete m_data;	// Deallocate the store before leaving scope
-		return true;
-
-	}
-
-	delete m_data;
-	return false;
-
-};
-
-
 /*********************************************/
 /// \brief	Method to build a body from point cloud data
 ///
@@ -759,27 +679,20 @@ template <typename MarkerType>
 void Body<MarkerType>::buildFromCloud(PCpts *_PCpts)
 {
 
-	// Declare local variables
-	std::vector<int> locals;
-
 	// Voxel grid filter //
 
 	*GridUtils::logfile << "ObjectManager: Applying voxel grid filter..." << std::endl;
 
-	// Place first marker
-	if (!_PCpts->x.empty())
-		addMarker(_PCpts->x[0], _PCpts->y[0], _PCpts->z[0], _PCpts->id[0]);
-
-	// Increment counters
+	// Counters and lookup of marker voxels
 	int curr_marker = 0;
 	std::vector<int> counter;
-	counter.push_back(1);
+	std::unordered_map<int, int> voxelMarkers;
 
 	// Loop over array of points
-	for (size_t a = 1; a < _PCpts->x.size(); a++)
+	for (size_t a = 0; a < _PCpts->x.size(); a++)
 	{
 		// Pass to point builder
-		passToVoxelFilter(_PCpts->x[a], _PCpts->y[a], _PCpts->z[a], _PCpts->id[a], curr_marker, counter);
+		passToVoxelFilter(_PCpts->x[a], _PCpts->y[a], _PCpts->z[a], _PCpts->id[a], curr_marker, counter, voxelMarkers);
 	}
 
 	*GridUtils::logfile << "ObjectManager: Object represented by " << std::to_string(markers.size()) <<
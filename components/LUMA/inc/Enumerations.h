@@ -186,6 +186,14 @@ enum eHdf5SlabType {
 	ePosZ			///< 1D data	-- Single L_dim vector per dimension
 };
 
+/// \enum	eExtractType
+///	\brief	Type of in-situ extract defined in the extract configuration file.
+enum eExtractType {
+	ePlaneExtract,		///< Single plane of sites normal to a Cartesian direction
+	eBoxExtract,		///< Axis-aligned sub-volume
+	eDecimateExtract	///< Whole grid sampled at a stride
+};
+
 /// \enum  eMoveableType
 /// \brief Specifies the whether body is movable, flexible or rigid.
 enum eMoveableType {
@@ -194,6 +202,13 @@ enum eMoveableType {
 	eRigid	///< Immersed boundary body
 };
 
+///	\enum eHaloEngine
+///	\brief	Method used to exchange halo data between neighbouring ranks.
+enum eHaloEngine {
+	eHaloPointToPoint,			///< Individual send/receive per Cartesian direction
+	eHaloNeighbourCollective	///< Single neighbourhood collective on a distributed graph
+};
+
 ///	\enum eSDReturnType
 ///	\brief	Return types for smart decomposition methods.
 enum eSDReturnType {
@@ -0,0 +1,112 @@
+/*
+* --------------------------------------------------------------
+*
+* ------ Lattice Boltzmann @ The University of Manchester ------
+*
+* -------------------------- L-U-M-A ---------------------------
+*
+* Copyright 2019 The University of Manchester
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.*
+*/
+
+#ifndef EXTRACTMAN_H
+#define EXTRACTMAN_H
+
+#include "stdafx.h"
+#include "IVector.h"
+class GridObj;
+
+/// \brief	Extract Manager class.
+///
+///			Singleton which manages reduced in-situ output. Planes, sub-volumes
+///			and strided decimations of a grid are read from the extract
+///			configuration file at start-up. The sites belonging to each extract
+///			are located once and the data are then gathered and streamed to a
+///			separate HDF5 file per extract at the requested frequency.
+class ExtractManager
+{
+
+	/// \brief	Nested extract descriptor class.
+	///
+	///			Stores the definition of a single extract together with the
+	///			site mappings resolved on this rank during initialisation.
+	class Extract
+	{
+	public:
+
+		Extract();
+		~Extract();
+
+		// Definition
+		std::string name;				///< Name of the extract (used in the file name)
+		eExtractType type;				///< Type of extract
+		int level;						///< Level of the grid to sample
+		int region;						///< Region of the grid to sample
+		double limits[6];				///< Requested bounds (access using eCartMinMax)
+		int stride;						///< Sampling stride in lattice sites
+
+		// Resolved data
+		GridObj *grid;					///< Pointer to the sampled grid on this rank (nullptr if absent)
+		int first[3];					///< Global index of the first sampled site in each direction
+		int count[3];					///< Number of samples in each direction
+		double origin[3];				///< Position of the first sampled site
+		std::vector<int> localIds;		///< Flattened ijk indices of the sampled sites on this rank
+		std::vector<int> extractIds;	///< Flattened index of each local sample within the extract
+
+		// Gather data (only populated on the root rank)
+		std::vector<int> recvCounts;	///< Number of samples contributed by each rank
+		std::vector<int> recvDispls;	///< Displacement of each rank's contribution
+		std::vector<int> gatheredIds;	///< Extract indices in gathered order
+
+		// Output state
+		bool bFileCreated;				///< True once this run has created or reopened the output file
+
+		size_t size() const;
+	};
+
+	/************** Member Data **************/
+
+private:
+
+	std::vector<Extract> extracts;	///< Extracts defined for this simulation
+	std::vector<double> sendBuffer;	///< Packing buffer for local samples
+	std::vector<double> recvBuffer;	///< Gathered samples on the root rank
+	std::vector<double> fileBuffer;	///< Samples reordered into extract order on the root rank
+	bool bInitialised;				///< Flag indicating that site mappings have been resolved
+
+	static ExtractManager* me;		///< Pointer to self
+
+	/************** Member Methods **************/
+
+private:
+	ExtractManager();		///< Private constructor
+	~ExtractManager();		///< Private destructor
+
+public:
+	// Singleton design
+	static ExtractManager* getInstance();	// Get instance method
+	static void destroyInstance();			// Destroy instance method
+
+	void io_readInExtractConfig();			// Read in the extract configuration file
+	void initialise(GridObj *const Grids);	// Resolve the sites belonging to each extract
+	void io_writeExtracts(int tval);		// Gather and write all extracts
+	size_t getNumExtracts() const;			// Number of extracts defined
+
+private:
+	void _resolveExtract(Extract &ex, GridObj *const Grids);			// Locate the sites of a single extract
+	void _gatherField(Extract &ex, IVector<double> &field, int component, int stride);	// Pack, gather and reorder a field
+	void _writeExtract(Extract &ex, int tval);						// Write a single extract
+};
+
+#endif
@@ -83,6 +83,11 @@ class FEMBody {
 	double res;						///< Residual Newton-Raphson solver reached
 	double timeav_FEMIterations;	///< Number of iterations for Newton-Raphson solver (time-averaged)
 	double timeav_FEMResidual;		///< Residual Newton-Raphson solver reached (time-averaged)
+	int subIt;						///< FSI sub-iteration counter within the current time step
+	double aitkenOmega;				///< Current Aitken relaxation factor for FSI coupling
+	std::vector<double> aitkenRes;	///< Marker velocity residual from the previous FSI sub-iteration
+	int bandWidth;					///< Number of sub- and super-diagonals in the system matrices
+	bool refactorise;				///< Flag to force a new factorisation of the effective stiffness matrix
 
 	// Nodes and elements
 	std::vector<FEMNode> nodes;				///< Vector of FEM nodes
@@ -100,6 +105,9 @@ class FEMBody {
 	std::vector<double> Udot_n;					///< Vector velocities at start of current time step
 	std::vector<double> Udotdot;				///< Vector of accelerations
 	std::vector<double> Udotdot_n;				///< Vector of accelerations at start of current time step
+	std::vector<double> K_ref;					///< Effective stiffness (BCs removed) at last factorisation in band storage
+	std::vector<double> K_lu;					///< Banded LU factors of K_ref
+	std::vector<int> K_piv;						///< Pivot indices of the banded LU factors
 
 	// Vector of parent elements for each IBM node
 	std::vector<IBMParentElements> IBNodeParents;
@@ -110,10 +118,12 @@ class FEMBody {
 	// Main FEM solver methods
 	void dynamicFEM();											// Main outer routine for solving FEM
 	void newtonRaphsonIterator();								// Newton-Raphson routine for solve non-linear FEM
+	void solveBanded();											// Solve the Newton-Raphson system using banded LU
 	void setNewmark();											// First step in Newmar-Beta time integration
 	void finishNewmark();										// Newmark-Beta scheme for getting FEM velocities and accelerations
 	void updateFEMValues();										// Update the FEM node data using the new displacements
 	void updateIBMarkers();										// Update the IBM markers using new FEM node vales
+	double computeRelaxation(std::vector<double> &markerVelNew);	// Relaxation factor for FSI coupling
 
 	// Helper methods
 	double checkNRConvergence();								// Check convergence of the Newton-Raphson scheme
@@ -36,6 +36,7 @@ class GridManager
 	friend class MpiManager;
 	friend class GridUtils;
 	friend class GridObj;
+	friend class ExtractManager;
 
 	friend class PLEAdapter;
 
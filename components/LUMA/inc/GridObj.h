@@ -37,6 +37,7 @@ class GridObj
 	friend class MpiManager;
 	friend class ObjectManager;
 	friend class GridUtils;
+	friend class ExtractManager;
 
 public:
 
@@ -77,18 +78,18 @@ private :
 
 	// Vector nodal properties
 	// Flattened 4D arrays (i,j,k,vel)
-	IVector<double> f;				///< Distribution functions
+	IVector<lbm_pop_t> f;			///< Distribution functions
 	IVector<double> feq;			///< Equilibrium distribution functions
-	IVector<double> fNew;			///< Copy of distribution functions
+	IVector<lbm_pop_t> fNew;		///< Copy of distribution functions
+	IVector<int> popSlot;			///< Storage slot of each site in f and fNew (identity unless storage is compacted)
 	IVector<double> u;				///< Macropscopic velocity components
 	IVector<double> u_n;			///< Macropscopic velocity components at start of current time step (IBM)
 	IVector<double> force_xyz;		///< Macroscopic body force components
 	IVector<double> force_i;		///< Mesoscopic body force components
 	
 	//Vector nodal properties used in Temperature field
-	IVector<double> g;				///< Temperature distribution functions
-	IVector<double> geq;			///< Temperature distribution functions
-	IVector<double> gNew;			///< Copy of temperature distribution functions
+	IVector<lbm_pop_t> g;			///< Temperature distribution functions
+	IVector<lbm_pop_t> gNew;		///< Copy of temperature distribution functions
 
 	// Scalar nodal properties
 	// Flattened 3D arrays (i,j,k)
@@ -100,6 +101,7 @@ private :
 	IVector<double> rho_timeav;		///< Time-averaged density at each grid point (i,j,k)
 	IVector<double> ui_timeav;		///< Time-averaged velocity at each grid point (i,j,k,L_DIMS)
 	IVector<double> uiuj_timeav;	///< Time-averaged velocity products at each grid point (i,j,k,3*L_DIMS-3)
+	unsigned long timeav_samples;	///< Number of samples contributing to the time-averaged quantities
 	
 	//Temperature field parameters
 	IVector<double> t_timeav;		///< Time-averaged temperature at each grid poiny (i,j,k)
@@ -156,9 +158,33 @@ public :
 	void LBM_initBoundLab();					// Initialise labels for walls
 	void LBM_tinitBoundLab();					// Initialise labels for walls in temperature field
 	void LBM_initRefinedLab(GridObj &pGrid);							// Initialise labels for refined regions
+	void LBM_compactStorage();											// Drops distribution storage of inactive sites on this grid and its sub-grids
 	eType LBM_setBCPrecedence(eType currentBC, eType desiredBC);		// Determine BC based on any existing BC
 	eTType LBM_setTBCPrecedence(eTType currentBC, eTType desiredBC);	// Determine temperature BC based on any existing BC
 
+	// *************************************************************************
+	/// \brief	Offset of the first population of a site in f and fNew.
+	///
+	///			Goes through the slot table when sparse storage is enabled so 
+	///			that compacted grids are addressed transparently.
+	///
+	/// \param	id	flattened ijk index.
+	/// \return	index of population 0 of the site.
+	inline int popOffset(int id) const
+	{
+#ifdef L_SPARSE_STORAGE
+		return popSlot[id] * L_NUM_VELS;
+#else
+		return id * L_NUM_VELS;
+#endif
+	}
+
+	/// Offset of the first population of site (i,j,k) in f and fNew.
+	inline int popOffset(int i, int j, int k) const
+	{
+		return popOffset(k + j * K_lim + i * K_lim * M_lim);
+	}
+
 	// External coupling functions
 	// NOTE: I will have to think about doing an addVelociy, addDensity, addTemperature. If the coupling is through multiple grids I might
 	        // have to continuously call this function for one value at a time. The conditional that selects the variable to read might slow down 
@@ -167,7 +193,7 @@ public :
 	void coupling_extractData(std::string name, const std::vector<int> &cellIDs, const std::vector<int> cellIDs_diff, std::vector<double> &data);   // Writes the data in the LUMA variable "name" in the positions of "cellIDs" to the "data" vector
 
 	// LBM operations
-	DEPRECATED void LBM_kbcCollide(int i, int j, int k, IVector<double>& f_new);		// KBC collision operator
+	DEPRECATED void LBM_kbcCollide(int i, int j, int k, IVector<lbm_pop_t>& f_new);		// KBC collision operator
 	void LBM_macro(int i, int j, int k);
 	DEPRECATED void LBM_resetForces();								// Resets the force vectors on the grid
 
@@ -181,10 +207,14 @@ public :
 	void io_probeOutput();						// Output routine for point probes
 	void io_lite(double tval, std::string Tag);	// Generic writer to individual files with Tag
 	int io_hdf5(double tval);					// HDF5 writer returning integer to indicate success or failure
+	void io_memoryReport();						// Writes the storage held by each per-site field to the log
 
 private :
 
 	void _LBM_initGetInletProfileFromFile();		// Set inlet profile data from file
+	int _LBM_initRefinedClass(double pos, double edgeMin, double edgeMax, bool tlMin, bool tlMax, double pdh);	// Classify a parent position against a sub-grid axis
+	void _LBM_initEndPhase(const std::string &phase, std::string &phase_times,
+		std::chrono::steady_clock::time_point &t_phase);		// Append the time of an initialisation phase to the log string
 	void _LBM_initSetInletProfile();				// Set the inlet profile data used for velocity BCs
 	void _LBM_updateReynolds(double newReynolds);		// Updates the reynolds number at run time
 	void _io_fgaout(int timeStepL0);		// Writes out the macroscopic velocity components for the class as well as any subgrids 
@@ -207,6 +237,7 @@ private :
 	void _LBM_regularised_opt(int i, int j, int k, int id, eType type, int subcycle);
 	void _LBM_kbcCollide_opt(int id);
 	void _LBM_resetForces();
+	void _LBM_timeAverage_opt();
 	double _LBM_smag(int id, double omega);
 	void _LBM_updateInteriorLatticeSite(int i, int j, int k, int subcycle);
 	double _LBM_updateAndExtrapolate(int subcycle, IVector<double> &quantity,
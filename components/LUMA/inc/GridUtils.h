@@ -29,6 +29,8 @@
 // LAPACK interfaces
 extern "C" void dgetrf_(int* dim1, int* dim2, double* a, int* lda, int* ipiv, int* info);
 extern "C" void dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA, int *IPIV, double *B, int *LDB, int *INFO );
+extern "C" void dgbtrf_(int *M, int *N, int *KL, int *KU, double *AB, int *LDAB, int *IPIV, int *INFO);
+extern "C" void dgbtrs_(char *TRANS, int *N, int *KL, int *KU, int *NRHS, double *AB, int *LDAB, int *IPIV, double *B, int *LDB, int *INFO);
 
 /// \brief	Grid utility class.
 ///
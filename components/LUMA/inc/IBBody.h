@@ -83,6 +83,11 @@ protected:
 
 	FEMBody *fBody;						///< Pointer to FEM body object
 
+	// Flattened on-rank support data (rebuilt whenever the support changes)
+	std::vector<int> suppOffset;		///< Start of the support of each valid marker in the flattened arrays (size validMarkers + 1, empty until rebuilt)
+	std::vector<int> suppSiteId;		///< Flattened ijk index of each on-rank support site
+	std::vector<double> suppDelta;		///< Delta function value of each on-rank support site
+
 
 	/************** Member Methods **************/
 
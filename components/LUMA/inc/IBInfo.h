@@ -123,4 +123,30 @@ public:
 	int markerIdx;					///< Local (rank) index of marker for communicating
 	int supportID;					///< Support index within the marker
 };
+
+/// \brief Persistent point-to-point exchange for IBM communications
+///
+///			Holds contiguous rank-ordered send and receive buffers for one of
+///			the IBM exchange patterns along with persistent requests bound to
+///			them. Only rebuilt when the comm classes above are rebuilt.
+class IBCommPersistentClass {
+
+	/************** Friends **************/
+	friend class MpiManager;
+	friend class ObjectManager;
+
+public:
+
+	/************** Constructors **************/
+	IBCommPersistentClass();
+
+private:
+
+	/************** Member Data **************/
+	std::vector<double> sendBuffer;		///< Contiguous send buffer ordered by destination rank
+	std::vector<double> recvBuffer;		///< Contiguous receive buffer ordered by source rank
+	std::vector<int> sendDisps;			///< Offset into send buffer for each rank
+	std::vector<int> recvDisps;			///< Offset into receive buffer for each rank
+	std::vector<MPI_Request> requests;	///< Persistent receive requests followed by persistent send requests
+};
 #endif	// L_IBINFO_H
@@ -29,6 +29,7 @@
 class GridObj;
 class GridManager;
 class IBBody;
+class PCpts;
 
 
 // Define the loop expressions required to inspect the overlap regions of a grid for ease of coding
@@ -174,11 +175,11 @@ public :
 	
 
 	// Buffer data
-	std::vector< std::vector<double>> f_buffer_send;	///< Array of resizeable outgoing buffers used for data transfer
-	std::vector< std::vector<double>> f_buffer_recv;	///< Array of resizeable incoming buffers used for data transfer
+	std::vector< std::vector<lbm_pop_t>> f_buffer_send;	///< Array of resizeable outgoing buffers used for data transfer
+	std::vector< std::vector<lbm_pop_t>> f_buffer_recv;	///< Array of resizeable incoming buffers used for data transfer
 #ifdef L_TEMPERATURE
-	std::vector<std::vector<double>>  g_buffer_send;	///< Array of resizeable outgoing buffers used for passive scalar date transfer
-	std::vector< std::vector<double>> g_buffer_recv;	///< Array of resizeable incoming buffers used for passive scalar date transfer
+	std::vector<std::vector<lbm_pop_t>>  g_buffer_send;	///< Array of resizeable outgoing buffers used for passive scalar date transfer
+	std::vector< std::vector<lbm_pop_t>> g_buffer_recv;	///< Array of resizeable incoming buffers used for passive scalar date transfer
 #endif
 	MPI_Status recv_stat;					///< Status structure for Receive return information
 	MPI_Request send_requests[L_MPI_DIRS];	///< Array of request structures for handles to posted ISends
@@ -202,6 +203,32 @@ public :
 	std::vector<BufferSizeStruct> buffer_send_info;	///< Vectors of buffer_info structures holding sender layer size info.
 	std::vector<BufferSizeStruct> buffer_recv_info;	///< Vectors of buffer_info structures holding receiver layer size info.
 
+	/// \struct HaloNeighbourStruct
+	/// \brief	Structure storing the neighbourhood collective exchange for particular grid.
+	///
+	///			Edges are only created for directions with a non-zero buffer so
+	///			the graph communicator only spans ranks which hold the grid.
+	struct HaloNeighbourStruct
+	{
+		int level;						///< Grid level
+		int region;						///< Region number
+		MPI_Comm graph_comm;			///< Distributed graph communicator
+		MPI_Request request;			///< Persistent collective request (MPI-4 only)
+		std::vector<int> send_dirs;		///< MPI direction of each outgoing edge
+		std::vector<int> recv_dirs;		///< MPI direction of each incoming edge
+		std::vector<int> send_counts;	///< Number of values on each outgoing edge
+		std::vector<int> send_displs;	///< Offset of each outgoing edge in send buffer
+		std::vector<int> recv_counts;	///< Number of values on each incoming edge
+		std::vector<int> recv_displs;	///< Offset of each incoming edge in receive buffer
+		std::vector<lbm_pop_t> send_buffer;	///< Single packed outgoing buffer
+		std::vector<lbm_pop_t> recv_buffer;	///< Single packed incoming buffer
+
+		HaloNeighbourStruct(int l, int r)
+			: level(l), region(r), graph_comm(MPI_COMM_NULL), request(MPI_REQUEST_NULL) {};
+	};
+	eHaloEngine halo_engine;								///< Engine used by mpi_communicate
+	std::vector<HaloNeighbourStruct> halo_neighbour_info;	///< Neighbourhood collective data for each grid on the rank
+
 	/// Logfile handle
 	std::ofstream* logout;
 
@@ -211,6 +238,12 @@ public :
 	std::vector<std::vector<SupportCommMarkerSideClass>> supportCommMarkerSide;		///< Marker-side marker-support comm
 	std::vector<std::vector<SupportCommSupportSideClass>> supportCommSupportSide;	///< Support-side marker-support comm
 
+	// Persistent IBM exchanges (rebuilt with the comm classes above)
+	std::vector<IBCommPersistentClass> epsilonGatherComm;		///< Marker-to-owner support data exchange
+	std::vector<IBCommPersistentClass> epsilonScatterComm;		///< Owner-to-marker epsilon exchange
+	std::vector<IBCommPersistentClass> interpolateComm;			///< Support-to-marker density and momentum exchange
+	std::vector<IBCommPersistentClass> spreadComm;				///< Marker-to-support force exchange
+
 
 
 	/************** Member Methods **************/
@@ -253,6 +286,9 @@ public :
 	// Comms
 	void mpi_communicate( int level, int regnum );		// Wrapper routine for communication between grids of given level/region
 	int mpi_getOpposite(int direction);					// Version of GridUtils::getOpposite for MPI_directions rather than lattice directions
+	void mpi_buildNeighbourComms();						// Build distributed graph communicators for the neighbourhood collective engine
+	void mpi_neighbourExchange(GridObj* const g);		// Halo exchange for a grid using a single neighbourhood collective
+	void mpi_communicateReport(GridObj* const g, clock_t secs);	// Update MPI overhead average and log output after a halo exchange
 
 	// IBM
 	void mpi_buildMarkerComms(int level);												// Build comms required for epsilon calculation
@@ -261,11 +297,16 @@ public :
 	void mpi_epsilonCommScatter(int level);												// Do communication required for epsilon calculation
 	void mpi_uniEpsilonCommGather(int level, int rootRank, IBBody &iBodyTmp);			// Do communication required for universal epsilon calculation
 	void mpi_uniEpsilonCommScatter(int level, int rootRank, IBBody &iBodyTmp);			// Do communication required for universal epsilon calculation
-	void mpi_interpolateComm(int level, std::vector<std::vector<double>> &interpVels);	// Do communication required for velocity interpolation
-	void mpi_spreadComm(int level, std::vector<std::vector<double>> &spreadForces);		// Do communication required for force spreading
+	void mpi_interpolateComm(int level);												// Do communication required for velocity interpolation
+	void mpi_spreadComm(int level);														// Do communication required for force spreading
+	void mpi_buildPersistentComm(IBCommPersistentClass &comm,
+		std::vector<int> &sendCounts, std::vector<int> &recvCounts);					// (Re)build persistent requests for an IBM exchange
+	void mpi_exchangePersistentComm(IBCommPersistentClass &comm);						// Start and complete a persistent IBM exchange
+	void mpi_freePersistentComm(IBCommPersistentClass &comm);							// Release persistent requests of an IBM exchange
 	void mpi_dsCommScatter(int level);													// Spread the ds values from owner to other ranks
 	void mpi_ptCloudMarkerGather(IBBody *iBody, std::vector<double> &recvPositionBuffer, std::vector<int> &recvIDBuffer, std::vector<int> &recvSizeBuffer, std::vector<int> &recvDisps);		// Gather in info for pt cloud sorter
 	void mpi_ptCloudMarkerScatter(IBBody *iBody, std::vector<int> &recvIDBuffer, std::vector<int> &recvSizeBuffer, std::vector<int> &recvDisps);	// Scatter info for pt cloud sorter
+	void mpi_ptCloudDistribute(PCpts *_PCpts);											// Send pt cloud points to the ranks on which they lie
 
 	// FEM
 	void mpi_forceCommGather(int level);
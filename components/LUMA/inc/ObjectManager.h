@@ -94,11 +94,17 @@ private:
 	std::ofstream debugstream;
 
 	// Bounce-back object fields
-	double bbbForceOnObjectX = 0.0;			///< Instantaneous X-direction force on BB bodies in domain
-	double bbbForceOnObjectY = 0.0;			///< Instantaneous Y-direction force on BB bodies in domain
-	double bbbForceOnObjectZ = 0.0;			///< Instantaneous Z-direction force on BB bodies in domain
-	int bbbOnGridLevel = -1;				///< Grid level on which the BB body resides
-	int bbbOnGridReg = -1;					///< Grid region on which the BB body resides
+	std::vector<double> bbbForceOnObjectX;	///< Instantaneous X-direction force on each BB body on this rank
+	std::vector<double> bbbForceOnObjectY;	///< Instantaneous Y-direction force on each BB body on this rank
+	std::vector<double> bbbForceOnObjectZ;	///< Instantaneous Z-direction force on each BB body on this rank
+	int bbbOnGridLevel = -1;				///< Grid level on which the BB bodies reside
+	int bbbOnGridReg = -1;					///< Grid region on which the BB bodies reside
+	std::vector<int> bbbBodyID;				///< ID of each BB body on this rank
+	std::vector< std::vector<int> > bbbSolidSites;	///< Flattened indices of sites labelled solid by each BB body on its grid
+	std::vector<int> bbbLinkSite;			///< Flattened index of the fluid site at the end of each fluid-body link
+	std::vector<int> bbbLinkDir;			///< Lattice direction of each fluid-body link pointing into the body
+	std::vector<int> bbbLinkBody;			///< Index of the BB body each fluid-body link points into
+	bool bbbLinksBuilt = false;				///< Flag indicating the fluid-body link list has been built
 
 	// Objects (could be stored in a single Body array if we use pointers)
 	std::vector<IBBody> iBody;				///< Array of immersed boundary bodies
@@ -124,6 +130,11 @@ private:
 	double timeav_subResidual;
 	double timeav_subIterations;
 
+	// Sub-iteration save/restore of support sites
+	std::vector<std::vector<int>> subSavedIds;		///< Sites saved at the start of the time step on each level
+	std::vector<std::vector<double>> subSavedVel;	///< Velocity at the saved sites on each level
+	std::vector<std::vector<char>> subSavedFlag;	///< Flag indicating a grid site has been saved on each level
+
 	/* Methods */
 
 private:
@@ -147,6 +158,7 @@ public:
 	void ibm_updateMacroscopic(int level);											// Update the macroscopic values with the IBM force
 	void ibm_findSupport(int ib);													// Populates support information for the m-th marker of ib-th body.
 	void ibm_initialiseSupport(int ib, int m, std::vector<double> &estimated_position);	// Initialises data associated with the support points.
+	void ibm_buildSupportCache(int level);											// Flatten the on-rank support of all bodies on a level.
 	void ibm_computeForce(int level);												// Compute restorative force at each marker in ib-th body.
 	void ibm_findEpsilon(int level);												// Method to find epsilon weighting parameter for ib-th body.
 	void ibm_computeDs(int level);
@@ -156,6 +168,8 @@ public:
 	void ibm_universalEpsilonScatter(int level, IBBody &iBodyTmp);					// Gather all the markers into the temporary iBody vector
 	void ibm_subIterate(GridObj *g);												// Subiterate to enforce correct kinematic conditions at interface
 	double ibm_checkVelDiff(int level);												// Check residual from sub-iteration step
+	void ibm_saveSupportVelocities(GridObj *g, bool bNewStep);						// Save velocities at support sites before they are modified
+	void ibm_restoreSupportVelocities(GridObj *g);									// Restore velocities and reset forces at saved support sites
 
 	// IBM Debug methods //
 	void ibm_debug_epsilon(int ib);
@@ -177,7 +191,9 @@ public:
 	void addBouncebackObject(GridObj *g, GeomPacked *geom, PCpts *_PCpts);	// Method to add a BBB from the cloud reader.
 	void computeLiftDrag(int i, int j, int k, GridObj *g);			// Compute force using Momentum Exchange for BBB on supplied grid.
 	void computeLiftDrag(int v, int id, GridObj *g, int markerID);	// Compute force using Momentum Exchange for BFL on supplied grid.
+	void computeLiftDrag(GridObj *g);								// Compute force using Momentum Exchange for BBB from the link list.
 	void resetMomexBodyForces(GridObj * grid);						// Reset the force stores for Momentum Exchange
+	void buildMomexLinks(GridObj *g);								// Build the fluid-body link list for Momentum Exchange
 
 	// IO methods //
 	void io_vtkBodyWriter(int tval);						// VTK body writer wrapper
@@ -186,6 +202,8 @@ public:
 	void io_writeLiftDrag();								// Write out IBBody lift and drag at specified timestep
 	void io_restart(eIOFlag IO_flag, int level);			// Restart read and write for IBBodies given grid level
 	void io_readInCloud(PCpts*& _PCpts, GeomPacked *geom);	// Method to read in Point Cloud data
+	void io_readInBinaryCloud(PCpts *_PCpts, const std::string &fileName,
+		double *cloudMin, double *cloudMax);				// Method to read in this rank's chunk of a binary Point Cloud
 	void io_writeForcesOnObjects(double tval);				// Method to write object forces to a csv file
 	void io_readInGeomConfig();								// Read in geometry configuration file
 	void io_writeTipPositions(int t);						// Write out tip positions of flexible filaments
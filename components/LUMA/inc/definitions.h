@@ -98,6 +98,7 @@
 #define L_OUTPUT_PRECISION 10					///< Precision of output (for text writers)
 #define L_RESTART_OUT_FREQ (100*L_GRID_OUT_FREQ)			///< Frequency of write out of restart file
 #define L_PROBE_OUT_FREQ 1000000				///< Write out frequency of probe output
+#define L_EXTRACT_OUT_FREQ 100				///< Write out frequency of in-situ extracts
 
 // Types of output
 //#define L_IO_LITE				///< ASCII dump on output
@@ -105,6 +106,7 @@
 //#define L_LD_OUT				///< Write out lift and drag (all bodies)
 //#define L_IO_FGA				///< Write the components of the macroscopic velocity in a .fga file. (To be used in Unreal Engine 4).
 //#define L_PROBE_OUTPUT			///< Write out probe data
+//#define L_EXTRACT_OUTPUT			///< Write out planes, boxes and decimations defined in extract.config (requires L_HDF5_OUTPUT)
 
 // Probe output options
 #define L_PROBE_NUM_X 0						///< Number of probes in X direction
@@ -133,9 +135,15 @@
 //#define L_USE_KBC_COLLISION					///< Use KBC collision operator instead of LBGK by default
 //#define L_USE_BGKSMAG
 #define L_CSMAG 0.3
+//#define L_FLOAT_POPULATIONS				///< Store distribution functions in single precision (macroscopic fields and collision arithmetic stay double)
+//#define L_SPARSE_STORAGE					///< Store distribution functions only for active sites (solid and refined sites share a single dummy slot)
+#define L_SPARSE_MIN_INACTIVE_FRACTION 0.2	///< Only compact a grid when at least this fraction of its sites are inactive
 
 /// Compute the time-averaged values of velocity, density and the velocity products.
 //#define L_COMPUTE_TIME_AVERAGED_QUANTITIES
+#define L_TIME_AVERAGE_STRIDE 1				///< Sample the time-averaged quantities every this many time steps
+#define L_TIME_AVERAGE_OFFSET 0				///< Time step (modulo the stride) at which samples are taken (set stride to the period for phase averaging)
+#define L_TIME_AVERAGE_WINDOW 0				///< Number of samples after which the averages restart (0 to average over the whole run)
 
 /*
 *******************************************************************************
@@ -161,6 +169,9 @@
 //#define L_MPI_SMART_DECOMPOSE		///< Use smart decomposition to improve load balancing
 #define L_MPI_SD_MAX_ITER 1600		///< Max number of iterations to be used for smart decomposition algorithm
 
+// Halo exchange engine (override at run time by setting LUMA_HALO_ENGINE to "p2p" or "neighbour")
+#define L_MPI_HALO_ENGINE eHaloPointToPoint	///< Default engine: eHaloPointToPoint or eHaloNeighbourCollective
+
 // Topology report
 //#define L_MPI_TOPOLOGY_REPORT		///< Have the MPI Manager report on different combinations of X Y Z cores
 #define L_MPI_TOP_XCORES 12			///< Max number of X MPI ranks to use for the topology report
@@ -317,6 +328,10 @@ static std::string pleWrite[L_PLE_INTERFACES] = { "v"};*/
 #define L_NB_ALPHA 0.25					///< Parameter for Newmark-Beta time integration (0.25 for 2nd order)
 #define L_NB_DELTA 0.5					///< Parameter for Newmark-Beta time integration (0.5 for 2nd order)
 #define L_RELAX 0.5						///< Under-relaxation for FSI coupling
+#define L_FEM_BANDED_SOLVER				///< Use banded LU for the FEM Newton-Raphson systems (dense LU otherwise)
+#define L_FEM_REFACTOR_TOL 1e-3			///< Relative change in effective stiffness below which the banded LU is reused
+//#define L_AITKEN_RELAX					///< Use Aitken dynamic relaxation for FSI coupling (L_RELAX used for first sub-iteration)
+//#define L_IBM_SUBIT_SUPPORT_ONLY		///< Opt-in: only save/restore IBM support sites between FSI sub-iterations rather than whole fields
 #define L_WRITE_TIP_POSITIONS			///< Turn on writing out filament tip positions (only works on flexible filaments)
 
 /*
@@ -405,6 +420,15 @@ const static double cProbeLimsX[2] = { L_PROBE_MIN_X, L_PROBE_MAX_X };	///< Limi
 const static double cProbeLimsY[2] = { L_PROBE_MIN_Y, L_PROBE_MAX_Y };	///< Limits of Y plane for array of probes
 const static double cProbeLimsZ[2] = { L_PROBE_MIN_Z, L_PROBE_MAX_Z };	///< Limits of Z plane for array of probes
 
+// Storage type of the distribution functions and matching MPI datatype
+#ifdef L_FLOAT_POPULATIONS
+typedef float lbm_pop_t;
+#define L_MPI_POP_TYPE MPI_FLOAT
+#else
+typedef double lbm_pop_t;
+#define L_MPI_POP_TYPE MPI_DOUBLE
+#endif
+
 // Set dependent options
 #if (L_DIMS == 3)
 
@@ -68,10 +68,13 @@
 #include <fstream>
 #include <sstream>
 #include <numeric>
+#include <limits>
 #include <valarray>
 #include <assert.h>
 #include <functional>
 #include <map>
+#include <unordered_map>
+#include <chrono>
 
 // Check OS is Windows or not
 #ifdef _WIN32
@@ -0,0 +1,567 @@
+/*
+* --------------------------------------------------------------
+*
+* ------ Lattice Boltzmann @ The University of Manchester ------
+*
+* -------------------------- L-U-M-A ---------------------------
+*
+* Copyright 2019 The University of Manchester
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.*
+*/
+
+#include "../inc/stdafx.h"
+#include "../inc/GridObj.h"
+#include "../inc/ExtractManager.h"
+#include "hdf5.h"
+
+// Static declarations
+ExtractManager* ExtractManager::me;
+
+// *****************************************************************************
+/// Default constructor
+ExtractManager::Extract::Extract()
+	: type(eBoxExtract), level(0), region(0), stride(1), grid(nullptr), bFileCreated(false)
+{
+	for (int d = 0; d < 6; ++d) limits[d] = 0.0;
+	for (int d = 0; d < 3; ++d)
+	{
+		first[d] = 0;
+		count[d] = 1;
+		origin[d] = 0.0;
+	}
+}
+
+/// Default destructor
+ExtractManager::Extract::~Extract()
+{
+}
+
+/// \brief	Total number of samples in the extract.
+/// \return	number of samples.
+size_t ExtractManager::Extract::size() const
+{
+	return static_cast<size_t>(count[0]) * count[1] * count[2];
+}
+
+// *****************************************************************************
+/// Private constructor
+ExtractManager::ExtractManager()
+	: bInitialised(false)
+{
+}
+
+/// Private destructor
+ExtractManager::~ExtractManager()
+{
+	me = nullptr;
+}
+
+/// Instance creator
+ExtractManager* ExtractManager::getInstance()
+{
+	if (!me) me = new ExtractManager();	// Private construction
+	return me;							// Return pointer to new object
+}
+
+/// Instance destroyer
+void ExtractManager::destroyInstance()
+{
+	delete me;			// Delete pointer from static context (destructor will be called automatically)
+}
+
+/// \brief	Number of extracts defined.
+/// \return	number of extracts.
+size_t ExtractManager::getNumExtracts() const
+{
+	return extracts.size();
+}
+
+// *****************************************************************************
+/// \brief	Read in the extract configuration file.
+///
+///			Reads ./input/extract.config. Each non-comment line defines one
+///			extract using one of the following keywords:
+///
+///			PLANE NAME LEV REG DIRECTION POSITION STRIDE
+///			BOX NAME LEV REG XMIN XMAX YMIN YMAX ZMIN ZMAX STRIDE
+///			DECIMATE NAME LEV REG STRIDE
+void ExtractManager::io_readInExtractConfig()
+{
+
+	// Open config file
+	std::ifstream file;
+	file.open("./input/extract.config", std::ios::in);
+
+	// Handle failure to open
+	if (!file.is_open()) {
+		L_ERROR("Error opening extract configuration file. Exiting.", GridUtils::logfile);
+	}
+
+	// Read line by line skipping comments and blank lines
+	std::string line;
+	while (std::getline(file, line))
+	{
+		if (line.empty() || line[0] == '#') continue;
+
+		std::istringstream iss(line);
+		std::string extractCase;
+		if (!(iss >> extractCase)) continue;
+
+		Extract ex;
+		iss >> ex.name >> ex.level >> ex.region;
+
+		// ** PLANE ** //
+		if (extractCase == "PLANE")
+		{
+			std::string direction; iss >> direction;
+			double position; iss >> position;
+			iss >> ex.stride;
+
+			ex.type = ePlaneExtract;
+
+			// Plane spans the whole grid except in its normal direction
+			ex.limits[eXMin] = ex.limits[eYMin] = ex.limits[eZMin] = -std::numeric_limits<double>::max();
+			ex.limits[eXMax] = ex.limits[eYMax] = ex.limits[eZMax] = std::numeric_limits<double>::max();
+			if (direction == "X")
+				ex.limits[eXMin] = ex.limits[eXMax] = position;
+			else if (direction == "Y")
+				ex.limits[eYMin] = ex.limits[eYMax] = position;
+			else if (direction == "Z")
+				ex.limits[eZMin] = ex.limits[eZMax] = position;
+			else
+				L_ERROR("Unknown direction " + direction + " for extract " + ex.name + ". Exiting.", GridUtils::logfile);
+		}
+
+		// ** BOX ** //
+		else if (extractCase == "BOX")
+		{
+			iss >> ex.limits[eXMin] >> ex.limits[eXMax]
+				>> ex.limits[eYMin] >> ex.limits[eYMax]
+				>> ex.limits[eZMin] >> ex.limits[eZMax];
+			iss >> ex.stride;
+
+			ex.type = eBoxExtract;
+		}
+
+		// ** DECIMATE ** //
+		else if (extractCase == "DECIMATE")
+		{
+			iss >> ex.stride;
+
+			ex.type = eDecimateExtract;
+			ex.limits[eXMin] = ex.limits[eYMin] = ex.limits[eZMin] = -std::numeric_limits<double>::max();
+			ex.limits[eXMax] = ex.limits[eYMax] = ex.limits[eZMax] = std::numeric_limits<double>::max();
+		}
+
+		else
+		{
+			L_ERROR("Unknown keyword " + extractCase + " in extract configuration file. Exiting.", GridUtils::logfile);
+		}
+
+		// Check the line was complete
+		if (iss.fail())
+			L_ERROR("Incomplete definition for extract " + ex.name + ". Exiting.", GridUtils::logfile);
+		if (ex.stride < 1)
+			L_ERROR("Stride for extract " + ex.name + " must be at least 1. Exiting.", GridUtils::logfile);
+		if (ex.level < 0 || ex.level > L_NUM_LEVELS || ex.region < 0 || ex.region >= L_NUM_REGIONS)
+			L_ERROR("Extract " + ex.name + " references a grid which does not exist. Exiting.", GridUtils::logfile);
+
+		L_INFO("Adding extract " + ex.name + " (" + extractCase + ") on L" + std::to_string(ex.level) +
+			" R" + std::to_string(ex.region) + " with stride " + std::to_string(ex.stride), GridUtils::logfile);
+
+		extracts.push_back(ex);
+	}
+
+	file.close();
+}
+
+// *****************************************************************************
+/// \brief	Resolve the sites belonging to each extract.
+///
+///			Must be called once all grids have been built and the writable data
+///			descriptors exist in the grid manager. The mapping between local
+///			sites and extract samples is computed once here so that writing an
+///			extract is a simple pack and gather.
+///
+/// \param	Grids	pointer to the grid hierarchy.
+void ExtractManager::initialise(GridObj *const Grids)
+{
+	for (Extract &ex : extracts)
+		_resolveExtract(ex, Grids);
+
+	bInitialised = true;
+}
+
+// *****************************************************************************
+/// \brief	Locate the sites of a single extract.
+///
+///			Samples are indexed by their global lattice index on the target grid
+///			so that every rank arrives at the same extract layout without any
+///			communication. Only writable sites (excluding halo and TL) are
+///			considered so each sample is contributed by exactly one rank.
+///
+/// \param	ex		extract to resolve.
+/// \param	Grids	pointer to the grid hierarchy.
+void ExtractManager::_resolveExtract(Extract &ex, GridObj *const Grids)
+{
+	GridManager *gm = GridManager::getInstance();
+
+	// Index of the grid in the grid manager arrays
+	int idx = (ex.level == 0) ? 0 : ex.level + ex.region * L_NUM_LEVELS;
+
+	// Global layout of the grid
+	double dh = L_COARSE_SITE_WIDTH / pow(2, ex.level);
+	double base[3];
+	base[eXDirection] = gm->global_edges[eXMin][idx] + 0.5 * dh;
+	base[eYDirection] = gm->global_edges[eYMin][idx] + 0.5 * dh;
+	base[eZDirection] = gm->global_edges[eZMin][idx] + 0.5 * dh;
+
+	// Compute the sampled global index range in each direction
+	for (int d = 0; d < L_DIMS; ++d)
+	{
+		double lo = GridUtils::downToLimit(
+			GridUtils::upToZero(ex.limits[2 * d] - base[d] + 0.5 * dh) - 0.5 * dh, 
+			static_cast<double>(gm->global_size[d][idx]) * dh);
+		double hi = GridUtils::downToLimit(
+			GridUtils::upToZero(ex.limits[2 * d + 1] - base[d] + 0.5 * dh) - 0.5 * dh,
+			static_cast<double>(gm->global_size[d][idx]) * dh);
+		int last;
+
+		if (ex.limits[2 * d] == ex.limits[2 * d + 1])
+		{
+			// Plane snaps to the nearest site
+			ex.first[d] = static_cast<int>(std::round(lo / dh));
+			last = ex.first[d];
+		}
+		else
+		{
+			ex.first[d] = static_cast<int>(std::ceil(lo / dh - L_SMALL_NUMBER));
+			last = static_cast<int>(std::floor(hi / dh + L_SMALL_NUMBER));
+		}
+
+		// Clamp to the grid
+		ex.first[d] = std::max(ex.first[d], 0);
+		last = std::min(last, gm->global_size[d][idx] - 1);
+		if (last < ex.first[d])
+			L_ERROR("Extract " + ex.name + " does not intersect its grid. Exiting.", GridUtils::logfile);
+
+		ex.count[d] = (last - ex.first[d]) / ex.stride + 1;
+		ex.origin[d] = base[d] + ex.first[d] * dh;
+	}
+
+	// Retrieve grid and its writable region on this rank
+	ex.grid = nullptr;
+	ex.localIds.clear();
+	ex.extractIds.clear();
+	GridUtils::getGrid(Grids, ex.level, ex.region, ex.grid);
+
+	bool bHasWritableData = false;
+	HDFstruct p_data;
+	if (ex.grid != nullptr)
+	{
+		for (HDFstruct pd : gm->p_data) {
+			if (pd.level == ex.level && pd.region == ex.region) {
+				p_data = pd;
+				bHasWritableData = (pd.writable_data_count > 0);
+				break;
+			}
+		}
+	}
+
+	if (bHasWritableData)
+	{
+		GridObj *g = ex.grid;
+		int starts[3] = { p_data.i_start, p_data.j_start, p_data.k_start };
+		int ends[3] = { p_data.i_end, p_data.j_end, p_data.k_end };
+		std::vector<double> *pos[3] = { &g->XPos, &g->YPos, &g->ZPos };
+
+		// Pairs of local index and sample index in each direction
+		std::vector<int> localIdx[3], sampleIdx[3];
+		for (int d = 0; d < 3; ++d)
+		{
+			if (d >= L_DIMS)
+			{
+				localIdx[d].push_back(0);
+				sampleIdx[d].push_back(0);
+				continue;
+			}
+
+			for (int i = starts[d]; i <= ends[d]; ++i)
+			{
+				int n = static_cast<int>(std::round(((*pos[d])[i] - base[d]) / dh));
+				if (n < ex.first[d] || (n - ex.first[d]) % ex.stride != 0) continue;
+				int s = (n - ex.first[d]) / ex.stride;
+				if (s >= ex.count[d]) continue;
+				localIdx[d].push_back(i);
+				sampleIdx[d].push_back(s);
+			}
+		}
+
+		// Build the flattened mappings
+		for (size_t a = 0; a < localIdx[0].size(); ++a)
+		{
+			for (size_t b = 0; b < localIdx[1].size(); ++b)
+			{
+				for (size_t c = 0; c < localIdx[2].size(); ++c)
+				{
+					ex.localIds.push_back(localIdx[2][c] + localIdx[1][b] * g->K_lim + localIdx[0][a] * g->K_lim * g->M_lim);
+					ex.extractIds.push_back(sampleIdx[2][c] + sampleIdx[1][b] * ex.count[2] + sampleIdx[0][a] * ex.count[2] * ex.count[1]);
+				}
+			}
+		}
+	}
+
+	// Share the mapping with the root rank once
+	int localCount = static_cast<int>(ex.localIds.size());
+	int rank = GridUtils::safeGetRank();
+
+#ifdef L_BUILD_FOR_MPI
+	MpiManager *mpim = MpiManager::getInstance();
+	if (rank == 0) ex.recvCounts.resize(mpim->num_ranks);
+	MPI_Gather(&localCount, 1, MPI_INT, ex.recvCounts.data(), 1, MPI_INT, 0, mpim->world_comm);
+
+	int totalCount = 0;
+	if (rank == 0)
+	{
+		ex.recvDispls.resize(mpim->num_ranks);
+		for (int r = 0; r < mpim->num_ranks; ++r)
+		{
+			ex.recvDispls[r] = totalCount;
+			totalCount += ex.recvCounts[r];
+		}
+		ex.gatheredIds.resize(totalCount);
+	}
+	MPI_Gatherv(ex.extractIds.data(), localCount, MPI_INT,
+		ex.gatheredIds.data(), ex.recvCounts.data(), ex.recvDispls.data(), MPI_INT,
+		0, mpim->world_comm);
+#else
+	ex.recvCounts.assign(1, localCount);
+	ex.recvDispls.assign(1, 0);
+	ex.gatheredIds = ex.extractIds;
+	int totalCount = localCount;
+#endif
+
+	if (rank == 0)
+	{
+		if (static_cast<size_t>(totalCount) != ex.size())
+			L_WARN("Extract " + ex.name + " resolved " + std::to_string(totalCount) + " of " + 
+				std::to_string(ex.size()) + " samples.", GridUtils::logfile);
+
+		L_INFO("Extract " + ex.name + " resolved to " + std::to_string(ex.count[0]) + "x" + 
+			std::to_string(ex.count[1]) + "x" + std::to_string(ex.count[2]) + " samples.", GridUtils::logfile);
+	}
+}
+
+// *****************************************************************************
+/// \brief	Pack, gather and reorder one component of a field.
+///
+///			On exit, the root rank holds the values of the field at every
+///			sample of the extract in extract order in fileBuffer.
+///
+/// \param	ex			extract being written.
+/// \param	field		field to sample.
+/// \param	component	component of the field to sample.
+/// \param	stride		number of components stored per site.
+void ExtractManager::_gatherField(Extract &ex, IVector<double> &field, int component, int stride)
+{
+	// Pack local samples
+	sendBuffer.resize(ex.localIds.size());
+	for (size_t n = 0; n < ex.localIds.size(); ++n)
+		sendBuffer[n] = field[component + ex.localIds[n] * stride];
+
+	int rank = GridUtils::safeGetRank();
+
+#ifdef L_BUILD_FOR_MPI
+	if (rank == 0) recvBuffer.resize(ex.gatheredIds.size());
+	MPI_Gatherv(sendBuffer.data(), static_cast<int>(sendBuffer.size()), MPI_DOUBLE,
+		recvBuffer.data(), ex.recvCounts.data(), ex.recvDispls.data(), MPI_DOUBLE,
+		0, MpiManager::getInstance()->world_comm);
+#else
+	recvBuffer.swap(sendBuffer);
+#endif
+
+	// Reorder into extract order
+	if (rank == 0)
+	{
+		fileBuffer.assign(ex.size(), 0.0);
+		for (size_t n = 0; n < ex.gatheredIds.size(); ++n)
+			fileBuffer[ex.gatheredIds[n]] = recvBuffer[n];
+	}
+}
+
+// *****************************************************************************
+/// \brief	Gather and write all extracts.
+///
+///			Must be called by all ranks. Each extract is written to its own file
+///			extract_<NAME>.h5 with data grouped into timesteps in the same
+///			manner as the full-field HDF5 writer.
+///
+/// \param	tval	time value being written out.
+void ExtractManager::io_writeExtracts(int tval)
+{
+	if (!bInitialised)
+		L_ERROR("Extracts written before being initialised. Exiting.", GridUtils::logfile);
+
+	for (Extract &ex : extracts)
+		_writeExtract(ex, tval);
+}
+
+// *****************************************************************************
+/// \brief	Write a single extract.
+///
+/// \param	ex		extract to write.
+/// \param	tval	time value being written out.
+void ExtractManager::_writeExtract(Extract &ex, int tval)
+{
+	int rank = GridUtils::safeGetRank();
+
+	// Fields to write
+	std::vector<std::string> names;
+	std::vector<IVector<double>*> fields;
+	std::vector<int> components, strides;
+
+	// Use a dummy field on ranks which do not hold the grid
+	IVector<double> empty;
+	GridObj *g = ex.grid;
+
+	names.push_back("Rho");
+	fields.push_back(g ? &g->rho : &empty); components.push_back(0); strides.push_back(1);
+	names.push_back("Ux");
+	fields.push_back(g ? &g->u : &empty); components.push_back(0); strides.push_back(L_DIMS);
+	names.push_back("Uy");
+	fields.push_back(g ? &g->u : &empty); components.push_back(1); strides.push_back(L_DIMS);
+#if (L_DIMS == 3)
+	names.push_back("Uz");
+	fields.push_back(g ? &g->u : &empty); components.push_back(2); strides.push_back(L_DIMS);
+#endif
+#ifdef L_TEMPERATURE
+	names.push_back("Temperature");
+	fields.push_back(g ? &g->T_out : &empty); components.push_back(0); strides.push_back(1);
+#endif
+
+	// File and dataspace set up on the root only
+	hid_t file_id = static_cast<hid_t>(NULL);
+	hid_t group_id = static_cast<hid_t>(NULL);
+	hid_t filespace = static_cast<hid_t>(NULL);
+	hid_t dataset_id = static_cast<hid_t>(NULL);
+	herr_t status = 0;
+	const std::string time_string("/Time_" + std::to_string(tval));
+	const std::string FILE_NAME(GridUtils::path_str + "/extract_" + ex.name + ".h5");
+
+	if (rank == 0)
+	{
+		// Turn auto error printing off
+		H5Eset_auto(H5E_DEFAULT, NULL, NULL);
+
+		// Create on the first write of this run and append thereafter. A file
+		// left by a previous run is truncated on a fresh start but appended 
+		// to when restarting so the history before the restart is kept.
+		bool bNewFile = !ex.bFileCreated;
+#ifdef L_RESTARTING
+		if (bNewFile)
+		{
+			std::ifstream test(FILE_NAME);
+			bNewFile = !test.good();
+			test.close();
+		}
+#endif
+		if (bNewFile) file_id = H5Fcreate(FILE_NAME.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+		else file_id = H5Fopen(FILE_NAME.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+		if (file_id < 0) *GridUtils::logfile << "HDF5 ERROR: Open extract file failed!" << std::endl;
+		else ex.bFileCreated = true;
+
+		// Dataspace sized by the extract
+		hsize_t dimsf[L_DIMS];
+		for (int d = 0; d < L_DIMS; ++d) dimsf[d] = ex.count[d];
+		filespace = H5Screate_simple(L_DIMS, dimsf, NULL);
+
+		// Attributes describing the sampling on first write
+		if (bNewFile)
+		{
+			hsize_t dimsa[1] = { L_DIMS };
+			int buffer_int_array[L_DIMS];
+			double buffer_double_array[L_DIMS];
+			double buffer_double = (L_COARSE_SITE_WIDTH / pow(2, ex.level)) * ex.stride;
+
+			hid_t attspace = H5Screate_simple(1, dimsa, NULL);
+			for (int d = 0; d < L_DIMS; ++d) buffer_int_array[d] = ex.count[d];
+			hid_t attrib_id = H5Acreate(file_id, "GridSize", H5T_NATIVE_INT, attspace, H5P_DEFAULT, H5P_DEFAULT);
+			status = H5Awrite(attrib_id, H5T_NATIVE_INT, &buffer_int_array[0]);
+			if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Attribute write failed: " << status << std::endl;
+			H5Aclose(attrib_id);
+
+			for (int d = 0; d < L_DIMS; ++d) buffer_double_array[d] = ex.origin[d];
+			attrib_id = H5Acreate(file_id, "Origin", H5T_NATIVE_DOUBLE, attspace, H5P_DEFAULT, H5P_DEFAULT);
+			status = H5Awrite(attrib_id, H5T_NATIVE_DOUBLE, &buffer_double_array[0]);
+			if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Attribute write failed: " << status << std::endl;
+			H5Aclose(attrib_id);
+			H5Sclose(attspace);
+
+			dimsa[0] = 1;
+			attspace = H5Screate_simple(1, dimsa, NULL);
+			attrib_id = H5Acreate(file_id, "Dx", H5T_NATIVE_DOUBLE, attspace, H5P_DEFAULT, H5P_DEFAULT);
+			status = H5Awrite(attrib_id, H5T_NATIVE_DOUBLE, &buffer_double);
+			if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Attribute write failed: " << status << std::endl;
+			H5Aclose(attrib_id);
+
+			attrib_id = H5Acreate(file_id, "Stride", H5T_NATIVE_INT, attspace, H5P_DEFAULT, H5P_DEFAULT);
+			status = H5Awrite(attrib_id, H5T_NATIVE_INT, &ex.stride);
+			if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Attribute write failed: " << status << std::endl;
+			H5Aclose(attrib_id);
+
+			int buffer_int = ex.level;
+			attrib_id = H5Acreate(file_id, "Level", H5T_NATIVE_INT, attspace, H5P_DEFAULT, H5P_DEFAULT);
+			status = H5Awrite(attrib_id, H5T_NATIVE_INT, &buffer_int);
+			if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Attribute write failed: " << status << std::endl;
+			H5Aclose(attrib_id);
+			H5Sclose(attspace);
+		}
+
+		// Create group for this time (open it if this time was already written)
+		if (H5Lexists(file_id, time_string.c_str(), H5P_DEFAULT) > 0)
+			group_id = H5Gopen(file_id, time_string.c_str(), H5P_DEFAULT);
+		else
+			group_id = H5Gcreate(file_id, time_string.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+		if (group_id < 0) *GridUtils::logfile << "HDF5 ERROR: Create extract group failed!" << std::endl;
+	}
+
+	// Gather each field and write it out
+	for (size_t f = 0; f < fields.size(); ++f)
+	{
+		_gatherField(ex, *fields[f], components[f], strides[f]);
+
+		if (rank == 0)
+		{
+			std::string variable_name = time_string + "/" + names[f];
+			if (H5Lexists(file_id, variable_name.c_str(), H5P_DEFAULT) > 0)
+				dataset_id = H5Dopen(file_id, variable_name.c_str(), H5P_DEFAULT);
+			else
+				dataset_id = H5Dcreate(file_id, variable_name.c_str(), H5T_NATIVE_DOUBLE, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+			status = H5Dwrite(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, fileBuffer.data());
+			if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Extract dataset write failed: " << status << std::endl;
+			status = H5Dclose(dataset_id);
+			if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Close dataset failed: " << status << std::endl;
+		}
+	}
+
+	if (rank == 0)
+	{
+		status = H5Sclose(filespace);
+		if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Close filespace failed: " << status << std::endl;
+		status = H5Gclose(group_id);
+		if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Close group failed: " << status << std::endl;
+		status = H5Fclose(file_id);
+		if (status != 0) *GridUtils::logfile << "HDF5 ERROR: Close file failed: " << status << std::endl;
+	}
+}
@@ -38,6 +38,10 @@ FEMBody::FEMBody () {
 	res = 0.0;
 	timeav_FEMIterations = 0.0;
 	timeav_FEMResidual = 0.0;
+	subIt = 0;
+	aitkenOmega = L_RELAX;
+	bandWidth = 0;
+	refactorise = true;
 	BC_DOFs = 0;
 }
 
@@ -71,6 +75,10 @@ FEMBody::FEMBody (IBBody *iBody, std::vector<double> &start_position, double len
 	res = 0.0;
 	timeav_FEMIterations = 0.0;
 	timeav_FEMResidual = 0.0;
+	subIt = 0;
+	aitkenOmega = L_RELAX;
+	bandWidth = DOFsPerElement - 1;
+	refactorise = true;
 
 	// Set number of DOFs to remove in BC
 	if (clamped == true)
@@ -156,6 +164,7 @@ void FEMBody::dynamicFEM () {
 
 	// Set while counter to zero
 	it = 0;
+	double resPrev = 0.0;
 
 	// While loop for FEM solver
 	do {
@@ -166,6 +175,11 @@ void FEMBody::dynamicFEM () {
 		// Check residual
 		res = checkNRConvergence();
 
+		// Force a new factorisation if reusing the old one has stalled convergence
+		if (it > 0 && res >= resPrev)
+			refactorise = true;
+		resPrev = res;
+
 		// Increment counter
 		it++;
 
@@ -206,7 +220,11 @@ void FEMBody::newtonRaphsonIterator () {
 	setNewmark();
 
 	// Solve linear system using LAPACK library
+#ifdef L_FEM_BANDED_SOLVER
+	solveBanded();
+#else
 	delU = GridUtils::solveLinearSystem(K, F, BC_DOFs);
+#endif
 
 	// Add deltaU to U
 	for (int i = 0; i < systemDOFs; i++) {
@@ -217,6 +235,72 @@ void FEMBody::newtonRaphsonIterator () {
 	updateFEMValues();
 }
 
+// *****************************************************************************
+///	\brief	Solve the Newton-Raphson system using a banded LU factorisation
+///
+///			The beam elements only couple neighbouring nodes so the system 
+///			matrices are banded. The band of the effective stiffness matrix 
+///			(with BCs removed) is packed into LAPACK band storage and factorised
+///			with dgbtrf. If the band has changed by less than L_FEM_REFACTOR_TOL
+///			(relative Frobenius norm) since the last factorisation then the old
+///			factors are reused and only the triangular solves are performed.
+void FEMBody::solveBanded() {
+
+	// Sizes for the LAPACK band storage
+	int n = systemDOFs - BC_DOFs;
+	int kl = bandWidth;
+	int ku = bandWidth;
+	int ldab = 2 * kl + ku + 1;
+
+	// Allocate on first use
+	if (static_cast<int>(K_ref.size()) != ldab * n) {
+		K_ref.assign(ldab * n, 0.0);
+		K_lu.assign(ldab * n, 0.0);
+		K_piv.assign(n, 0);
+		refactorise = true;
+	}
+
+	// Measure the change in the band since the last factorisation
+	double diffNorm = 0.0, refNorm = 0.0;
+	for (int j = 0; j < n; j++) {
+		for (int i = std::max(0, j - ku); i <= std::min(n - 1, j + kl); i++) {
+			double ref = K_ref[kl + ku + i - j + j * ldab];
+			diffNorm += SQ(K[i + BC_DOFs][j + BC_DOFs] - ref);
+			refNorm += SQ(ref);
+		}
+	}
+
+	// Factorise if forced or the tangent stiffness has changed too much
+	if (refactorise || diffNorm > SQ(L_FEM_REFACTOR_TOL) * refNorm) {
+
+		// Pack the band
+		for (int j = 0; j < n; j++) {
+			for (int i = std::max(0, j - ku); i <= std::min(n - 1, j + kl); i++)
+				K_ref[kl + ku + i - j + j * ldab] = K[i + BC_DOFs][j + BC_DOFs];
+		}
+
+		// Factorise a copy so the reference is kept
+		int info = 0;
+		K_lu = K_ref;
+		dgbtrf_(&n, &n, &kl, &ku, K_lu.data(), &ldab, K_piv.data(), &info);
+		if (info != 0)
+			L_ERROR("Banded LU factorisation of FEM stiffness matrix failed. Exiting.", GridUtils::logfile);
+		refactorise = false;
+	}
+
+	// Solve with the current factors
+	char trans = 'N';
+	int nrhs = 1;
+	int info = 0;
+	delU = F;
+	dgbtrs_(&trans, &n, &kl, &ku, &nrhs, K_lu.data(), &ldab, K_piv.data(), delU.data() + BC_DOFs, &n, &info);
+	if (info != 0)
+		L_ERROR("Banded LU solve of FEM Newton-Raphson system failed. Exiting.", GridUtils::logfile);
+
+	// Set values not included to zero
+	fill(delU.begin(), delU.begin() + BC_DOFs, 0.0);
+}
+
 // *****************************************************************************
 ///	\brief	Check convergence of the Newton-Raphson scheme
 ///
@@ -285,8 +369,8 @@ void FEMBody::setNewmark () {
 		// Effective load
 		F[i] = R[i] - F[i] + MF_hat[i];
 
-		// Effective stiffness
-		for (int j = 0; j < systemDOFs; j++) {
+		// Effective stiffness (matrices are banded)
+		for (int j = std::max(0, i - bandWidth); j <= std::min(systemDOFs - 1, i + bandWidth); j++) {
 			K[i][j] += a0 * M[i][j];
 		}
 	}
@@ -333,6 +417,9 @@ void FEMBody::updateIBMarkers() {
 	std::vector<double> dashUdot;
 	std::vector<std::vector<double>> T(L_DIMS, std::vector<double>(L_DIMS, 0.0));
 
+	// Unrelaxed marker velocities
+	std::vector<double> markerVelNew(IBNodeParents.size() * L_DIMS, 0.0);
+
 	// Loop through all IBM nodes
 	for (size_t node = 0; node < IBNodeParents.size(); node++) {
 
@@ -360,13 +447,73 @@ void FEMBody::updateIBMarkers() {
 		dashU = GridUtils::matrix_multiply(GridUtils::matrix_transpose(T), dashU);
 		dashUdot = GridUtils::vecmultiply(iBodyPtr->_Owner->dt / iBodyPtr->_Owner->dh, GridUtils::matrix_multiply(GridUtils::matrix_transpose(T), dashUdot));
 
-		// Set the IBM node
+		// Set the IBM node position and store the unrelaxed velocity
 		for (int d = 0; d < L_DIMS; d++) {
 			iBodyPtr->markers[node].position[d] = iBodyPtr->markers[node].position0[d] + dashU[d];
+			markerVelNew[node * L_DIMS + d] = dashUdot[d];
+		}
+	}
+
+	// Relax the marker velocities
+	double relax = computeRelaxation(markerVelNew);
+	for (size_t node = 0; node < IBNodeParents.size(); node++) {
+		for (int d = 0; d < L_DIMS; d++) {
 			iBodyPtr->markers[node].markerVel_km1[d] = iBodyPtr->markers[node].markerVel[d];
-			iBodyPtr->markers[node].markerVel[d] = L_RELAX * dashUdot[d] + (1.0 - L_RELAX) * iBodyPtr->markers[node].markerVel_km1[d];
+			iBodyPtr->markers[node].markerVel[d] = relax * markerVelNew[node * L_DIMS + d] + (1.0 - relax) * iBodyPtr->markers[node].markerVel_km1[d];
+		}
+	}
+}
+
+// *****************************************************************************
+///	\brief	Compute the relaxation factor for the FSI coupling
+///
+///			Without L_AITKEN_RELAX the fixed factor L_RELAX is used. Otherwise
+///			L_RELAX is used on the first sub-iteration of a time step and the
+///			factor is then updated with Aitken's delta-squared method using the
+///			residual between the unrelaxed and current marker velocities.
+///
+///	\param	markerVelNew	unrelaxed marker velocities (node-major).
+///	\return	relaxation factor.
+double FEMBody::computeRelaxation(std::vector<double> &markerVelNew) {
+
+#ifdef L_AITKEN_RELAX
+
+	// Residual of this sub-iteration
+	std::vector<double> r(markerVelNew.size());
+	for (size_t node = 0; node < IBNodeParents.size(); node++) {
+		for (int d = 0; d < L_DIMS; d++)
+			r[node * L_DIMS + d] = markerVelNew[node * L_DIMS + d] - iBodyPtr->markers[node].markerVel[d];
+	}
+
+	// Update factor from the change in residual
+	if (subIt > 0 && aitkenRes.size() == r.size()) {
+
+		double num = 0.0, den = 0.0;
+		for (size_t i = 0; i < r.size(); i++) {
+			double dr = r[i] - aitkenRes[i];
+			num += aitkenRes[i] * dr;
+			den += dr * dr;
 		}
+
+		// Keep previous factor if residual has not changed and bound to avoid divergence
+		if (den > L_SMALL_NUMBER * L_SMALL_NUMBER)
+			aitkenOmega = -aitkenOmega * num / den;
+		aitkenOmega = std::max(std::min(aitkenOmega, 1.0), 0.01);
+	}
+	else {
+		aitkenOmega = L_RELAX;
 	}
+
+	// Store residual for next sub-iteration
+	aitkenRes.swap(r);
+	subIt++;
+
+	return aitkenOmega;
+
+#else
+	(void)markerVelNew;		// Only used by Aitken relaxation
+	return L_RELAX;
+#endif
 }
 
 
@@ -49,9 +49,9 @@ GridObj::~GridObj(void)
 ///
 /// \param level always should be zero as top level grid.
 GridObj::GridObj(int level)
-	: t(0), level(level), region_number(0),
-	timeav_mpi_overhead(0.0), timeav_timestep(0.0),
-	refinement_ratio(1.0 / pow(2.0, static_cast<double>(level)))
+	: timeav_samples(0), refinement_ratio(1.0 / pow(2.0, static_cast<double>(level))),
+	region_number(0), level(level), t(0),
+	timeav_mpi_overhead(0.0), timeav_timestep(0.0)
 {
 	// Set limits of refinement to zero as top level
 	for (int i = 0; i < 2; i++) {
@@ -64,6 +64,9 @@ GridObj::GridObj(int level)
 
 	// Call L0 non-MPI initialiser
 	this->LBM_initGrid();
+
+	// Report storage of the per-site fields
+	this->io_memoryReport();
 }
 
 // ****************************************************************************
@@ -76,8 +79,9 @@ GridObj::GridObj(int level)
 ///							this sub-grid belongs.
 /// \param pGrid			pointer to parent grid.
 GridObj::GridObj(int RegionNumber, GridObj& pGrid)
-	: t(0), level(pGrid.level + 1), region_number(RegionNumber),
-	parentGrid(&pGrid), refinement_ratio(1.0 / pow(2.0, static_cast<double>(pGrid.level + 1))),
+	: parentGrid(&pGrid), timeav_samples(0),
+	refinement_ratio(1.0 / pow(2.0, static_cast<double>(pGrid.level + 1))),
+	region_number(RegionNumber), level(pGrid.level + 1), t(0),
 	timeav_mpi_overhead(0.0), timeav_timestep(0.0)
 {	
 	// Notify user that grid constructor has been called
@@ -104,6 +108,7 @@ void GridObj::LBM_addSubGrid(int RegionNumber)
 	
 	// Initialise the subgrid passing position of corner of the refined region on parent grid
 	this->subGrid.back()->LBM_initSubGrid(*this);
+	this->subGrid.back()->io_memoryReport();
 
 #ifndef L_BUILD_FOR_MPI
 	// Update the writable data in the grid manager
@@ -81,6 +81,9 @@ void GridObj::LBM_initVelocity()
 #else    // L_INIT_VELOCITY_FROM_FILE is not defined
 
 	// Loop over grid
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
 	for (int i = 0; i < N_lim; i++) {
 		for (int j = 0; j < M_lim; j++) {
 			for (int k = 0; k < K_lim; k++) {
@@ -139,6 +142,9 @@ void GridObj::LBM_initVelocity()
 void GridObj::LBM_initRho() {
 
 	// Loop over grid
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
 	for (int i = 0; i < N_lim; i++) {
 		for (int j = 0; j < M_lim; j++) {		
 			for (int k = 0; k < K_lim; k++) {
@@ -154,6 +160,9 @@ void GridObj::LBM_initRho() {
 void GridObj::LBM_initTemperature(){
 
 	// Loop over grid
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
 	for (int i = 0; i < N_lim; i++) {
 		for (int j = 0; j < M_lim; j++) {		
 			for (int k = 0; k < K_lim; k++) {
@@ -193,6 +202,24 @@ void GridObj::LBM_initTemperature(){
 	
 }
 
+// ****************************************************************************
+/// \brief	Appends the wall-clock time of an initialisation phase to a log string.
+///
+///			The phase is timed from t_phase, which is then reset to the current 
+///			time so that the next phase starts where this one ended.
+///
+/// \param	phase		name of the phase which has just ended.
+/// \param	phase_times	string to which the phase time is appended.
+/// \param	t_phase		start time of the phase.
+void GridObj::_LBM_initEndPhase(const std::string &phase, std::string &phase_times,
+	std::chrono::steady_clock::time_point &t_phase)
+{
+	std::chrono::steady_clock::time_point t_now = std::chrono::steady_clock::now();
+	phase_times += " " + phase + "=" + 
+		std::to_string(std::chrono::duration<double, std::milli>(t_now - t_phase).count()) + "ms";
+	t_phase = t_now;
+}
+
 // ****************************************************************************
 /// \brief	Method to initialise all L0 lattice quantities.
 void GridObj::LBM_initGrid() {
@@ -201,6 +228,10 @@ void GridObj::LBM_initGrid() {
 	*GridUtils::logfile << "Initialising grid level 0..." << std::endl;
 #endif
 
+	// Wall-clock time of each initialisation phase for the log
+	std::string phase_times;
+	std::chrono::steady_clock::time_point t_phase = std::chrono::steady_clock::now();
+
 	// Get GM instance
 	GridManager *gm = GridManager::getInstance();
 
@@ -299,7 +330,7 @@ void GridObj::LBM_initGrid() {
 	L_INFO(msg, GridUtils::logfile); msg.clear();
 #endif
 #endif
-	
+	_LBM_initEndPhase("positions", phase_times, t_phase);
 
 	// Define TYPING MATRICES
 	LatTyp.resize(N_lim * M_lim * K_lim);
@@ -327,6 +358,7 @@ void GridObj::LBM_initGrid() {
 	//	Add temperature-specific lables
 	LBM_tinitBoundLab();
 #endif
+	_LBM_initEndPhase("labels", phase_times, t_phase);
 
 	// Initialise L0 MACROSCOPIC quantities
 
@@ -334,11 +366,6 @@ void GridObj::LBM_initGrid() {
 	u.resize(N_lim * M_lim * K_lim * L_DIMS);
 	LBM_initVelocity();
 	
-#ifdef L_IBM_ON
-	// Set start-of-timestep-velocity
-	u_n.resize(N_lim * M_lim * K_lim * L_DIMS);
-	u_n = u;
-#endif
 
 	// Density field
 	rho.resize(N_lim * M_lim * K_lim);
@@ -357,6 +384,9 @@ void GridObj::LBM_initGrid() {
 	force_xyz.resize(N_lim * M_lim * K_lim * L_DIMS, 0.0);
 
 	// Initialise with gravity
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
 	for (int id = 0; id < N_lim * M_lim * K_lim; ++id)
 		force_xyz[L_GRAVITY_DIRECTION + id * L_DIMS] = rho[id] * gravity * refinement_ratio;
 
@@ -365,28 +395,37 @@ void GridObj::LBM_initGrid() {
 #endif
 
 	// Time averaged quantities
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
 	rho_timeav.resize(N_lim * M_lim * K_lim, 0.0);
 	ui_timeav.resize(N_lim * M_lim * K_lim * L_DIMS, 0.0);
 	uiuj_timeav.resize(N_lim * M_lim * K_lim * (3 * L_DIMS - 3), 0.0);
 #ifdef L_TEMPERATURE
 	t_timeav.resize(N_lim * M_lim * K_lim, 0.0);						
+#endif
 #endif
 
-	// Initialise L0 POPULATION matrices (f, feq)
+	// Initialise L0 POPULATION matrices (f, fNew)
 	f.resize(N_lim * M_lim * K_lim * L_NUM_VELS);
-	feq.resize(N_lim * M_lim * K_lim * L_NUM_VELS);
 	fNew.resize(N_lim * M_lim * K_lim * L_NUM_VELS);
 
+#ifdef L_SPARSE_STORAGE
+	// Every site owns its slot until the storage is compacted
+	popSlot.resize(N_lim * M_lim * K_lim);
+	for (int id = 0; id < N_lim * M_lim * K_lim; ++id) popSlot[id] = id;
+#endif
+
 #ifdef L_TEMPERATURE
-	// Initialise LO temperature POPULATION matrics(g, geq, gNEW)
+	// Initialise LO temperature POPULATION matrics(g, gNEW)
 	// Current, the speed in temperature field is same as that in density population
 	// can set speed difference in future by using L_TNUM_VELS
 	g.resize(N_lim * M_lim * K_lim * L_NUM_VELS);						
-	geq.resize(N_lim * M_lim * K_lim * L_NUM_VELS);
 	gNew.resize(N_lim * M_lim * K_lim * L_NUM_VELS);
 #endif
 
 	// Loop over grid
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
 	for (int i = 0; i < N_lim; i++)
 	{
 		for (int j = 0; j < M_lim; j++)
@@ -396,7 +435,7 @@ void GridObj::LBM_initGrid() {
 				for (int v = 0; v < L_NUM_VELS; v++)
 				{
 					// Initialise f to feq
-					f(i, j, k, v, M_lim, K_lim, L_NUM_VELS) = 
+					f[v + popOffset(i, j, k)] = 
 						_LBM_equilibrium_opt(k + j * K_lim + i * M_lim * K_lim, v);
 #ifdef L_TEMPERATURE
 					g(i, j, k, v, M_lim, K_lim, L_NUM_VELS) = 
@@ -406,12 +445,14 @@ void GridObj::LBM_initGrid() {
 			}
 		}
 	}
-	feq = f; // Make feq = feq too
+#ifdef L_USE_KBC_COLLISION
+	feq.assign(f.begin(), f.end()); // Only the non-optimised KBC kernel reads feq
+#endif
 	fNew = f;
 #ifdef L_TEMPERATURE
-	geq = g;
 	gNew = g;
 #endif
+	_LBM_initEndPhase("fields", phase_times, t_phase);
 
 // kimematic viscosity nu according defined or interior calculation
 #ifdef L_NU
@@ -469,6 +510,8 @@ void GridObj::LBM_initGrid() {
 	gm->createWritableDataStore(this);
 #endif
 
+	L_INFO("L0 initialisation times:" + phase_times, GridUtils::logfile);
+
 #ifdef L_INIT_VERBOSE
 	L_INFO("Initialisation Complete.", GridUtils::logfile);
 #endif
@@ -485,6 +528,10 @@ void GridObj::LBM_initSubGrid (GridObj& pGrid)
 	*GridUtils::logfile << "Initialising sub-grid level " << level << ", region " << region_number << "..." << std::endl;
 #endif
 
+	// Wall-clock time of each initialisation phase for the log
+	std::string phase_times;
+	std::chrono::steady_clock::time_point t_phase = std::chrono::steady_clock::now();
+
 	// Get GM instance
 	GridManager *gm = GridManager::getInstance();
 	int gm_idx = level + region_number * L_NUM_LEVELS;
@@ -533,22 +580,27 @@ void GridObj::LBM_initSubGrid (GridObj& pGrid)
 #else
 	ZPos.insert( ZPos.begin(), 0.0 ); // 2D default
 #endif
+	_LBM_initEndPhase("positions", phase_times, t_phase);
 
 	
 	// Generate TYPING MATRICES
 	// Resize
 	LatTyp.resize(N_lim * M_lim * K_lim);
-	// Gererate temperature field TYPING MATRICES
-	// Resize
-	LatTTyp.resize(N_lim * M_lim * K_lim);
 
 	// Default labelling of coarse
 	std::fill(LatTyp.begin(), LatTyp.end(), eFluid);
+
+#ifdef L_TEMPERATURE
+	// Gererate temperature field TYPING MATRICES
+	LatTTyp.resize(N_lim * M_lim * K_lim);
+
 	//Default labelling og coarse for temperature field
 	std::fill(LatTTyp.begin(), LatTTyp.end(), eTFluid);
+#endif
 
 	// Call refined labelling routine passing parent grid
 	LBM_initRefinedLab(pGrid);
+	_LBM_initEndPhase("labels", phase_times, t_phase);
 
 	
 	// Assign MACROSCOPIC quantities
@@ -557,19 +609,15 @@ void GridObj::LBM_initSubGrid (GridObj& pGrid)
 	u.resize(N_lim * M_lim * K_lim * L_DIMS);
 	LBM_initVelocity();
 
-	// Set start-of-timestep-velocity
-#ifdef L_IBM_ON
-	u_n.resize(N_lim * M_lim * K_lim * L_DIMS);
-	u_n = u;
-#endif
-
 	// Density
 	rho.resize(N_lim * M_lim * K_lim);
 	LBM_initRho();
 	
+#ifdef L_TEMPERATURE
 	//Temperature
 	T.resize(N_lim * M_lim * K_lim);
 	LBM_initTemperature();
+#endif
 
 
 #if (defined L_GRAVITY_ON || defined L_IBM_ON)
@@ -578,6 +626,9 @@ void GridObj::LBM_initSubGrid (GridObj& pGrid)
 	force_xyz.resize(N_lim * M_lim * K_lim * L_DIMS, 0.0);
 
 	// Initialise with gravity
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
 	for (int id = 0; id < N_lim * M_lim * K_lim; ++id)
 		force_xyz[L_GRAVITY_DIRECTION + id * L_DIMS] = rho[id] * gravity * refinement_ratio;
 
@@ -597,11 +648,17 @@ void GridObj::LBM_initSubGrid (GridObj& pGrid)
 	// Generate POPULATION MATRICES for lower levels
 	// Resize
 	f.resize(N_lim * M_lim * K_lim * L_NUM_VELS);
-	feq.resize(N_lim * M_lim * K_lim * L_NUM_VELS);
 	fNew.resize(N_lim * M_lim * K_lim * L_NUM_VELS);
+#ifdef L_SPARSE_STORAGE
+	popSlot.resize(N_lim * M_lim * K_lim);
+	for (int id = 0; id < N_lim * M_lim * K_lim; ++id) popSlot[id] = id;
+#endif
 
 
 	// Loop over grid
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
 	for (int i = 0; i < N_lim; ++i)
 	{
 		for (int j = 0; j < M_lim; ++j)
@@ -612,15 +669,18 @@ void GridObj::LBM_initSubGrid (GridObj& pGrid)
 				{
 					
 					// Initialise f to feq
-					f(i, j, k, v, M_lim, K_lim, L_NUM_VELS) = 
+					f[v + popOffset(i, j, k)] = 
 						_LBM_equilibrium_opt(k + j * K_lim + i * M_lim * K_lim, v);
 
 				}
 			}
 		}
 	}
-	feq = f; // Set feq to feq
+#ifdef L_USE_KBC_COLLISION
+	feq.assign(f.begin(), f.end()); // Only the non-optimised KBC kernel reads feq
+#endif
 	fNew = f;
+	_LBM_initEndPhase("fields", phase_times, t_phase);
 
 	// Compute relaxation time from coarser level assume refinement by factor of 2
 	omega = 1.0 / ( ( (1.0 / pGrid.omega - 0.5) * 2.0) + 0.5);
@@ -628,6 +688,9 @@ void GridObj::LBM_initSubGrid (GridObj& pGrid)
 	// Lattice viscosity is constant across subgrids
 	nu = pGrid.nu;
 
+	L_INFO("L" + std::to_string(level) + "R" + std::to_string(region_number) + 
+		" initialisation times:" + phase_times, GridUtils::logfile);
+
 #ifdef L_INIT_VERBOSE
 	*GridUtils::logfile << "Initialisation Complete." << std::endl;
 #endif
@@ -1081,20 +1144,20 @@ void GridObj::LBM_initPositionVector(double start_pos, double end_pos, eCartesia
 ///			The virtual wind tunnel definitions are implemented by this method.
 void GridObj::LBM_initBoundLab ( )
 {
-	// Declarations
-	int i, j, k;
-
 #if (L_DIMS == 3)
 
 	// FRONT WALL //
 
-	for (k = 0; k < K_lim; k++)
+	for (int k = 0; k < K_lim; k++)
 	{
 		if (ZPos[k] <= L_WALL_THICKNESS_FRONT)
 		{
-			for (i = 0; i < N_lim; i++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int i = 0; i < N_lim; i++)
 			{
-				for (j = 0; j < M_lim; j++)
+				for (int j = 0; j < M_lim; j++)
 				{
 					LatTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setBCPrecedence(LatTyp(i, j, k, M_lim, K_lim), L_WALL_FRONT);
@@ -1105,13 +1168,16 @@ void GridObj::LBM_initBoundLab ( )
 
 	// BACK WALL //
 
-	for (k = 0; k < K_lim; k++)
+	for (int k = 0; k < K_lim; k++)
 	{
 		if (ZPos[k] >= GridManager::getInstance()->global_edges[eZMax][0] - L_WALL_THICKNESS_BACK)
 		{
-			for (i = 0; i < N_lim; i++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int i = 0; i < N_lim; i++)
 			{
-				for (j = 0; j < M_lim; j++)
+				for (int j = 0; j < M_lim; j++)
 				{
 					LatTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setBCPrecedence(LatTyp(i, j, k, M_lim, K_lim), L_WALL_BACK);
@@ -1123,13 +1189,16 @@ void GridObj::LBM_initBoundLab ( )
 
 	// BOTTOM WALL //
 
-	for (j = 0; j < M_lim; j++)
+	for (int j = 0; j < M_lim; j++)
 	{
 		if (YPos[j] <= L_WALL_THICKNESS_BOTTOM)
 		{
-			for (i = 0; i < N_lim; i++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int i = 0; i < N_lim; i++)
 			{
-				for (k = 0; k < K_lim; k++)
+				for (int k = 0; k < K_lim; k++)
 				{
 					LatTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setBCPrecedence(LatTyp(i, j, k, M_lim, K_lim), L_WALL_BOTTOM);
@@ -1140,13 +1209,16 @@ void GridObj::LBM_initBoundLab ( )
 
 	// TOP WALL //
 
-	for (j = 0; j < M_lim; j++)
+	for (int j = 0; j < M_lim; j++)
 	{
 		if (YPos[j] >= GridManager::getInstance()->global_edges[eYMax][0] - L_WALL_THICKNESS_TOP)
 		{
-			for (i = 0; i < N_lim; i++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int i = 0; i < N_lim; i++)
 			{
-				for (k = 0; k < K_lim; k++)
+				for (int k = 0; k < K_lim; k++)
 				{
 					LatTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setBCPrecedence(LatTyp(i, j, k, M_lim, K_lim), L_WALL_TOP);
@@ -1158,14 +1230,17 @@ void GridObj::LBM_initBoundLab ( )
 	// RIGHT WALL //
 
 	// Search index vector to see if right hand wall on this rank
-	for (i = 0; i < N_lim; i++)
+	for (int i = 0; i < N_lim; i++)
 	{
 		if (XPos[i] >= GridManager::getInstance()->global_edges[eXMax][0] - L_WALL_THICKNESS_RIGHT)
 		{
 			// Label boundary
-			for (j = 0; j < M_lim; j++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int j = 0; j < M_lim; j++)
 			{
-				for (k = 0; k < K_lim; k++)
+				for (int k = 0; k < K_lim; k++)
 				{
 					LatTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setBCPrecedence(LatTyp(i, j, k, M_lim, K_lim), L_WALL_RIGHT);
@@ -1177,15 +1252,18 @@ void GridObj::LBM_initBoundLab ( )
 	// LEFT WALL //
 
 	// Search position vector to see if left hand wall on this rank
-	for (i = 0; i < N_lim; i++)
+	for (int i = 0; i < N_lim; i++)
 	{
 		// Wall found
 		if (XPos[i] <= L_WALL_THICKNESS_LEFT)
 		{
 			// Label boundary
-			for (j = 0; j < M_lim; j++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int j = 0; j < M_lim; j++)
 			{
-				for (k = 0; k < K_lim; k++)
+				for (int k = 0; k < K_lim; k++)
 				{
 					LatTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setBCPrecedence(LatTyp(i, j, k, M_lim, K_lim), L_WALL_LEFT);
@@ -1202,21 +1280,21 @@ void GridObj::LBM_initBoundLab ( )
 ///	
 void GridObj::LBM_tinitBoundLab ( )
 {
-	// Declarations
-	int i, j, k;
-
 	// LEFT WALL //
 
 	// Search position vector to see if left hand wall on this rank
-	for (i = 0; i < N_lim; i++)
+	for (int i = 0; i < N_lim; i++)
 	{
 		// Wall found
 		if (XPos[i] <= L_WALL_THICKNESS_LEFT)
 		{
 			// Label boundary
-			for (j = 0; j < M_lim; j++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int j = 0; j < M_lim; j++)
 			{
-				for (k = 0; k < K_lim; k++)
+				for (int k = 0; k < K_lim; k++)
 				{
 					LatTTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setTBCPrecedence(LatTTyp(i, j, k, M_lim, K_lim), L_TWALL_LEFT);
@@ -1228,14 +1306,17 @@ void GridObj::LBM_tinitBoundLab ( )
 	// RIGHT WALL //
 
 	// Search index vector to see if right hand wall on this rank
-	for (i = 0; i < N_lim; i++)
+	for (int i = 0; i < N_lim; i++)
 	{
 		if (XPos[i] >= GridManager::getInstance()->global_edges[eXMax][0] - L_WALL_THICKNESS_RIGHT)
 		{
 			// Label boundary
-			for (j = 0; j < M_lim; j++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int j = 0; j < M_lim; j++)
 			{
-				for (k = 0; k < K_lim; k++)
+				for (int k = 0; k < K_lim; k++)
 				{
 					LatTTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setTBCPrecedence(LatTTyp(i, j, k, M_lim, K_lim), L_TWALL_RIGHT);
@@ -1248,13 +1329,16 @@ void GridObj::LBM_tinitBoundLab ( )
 
 	// FRONT WALL //
 
-	for (k = 0; k < K_lim; k++)
+	for (int k = 0; k < K_lim; k++)
 	{
 		if (ZPos[k] <= L_WALL_THICKNESS_FRONT)
 		{
-			for (i = 0; i < N_lim; i++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int i = 0; i < N_lim; i++)
 			{
-				for (j = 0; j < M_lim; j++)
+				for (int j = 0; j < M_lim; j++)
 				{
 					LatTTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setTBCPrecedence(LatTTyp(i, j, k, M_lim, K_lim), L_TWALL_FRONT);
@@ -1265,13 +1349,16 @@ void GridObj::LBM_tinitBoundLab ( )
 
 	// BACK WALL //
 
-	for (k = 0; k < K_lim; k++)
+	for (int k = 0; k < K_lim; k++)
 	{
 		if (ZPos[k] >= GridManager::getInstance()->global_edges[eZMax][0] - L_WALL_THICKNESS_BACK)
 		{
-			for (i = 0; i < N_lim; i++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int i = 0; i < N_lim; i++)
 			{
-				for (j = 0; j < M_lim; j++)
+				for (int j = 0; j < M_lim; j++)
 				{
 					LatTTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setTBCPrecedence(LatTTyp(i, j, k, M_lim, K_lim), L_TWALL_BACK);
@@ -1283,13 +1370,16 @@ void GridObj::LBM_tinitBoundLab ( )
 
 	// BOTTOM WALL //
 
-	for (j = 0; j < M_lim; j++)
+	for (int j = 0; j < M_lim; j++)
 	{
 		if (YPos[j] <= L_WALL_THICKNESS_BOTTOM)
 		{
-			for (i = 0; i < N_lim; i++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int i = 0; i < N_lim; i++)
 			{
-				for (k = 0; k < K_lim; k++)
+				for (int k = 0; k < K_lim; k++)
 				{
 					LatTTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setTBCPrecedence(LatTTyp(i, j, k, M_lim, K_lim), L_TWALL_BOTTOM);
@@ -1300,13 +1390,16 @@ void GridObj::LBM_tinitBoundLab ( )
 
 	// TOP WALL //
 
-	for (j = 0; j < M_lim; j++)
+	for (int j = 0; j < M_lim; j++)
 	{
 		if (YPos[j] >= GridManager::getInstance()->global_edges[eYMax][0] - L_WALL_THICKNESS_TOP)
 		{
-			for (i = 0; i < N_lim; i++)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+			for (int i = 0; i < N_lim; i++)
 			{
-				for (k = 0; k < K_lim; k++)
+				for (int k = 0; k < K_lim; k++)
 				{
 					LatTTyp(i, j, k, M_lim, K_lim) = 
 						LBM_setTBCPrecedence(LatTTyp(i, j, k, M_lim, K_lim), L_TWALL_TOP);
@@ -1332,7 +1425,7 @@ void GridObj::LBM_initRefinedLab (GridObj& pGrid) {
 	size_t Kp_lim = pGrid.K_lim;
 	
 	// Declare indices
-	int i, j, k, d;
+	int d;
 
 	// Get edges and indication of TL presence on the refined region from MPIM
 	double edges[6];		// Use eCartMinMax to access
@@ -1345,80 +1438,83 @@ void GridObj::LBM_initRefinedLab (GridObj& pGrid) {
 		TL_present[d] = gm->subgrid_tlayer_key[d][gm_idx - 1];
 	}
 
+	/* Classify each parent index along each axis once: 0 = outside the 
+	 * sub-grid, 1 = inside, 2 = inside and within a cell width of an edge 
+	 * carrying a TL. The 3D labelling then only needs table look-ups. */
+	std::vector<int> clsX(Np_lim), clsY(Mp_lim), clsZ(Kp_lim, 1);
+	for (int i = 0; i < static_cast<int>(Np_lim); ++i)
+		clsX[i] = _LBM_initRefinedClass(pGrid.XPos[i], edges[eXMin], edges[eXMax], 
+			TL_present[eXMin], TL_present[eXMax], pGrid.dh);
+	for (int j = 0; j < static_cast<int>(Mp_lim); ++j)
+		clsY[j] = _LBM_initRefinedClass(pGrid.YPos[j], edges[eYMin], edges[eYMax],
+			TL_present[eYMin], TL_present[eYMax], pGrid.dh);
+#if (L_DIMS == 3)
+	for (int k = 0; k < static_cast<int>(Kp_lim); ++k)
+		clsZ[k] = _LBM_initRefinedClass(pGrid.ZPos[k], edges[eZMin], edges[eZMax],
+			TL_present[eZMin], TL_present[eZMax], pGrid.dh);
+#endif
+
 	// Loop over parent lattice and add "refined" and "TL to lower" labels
-	for (i = 0; i < Np_lim; ++i)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+	for (int i = 0; i < static_cast<int>(Np_lim); ++i)
 	{
-		for (j = 0; j < Mp_lim; ++j)
+		if (clsX[i] == 0) continue;
+		for (int j = 0; j < static_cast<int>(Mp_lim); ++j)
 		{
-			for (k = 0; k < Kp_lim; ++k)
+			if (clsY[j] == 0) continue;
+			for (int k = 0; k < static_cast<int>(Kp_lim); ++k)
 			{
-				// If this parent site is within the bounds of the sub-grid
-				if (
-					pGrid.XPos[i] > edges[eXMin] && pGrid.XPos[i] < edges[eXMax] &&
-					pGrid.YPos[j] > edges[eYMin] && pGrid.YPos[j] < edges[eYMax]
-#if (L_DIMS == 3)
-					&&
-					pGrid.ZPos[k] > edges[eZMin] && pGrid.ZPos[k] < edges[eZMax]
-#endif
-					)
-				{
+				// Skip parent sites outside the bounds of the sub-grid
+				if (clsZ[k] == 0) continue;
 
-					// If within single cell width of sub-grid edge and TL is present then it is TL to lower
-					if (
-						(pGrid.XPos[i] > edges[eXMin] && pGrid.XPos[i] < edges[eXMin] + pGrid.dh && TL_present[eXMin]) ||
-						(pGrid.XPos[i] < edges[eXMax] && pGrid.XPos[i] > edges[eXMax] - pGrid.dh && TL_present[eXMax]) ||
-						(pGrid.YPos[j] > edges[eYMin] && pGrid.YPos[j] < edges[eYMin] + pGrid.dh && TL_present[eYMin]) ||
-						(pGrid.YPos[j] < edges[eYMax] && pGrid.YPos[j] > edges[eYMax] - pGrid.dh && TL_present[eYMax])
-#if (L_DIMS == 3)
-						||
-						(pGrid.ZPos[k] > edges[eZMin] && pGrid.ZPos[k] < edges[eZMin] + pGrid.dh && TL_present[eZMin]) ||
-						(pGrid.ZPos[k] < edges[eZMax] && pGrid.ZPos[k] > edges[eZMax] - pGrid.dh && TL_present[eZMax])
-#endif
-						)
-					{
+				eType &par_label = pGrid.LatTyp(i, j, k, Mp_lim, Kp_lim);
 
-						// If parent site is fluid site then correct label
-						if (pGrid.LatTyp(i, j, k, Mp_lim, Kp_lim) == eFluid) {
-							// Change to "TL to lower" label
-							pGrid.LatTyp(i, j, k, Mp_lim, Kp_lim) = eTransitionToFiner;
-						}
+				// Only fluid sites are relabelled
+				if (par_label != eFluid) continue;
 
-					}
-					else if (pGrid.LatTyp(i, j, k, Mp_lim, Kp_lim) == eFluid) {
-						// Label it a "refined" site
-						pGrid.LatTyp(i, j, k, Mp_lim, Kp_lim) = eRefined;
-					}
+				// If within single cell width of sub-grid edge and TL is present then it is TL to lower
+				if (clsX[i] == 2 || clsY[j] == 2 || clsZ[k] == 2)
+					par_label = eTransitionToFiner;
 
-				}
+				// Else label it a "refined" site
+				else
+					par_label = eRefined;
 			}
 		}
 	}
     
 
 	// Generate grid type matrices for this level //
-
-	// Declare array for parent site indices
-	std::vector<int> p;
-	eType par_label;
     
     // Loop over sub-grid and add labels based on parent site labels
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
     for (int i = 0; i < N_lim; i++) {
+
+		// Parent site indices follow directly from the 2:1 refinement
+		int pi = i / 2 + CoarseLimsX[eMinimum];
+
 		for (int j = 0; j < M_lim; j++) {
+
+			int pj = j / 2 + CoarseLimsY[eMinimum];
+
 #if (L_DIMS == 3)
 			for (int k = 0; k < K_lim; k++)
 #else
 			int k = 0;
 #endif
 			{
-				// Get parent site indices as locals for the current sub-grid local site
-				p = GridUtils::getCoarseIndices(
-					i, CoarseLimsX[eMinimum], 
-					j, CoarseLimsY[eMinimum], 
-					k, CoarseLimsZ[eMinimum]
-				);
+#if (L_DIMS == 3)
+				int pk = k / 2 + CoarseLimsZ[eMinimum];
+#else
+				int pk = 0;
+#endif
 				
 				// Get parent site label using local indices
-				par_label = pGrid.LatTyp(p[eXDirection], p[eYDirection], p[eZDirection], Mp_lim, Kp_lim);
+				eType par_label = pGrid.LatTyp(pi, pj, pk, Mp_lim, Kp_lim);
 								
 				// If parent is a "TL to lower" then add "TL to upper" label
 				if (par_label == eTransitionToFiner)
@@ -1444,6 +1540,83 @@ void GridObj::LBM_initRefinedLab (GridObj& pGrid) {
 
 }
 
+// ****************************************************************************
+/// \brief	Classifies a parent site position against one axis of a sub-grid.
+///
+/// \param	pos		position of the parent site along the axis.
+/// \param	edgeMin	minimum edge of the sub-grid along the axis.
+/// \param	edgeMax	maximum edge of the sub-grid along the axis.
+/// \param	tlMin	whether a TL is present on the minimum edge.
+/// \param	tlMax	whether a TL is present on the maximum edge.
+/// \param	pdh		parent lattice spacing.
+/// \return	0 if outside, 1 if inside, 2 if inside and within the TL band.
+int GridObj::_LBM_initRefinedClass(double pos, double edgeMin, double edgeMax,
+	bool tlMin, bool tlMax, double pdh)
+{
+	if (pos <= edgeMin || pos >= edgeMax) return 0;
+	if ((pos < edgeMin + pdh && tlMin) || (pos > edgeMax - pdh && tlMax)) return 2;
+	return 1;
+}
+
+// ****************************************************************************
+/// \brief	Compacts the population storage of this grid and its sub-grids.
+///
+///			Populations of solid and refined sites are never read by the 
+///			kernel so these sites are all mapped to a shared dummy slot and 
+///			the remaining sites are packed contiguously in their original 
+///			order. Must be called once site labels are final. A grid is only 
+///			compacted when its inactive fraction reaches 
+///			L_SPARSE_MIN_INACTIVE_FRACTION.
+void GridObj::LBM_compactStorage()
+{
+#ifdef L_SPARSE_STORAGE
+	int nSites = N_lim * M_lim * K_lim;
+
+	// Count inactive sites
+	int nInactive = 0;
+	for (int id = 0; id < nSites; ++id)
+	{
+		if (LatTyp[id] == eSolid || LatTyp[id] == eRefined) ++nInactive;
+	}
+
+	if (nSites > 0 && static_cast<double>(nInactive) / nSites >= L_SPARSE_MIN_INACTIVE_FRACTION)
+	{
+		// Slot 0 is the shared dummy slot
+		IVector<int> slots(nSites, 0);
+		IVector<lbm_pop_t> fCompact((nSites - nInactive + 1) * L_NUM_VELS, 0);
+		IVector<lbm_pop_t> fNewCompact((nSites - nInactive + 1) * L_NUM_VELS, 0);
+		int nextSlot = 1;
+
+		// Copy populations of active sites into their new slots
+		for (int id = 0; id < nSites; ++id)
+		{
+			if (LatTyp[id] == eSolid || LatTyp[id] == eRefined) continue;
+
+			slots[id] = nextSlot;
+			for (int v = 0; v < L_NUM_VELS; ++v)
+			{
+				fCompact[v + nextSlot * L_NUM_VELS] = f[v + popOffset(id)];
+				fNewCompact[v + nextSlot * L_NUM_VELS] = fNew[v + popOffset(id)];
+			}
+			++nextSlot;
+		}
+
+		// Replace dense storage
+		f.swap(fCompact);
+		fNew.swap(fNewCompact);
+		popSlot.swap(slots);
+
+		L_INFO("L" + std::to_string(level) + "R" + std::to_string(region_number) +
+			" population storage compacted to " + std::to_string(nSites - nInactive + 1) +
+			" of " + std::to_string(nSites) + " sites.", GridUtils::logfile);
+	}
+#endif
+
+	// Recurse into sub-grids
+	for (size_t reg = 0; reg < subGrid.size(); ++reg)
+		subGrid[reg]->LBM_compactStorage();
+}
+
 // ****************************************************************************
 /// \brief	Method to import an input profile from a file.
 ///
@@ -63,7 +63,7 @@ void GridObj::coupling_addData(std::string name, const std::vector<int>& cellIDs
 #endif
 			for (int v = 0; v < L_NUM_VELS; ++v)
 			{
-				f[v + cellIDs[i] * L_NUM_VELS] =
+				f[v + popOffset(cellIDs[i])] =
 					_LBM_equilibrium_opt(cellIDs[i], v);
 			}
 		}
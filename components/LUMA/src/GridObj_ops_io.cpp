@@ -165,7 +165,7 @@ void GridObj::io_textout(std::string output_tag) {
 					for (size_t i = 0; i < N_lim; i++) {
 
 						// Output
-						gridoutput << f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) << "\t";
+						gridoutput << f[v + popOffset(i, j, k)] << "\t";
 
 					}
 				}
@@ -187,8 +187,8 @@ void GridObj::io_textout(std::string output_tag) {
 					gridoutput << "\n";
 					for (size_t i = 0; i < N_lim; i++) {
 
-						// Output
-						gridoutput << feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) << "\t";
+						// Output (computed on the fly as feq is not stored)
+						gridoutput << _LBM_equilibrium_opt(static_cast<int>(k + j * K_lim + i * K_lim * M_lim), v) << "\t";
 
 					}
 				}
@@ -401,6 +401,12 @@ void GridObj::_io_fgaout(int timeStepL0) {
 ///         - Dimensionless velocity
 ///         - Density in LBM units
 ///         - Time-scaled non equilibrium distribution functions: ((f - f_eq) * omega) / (f_eq*dt)
+///			- Time-averaged quantities (if computed)
+///
+///			When time-averaged quantities are computed, the block of each grid
+///			starts with a header line giving the number of samples they contain.
+///			Files written without them can still be read, the averages then 
+///			start afresh.
 ///
 /// \param IO_flag	flag to indicate whether a write or read
 void GridObj::io_restart(eIOFlag IO_flag) {
@@ -435,6 +441,11 @@ void GridObj::io_restart(eIOFlag IO_flag) {
 		// Counters
 		int i,j,k,v;
 
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
+		// Number of samples in the time-averaged quantities of this grid
+		file << "#TimeAvSamples\t" << level << "\t" << region_number << "\t" << timeav_samples << std::endl;
+#endif
+
 		// Write out global grid indices and then the values of f, u and rho
 		for (k = 0; k < K_lim; k++) {
 			for (j = 0; j < M_lim; j++) {
@@ -463,10 +474,19 @@ void GridObj::io_restart(eIOFlag IO_flag) {
 					// time - scaled fneq values
 					for (v = 0; v < L_NUM_VELS; v++) {
 						double f_eq = _LBM_equilibrium_opt(id, v);
-						double f_neq_restart = ((f(i, j, k, v, M_lim, K_lim, L_NUM_VELS) - f_eq) * omega) / (f_eq*dt);
+						double f_neq_restart = ((f[v + popOffset(i, j, k)] - f_eq) * omega) / (f_eq*dt);
 						file << f_neq_restart << "\t";
 					}
 
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
+					// Time-averaged quantities
+					file << rho_timeav[id] << "\t";
+					for (v = 0; v < L_DIMS; v++)
+						file << ui_timeav[v + id * L_DIMS] << "\t";
+					for (v = 0; v < 3 * L_DIMS - 3; v++)
+						file << uiuj_timeav[v + id * (3 * L_DIMS - 3)] << "\t";
+#endif
+
 					file << std::endl;
 
 				}
@@ -525,9 +545,25 @@ void GridObj::io_restart(eIOFlag IO_flag) {
 
 			// Get line and put in buffer
 			std::getline(file,line_in,'\n');
+			if (line_in.empty()) continue;
 			iss.str(line_in);
+			iss.clear();
 			iss.seekg(0); // Reset buffer position to start of buffer
 
+			// Header line giving the number of time-averaging samples of a grid
+			if (line_in[0] == '#')
+			{
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
+				std::string tag;
+				unsigned long samples;
+				iss >> tag >> in_level >> in_regnum >> samples;
+				GridObj *g = nullptr;
+				GridUtils::getGrid(gm->Grids, in_level, in_regnum, g);
+				if (g && tag == "#TimeAvSamples") g->timeav_samples = samples;
+#endif
+				continue;
+			}
+
 			// Read in level and region
 			iss >> in_level >> in_regnum;
 
@@ -564,10 +600,24 @@ void GridObj::io_restart(eIOFlag IO_flag) {
 				double f_temp;
 				double f_eq = _LBM_equilibrium_opt(id, v);
 				iss >> f_temp;
-				g->f(i, j, k, v, g->M_lim, g->K_lim, L_NUM_VELS) = f_eq*(1 + (g->dt*f_temp) / omega);
-				g->fNew(i, j, k, v, g->M_lim, g->K_lim, L_NUM_VELS) = g->f(i, j, k, v, g->M_lim, g->K_lim, L_NUM_VELS);
+				g->f[v + g->popOffset(i, j, k)] = f_eq*(1 + (g->dt*f_temp) / omega);
+				g->fNew[v + g->popOffset(i, j, k)] = g->f[v + g->popOffset(i, j, k)];
 			}
 
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
+			// Read in time-averaged quantities if the file has them
+			int g_id = k + j * g->K_lim + i * g->K_lim * g->M_lim;
+			double rho_av;
+			if (iss >> rho_av)
+			{
+				g->rho_timeav[g_id] = rho_av;
+				for (v = 0; v < L_DIMS; v++)
+					iss >> g->ui_timeav[v + g_id * L_DIMS];
+				for (v = 0; v < 3 * L_DIMS - 3; v++)
+					iss >> g->uiuj_timeav[v + g_id * (3 * L_DIMS - 3)];
+			}
+#endif
+
 		}
 
 		// Reached end of file so close file
@@ -754,10 +804,10 @@ void GridObj::io_lite(double tval, std::string TAG) {
 
 					// Write out F and Feq
 					for (v = 0; v < L_NUM_VELS; v++) {
-						litefile << f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) << "\t";
+						litefile << f[v + popOffset(i, j, k)] << "\t";
 					}
 					for (v = 0; v < L_NUM_VELS; v++) {
-						litefile << fNew(i,j,k,v,M_lim,K_lim,L_NUM_VELS) << "\t";
+						litefile << fNew[v + popOffset(i, j, k)] << "\t";
 					}
 				
 #ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
@@ -1387,3 +1437,46 @@ int GridObj::io_hdf5(double tval)
 }
 // ***************************************************************************//
 
+
+// ***************************************************************************//
+/// \brief	Per-grid memory report.
+///
+///			Writes the storage held by each per-site field of this grid to the
+///			application log. Fields which are not needed by the current
+///			configuration are not allocated and so report zero.
+void GridObj::io_memoryReport() {
+
+	// Field names and sizes in bytes
+	std::vector<std::string> names;
+	std::vector<size_t> bytes;
+	names.push_back("f");			bytes.push_back(f.capacity() * sizeof(lbm_pop_t));
+	names.push_back("fNew");		bytes.push_back(fNew.capacity() * sizeof(lbm_pop_t));
+	names.push_back("popSlot");		bytes.push_back(popSlot.capacity() * sizeof(int));
+	names.push_back("feq");			bytes.push_back(feq.capacity() * sizeof(double));
+	names.push_back("u");			bytes.push_back(u.capacity() * sizeof(double));
+	names.push_back("u_n");			bytes.push_back(u_n.capacity() * sizeof(double));
+	names.push_back("rho");			bytes.push_back(rho.capacity() * sizeof(double));
+	names.push_back("force_xyz");	bytes.push_back(force_xyz.capacity() * sizeof(double));
+	names.push_back("force_i");		bytes.push_back(force_i.capacity() * sizeof(double));
+	names.push_back("LatTyp");		bytes.push_back(LatTyp.capacity() * sizeof(eType));
+	names.push_back("g");			bytes.push_back(g.capacity() * sizeof(lbm_pop_t));
+	names.push_back("gNew");		bytes.push_back(gNew.capacity() * sizeof(lbm_pop_t));
+	names.push_back("T");			bytes.push_back(T.capacity() * sizeof(double));
+	names.push_back("T_out");		bytes.push_back(T_out.capacity() * sizeof(double));
+	names.push_back("LatTTyp");		bytes.push_back(LatTTyp.capacity() * sizeof(eTType));
+	names.push_back("timeav");		bytes.push_back((rho_timeav.capacity() + ui_timeav.capacity() +
+		uiuj_timeav.capacity() + t_timeav.capacity()) * sizeof(double));
+
+	// Build message listing allocated fields only
+	size_t total = 0;
+	std::string msg;
+	for (size_t n = 0; n < names.size(); n++) {
+		if (bytes[n] == 0) continue;
+		total += bytes[n];
+		msg += " " + names[n] + "=" + std::to_string(bytes[n] / (1024 * 1024)) + "MB";
+	}
+
+	L_INFO("L" + std::to_string(level) + "R" + std::to_string(region_number) +
+		" per-site storage " + std::to_string(total / (1024 * 1024)) + "MB:" + msg, GridUtils::logfile);
+}
+// ***************************************************************************//
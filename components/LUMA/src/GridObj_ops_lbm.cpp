@@ -41,7 +41,7 @@ using namespace std;
 /// \param j		j-index of lattice site.
 /// \param k		k-index of lattice site.
 /// \param f_new	reference to the temporary, post-collision grid.
-void GridObj::LBM_kbcCollide( int i, int j, int k, IVector<double>& f_new ) {
+void GridObj::LBM_kbcCollide( int i, int j, int k, IVector<lbm_pop_t>& f_new ) {
 	
 	// Declarations
 	double ds[L_NUM_VELS], dh[L_NUM_VELS], gamma;
@@ -74,19 +74,19 @@ void GridObj::LBM_kbcCollide( int i, int j, int k, IVector<double>& f_new ) {
 		feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = _LBM_equilibrium_opt(k + j * K_lim + i * K_lim * M_lim, v);
 
 		// These are actually rho * MXXX but no point in dividing to multiply later
-		M200 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[0][v]);
-		M020 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[1][v] * c[1][v]);
-		M002 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[2][v] * c[2][v]);
-		M110 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[1][v]);
-		M101 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[2][v]);
-		M011 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[1][v] * c[2][v]);
-		M111 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[1][v] * c[2][v]);
-		M102 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[2][v] * c[2][v]);
-		M210 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[0][v] * c[1][v]);
-		M021 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[1][v] * c[1][v] * c[2][v]);
-		M201 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[0][v] * c[2][v]);
-		M120 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[1][v] * c[1][v]);
-		M012 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[1][v] * c[2][v] * c[2][v]);
+		M200 += f[v + popOffset(i, j, k)] * (c[0][v] * c[0][v]);
+		M020 += f[v + popOffset(i, j, k)] * (c[1][v] * c[1][v]);
+		M002 += f[v + popOffset(i, j, k)] * (c[2][v] * c[2][v]);
+		M110 += f[v + popOffset(i, j, k)] * (c[0][v] * c[1][v]);
+		M101 += f[v + popOffset(i, j, k)] * (c[0][v] * c[2][v]);
+		M011 += f[v + popOffset(i, j, k)] * (c[1][v] * c[2][v]);
+		M111 += f[v + popOffset(i, j, k)] * (c[0][v] * c[1][v] * c[2][v]);
+		M102 += f[v + popOffset(i, j, k)] * (c[0][v] * c[2][v] * c[2][v]);
+		M210 += f[v + popOffset(i, j, k)] * (c[0][v] * c[0][v] * c[1][v]);
+		M021 += f[v + popOffset(i, j, k)] * (c[1][v] * c[1][v] * c[2][v]);
+		M201 += f[v + popOffset(i, j, k)] * (c[0][v] * c[0][v] * c[2][v]);
+		M120 += f[v + popOffset(i, j, k)] * (c[0][v] * c[1][v] * c[1][v]);
+		M012 += f[v + popOffset(i, j, k)] * (c[1][v] * c[2][v] * c[2][v]);
 
 		M200eq += feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[0][v]);
 		M020eq += feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[1][v] * c[1][v]);
@@ -159,7 +159,7 @@ void GridObj::LBM_kbcCollide( int i, int j, int k, IVector<double>& f_new ) {
 
 
 		// Compute dh
-		dh[v] = f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) - feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) - ds[v];
+		dh[v] = f[v + popOffset(i, j, k)] - feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) - ds[v];
 
 	}
 
@@ -178,9 +178,9 @@ void GridObj::LBM_kbcCollide( int i, int j, int k, IVector<double>& f_new ) {
 		feq(i, j, k, v, M_lim, K_lim, L_NUM_VELS) = _LBM_equilibrium_opt(k + j * K_lim + i * M_lim * K_lim, v);
 		
 		// These are actually rho * MXX but no point in dividing to multiply later
-		M20 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[0][v]);
-		M02 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[1][v] * c[1][v]);
-		M11 += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[1][v]);
+		M20 += f[v + popOffset(i, j, k)] * (c[0][v] * c[0][v]);
+		M02 += f[v + popOffset(i, j, k)] * (c[1][v] * c[1][v]);
+		M11 += f[v + popOffset(i, j, k)] * (c[0][v] * c[1][v]);
 
 		M20eq += feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[0][v] * c[0][v]);
 		M02eq += feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) * (c[1][v] * c[1][v]);
@@ -218,7 +218,7 @@ void GridObj::LBM_kbcCollide( int i, int j, int k, IVector<double>& f_new ) {
 
 
 		// Compute dh
-		dh[v] = f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) - feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) - ds[v];
+		dh[v] = f[v + popOffset(i, j, k)] - feq(i,j,k,v,M_lim,K_lim,L_NUM_VELS) - ds[v];
 
 	}
 
@@ -243,7 +243,7 @@ void GridObj::LBM_kbcCollide( int i, int j, int k, IVector<double>& f_new ) {
 
 		// Perform collision
 		f_new(i, j, k, v, M_lim, K_lim, L_NUM_VELS) =
-			f(i, j, k, v, M_lim, K_lim, L_NUM_VELS) -
+			f[v + popOffset(i, j, k)] -
 			(omega / 2) * (2 * ds[v] + gamma * dh[v])
 
 #if (defined L_GRAVITY_ON || defined L_IBM_ON)
@@ -313,12 +313,12 @@ void GridObj::LBM_macro( int i, int j, int k ) {
 		for (int v = 0; v < L_NUM_VELS; v++) {
 
 			// Sum up to find mass flux
-			fux_temp += (double)c[0][v] * f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
-			fuy_temp += (double)c[1][v] * f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
-			fuz_temp += (double)c[2][v] * f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+			fux_temp += (double)c[0][v] * f[v + popOffset(i, j, k)];
+			fuy_temp += (double)c[1][v] * f[v + popOffset(i, j, k)];
+			fuz_temp += (double)c[2][v] * f[v + popOffset(i, j, k)];
 
 			// Sum up to find density
-			rho_temp += f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+			rho_temp += f[v + popOffset(i, j, k)];
 
 		}
 
@@ -70,6 +70,10 @@ void GridObj::LBM_multi_opt(int subcycle)
 #ifdef L_LD_OUT
 	// Reset object forces for momentum exchange force calculation
 	objman->resetMomexBodyForces(this);
+#ifndef L_MOMEX_DEBUG
+	// Compute lift and drag from the fluid-body links before f is overwritten
+	objman->computeLiftDrag(this);
+#endif
 #endif
 
 	// Loop over grid
@@ -92,7 +96,7 @@ void GridObj::LBM_multi_opt(int subcycle)
 #endif
 
 				// MOMENTUM EXCHANGE //
-#ifdef L_LD_OUT
+#if (defined L_LD_OUT && defined L_MOMEX_DEBUG)
 				if (type_local == eSolid)
 				{
 					// Compute lift and drag contribution of this site
@@ -132,7 +136,13 @@ void GridObj::LBM_multi_opt(int subcycle)
 
 	// Set post-LBM macros
 	if (objman->hasFlexibleBodies[level])
+	{
+#ifdef L_IBM_SUBIT_SUPPORT_ONLY
+		objman->ibm_saveSupportVelocities(this, true);
+#else
 		u_n = u;
+#endif
+	}
 
 	// Perform IBM steps (interpolate, force calc, spread and update macro)
 	if (objman->hasIBMBodies[level])
@@ -179,6 +189,12 @@ void GridObj::LBM_multi_opt(int subcycle)
 		}
 	}
 
+	// TIME-AVERAGED QUANTITIES //
+#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
+	if (t >= L_TIME_AVERAGE_OFFSET && (t - L_TIME_AVERAGE_OFFSET) % L_TIME_AVERAGE_STRIDE == 0)
+		_LBM_timeAverage_opt();
+#endif
+
 	// Swap distributions
 	f.swap(fNew);	// Density field swap distribution
 	g.swap(gNew);	// Temperature field swap distribution
@@ -255,15 +271,15 @@ void GridObj::_LBM_stream_opt(int i, int j, int k, int id, eType type_local, int
 		if (src_type_local == eSolid)
 		{
 			// F value is its opposite (HWBB)
-			fNew[v + id * L_NUM_VELS] =
-				f[GridUtils::getOpposite(v) + id * L_NUM_VELS];
+			fNew[v + popOffset(id)] =
+				f[GridUtils::getOpposite(v) + popOffset(id)];
 		}
 		// EXTRAPOLATERIGHT
 		else if (src_type_local == eExtrapolateRight)
 		{
 			// F value is 2 to the left of the src site
-			fNew[v + id * L_NUM_VELS] =
-				f[v + (src_id - 2 * (K_lim * M_lim)) * L_NUM_VELS];
+			fNew[v + popOffset(id)] =
+				f[v + popOffset(src_id - 2 * (K_lim * M_lim))];
 		}
 
 		// VELOCITY BC (forced equilbirium)
@@ -281,7 +297,7 @@ void GridObj::_LBM_stream_opt(int i, int j, int k, int id, eType type_local, int
 
 #endif
 			// Set f to equilibrium (forced equilibrium BC)
-			fNew[v + id * L_NUM_VELS] = _LBM_equilibrium_opt(src_id, v);
+			fNew[v + popOffset(id)] = _LBM_equilibrium_opt(src_id, v);
 		}
 #endif
 
@@ -305,7 +321,7 @@ void GridObj::_LBM_stream_opt(int i, int j, int k, int id, eType type_local, int
 		else
 		{
 			// Pull population from source site
-			fNew[v + id * L_NUM_VELS] = f[v + src_id * L_NUM_VELS];
+			fNew[v + popOffset(id)] = f[v + popOffset(src_id)];
 		}
 
 	}
@@ -650,13 +666,13 @@ void GridObj::_LBM_regularised_opt(int i, int j, int k, int id, eType type, int
 			if (c_opt[v][normalDirection] == -normalVector[normalDirection])
 			{
 				// Add to known momentum leaving the domain
-				f_plus += fNew[v + id * L_NUM_VELS];
+				f_plus += fNew[v + popOffset(id)];
 
 			}
 			// If it is perpendicular to wall part of f_zero
 			else if (c_opt[v][normalDirection] == 0)
 			{
-				f_zero += fNew[v + id * L_NUM_VELS];
+				f_zero += fNew[v + popOffset(id)];
 			}
 		}
 
@@ -711,8 +727,8 @@ void GridObj::_LBM_regularised_opt(int i, int j, int k, int id, eType type, int
 		// Unknowns for a normal case share the normal vector components
 		if (edgeCount == 1 && c_opt[v][normalDirection] == normalVector[normalDirection])
 		{
-			fNew[v + id * L_NUM_VELS] = _LBM_equilibrium_opt(id, v) +
-				(fNew[GridUtils::getOpposite(v) + id * L_NUM_VELS] - _LBM_equilibrium_opt(id, GridUtils::getOpposite(v)));
+			fNew[v + popOffset(id)] = _LBM_equilibrium_opt(id, v) +
+				(fNew[GridUtils::getOpposite(v) + popOffset(id)] - _LBM_equilibrium_opt(id, GridUtils::getOpposite(v)));
 		}
 
 		// Unknown in edge cases are ones who share at least one of the normal components
@@ -738,18 +754,18 @@ void GridObj::_LBM_regularised_opt(int i, int j, int k, int id, eType type, int
 			// If a buried link then set to feq (plane with normal parallel to normal of boundary)
 			if (dp == 0 && mag > 1.0)
 			{
-				fNew[v + id * L_NUM_VELS] = _LBM_equilibrium_opt(id, v);
+				fNew[v + popOffset(id)] = _LBM_equilibrium_opt(id, v);
 			}
 			// Else apply non-equilbrium bounceback
 			else
 			{
-				fNew[v + id * L_NUM_VELS] = _LBM_equilibrium_opt(id, v) +
-					(fNew[GridUtils::getOpposite(v) + id * L_NUM_VELS] - _LBM_equilibrium_opt(id, GridUtils::getOpposite(v)));
+				fNew[v + popOffset(id)] = _LBM_equilibrium_opt(id, v) +
+					(fNew[GridUtils::getOpposite(v) + popOffset(id)] - _LBM_equilibrium_opt(id, GridUtils::getOpposite(v)));
 			}
 		}
 
 		// Store off-equilibrium and update stress components
-		fneq = fNew[v + id * L_NUM_VELS] - _LBM_equilibrium_opt(id, v);
+		fneq = fNew[v + popOffset(id)] - _LBM_equilibrium_opt(id, v);
 
 		// Compute off-equilibrium stress components
 		Sxx += c_opt[v][eXDirection] * c_opt[v][eXDirection] * fneq;
@@ -766,7 +782,7 @@ void GridObj::_LBM_regularised_opt(int i, int j, int k, int id, eType type, int
 	// Compute regularised non-equilibrium components and add to feq to get new populations
 	for (int v = 0; v < L_NUM_VELS; v++)
 	{
-		fNew[v + id * L_NUM_VELS] = _LBM_equilibrium_opt(id, v) +
+		fNew[v + popOffset(id)] = _LBM_equilibrium_opt(id, v) +
 			(w[v] / (2.0 * SQ(cs) * SQ(cs))) *
 			(
 			((c_opt[v][eXDirection] * c_opt[v][eXDirection] - SQ(cs)) * Sxx) +
@@ -805,42 +821,42 @@ bool GridObj::_LBM_applySpecReflect_opt(int i, int j, int k, int id, int v)
 		// Left slip
 		if (normVec[eXDirection] == 1 && c_opt[v][eXDirection] == 1)
 		{
-			fNew[v + id * L_NUM_VELS] = f[GridUtils::getReflect(v, eXDirection) + id * L_NUM_VELS];
+			fNew[v + popOffset(id)] = f[GridUtils::getReflect(v, eXDirection) + popOffset(id)];
 			return true;
 		}
 
 		// Right slip
 		if (normVec[eXDirection] == -1 && c_opt[v][eXDirection] == -1)
 		{
-			fNew[v + id * L_NUM_VELS] = f[GridUtils::getReflect(v, eXDirection) + id * L_NUM_VELS];
+			fNew[v + popOffset(id)] = f[GridUtils::getReflect(v, eXDirection) + popOffset(id)];
 			return true;
 		}
 
 		// Bottom slip
 		if (normVec[eYDirection] == 1 && c_opt[v][eYDirection] == 1)
 		{
-			fNew[v + id * L_NUM_VELS] = f[GridUtils::getReflect(v, eYDirection) + id * L_NUM_VELS];
+			fNew[v + popOffset(id)] = f[GridUtils::getReflect(v, eYDirection) + popOffset(id)];
 			return true;
 		}
 
 		// Top slip
 		if (normVec[eYDirection] == -1 && c_opt[v][eYDirection] == -1)
 		{
-			fNew[v + id * L_NUM_VELS] = f[GridUtils::getReflect(v, eYDirection) + id * L_NUM_VELS];
+			fNew[v + popOffset(id)] = f[GridUtils::getReflect(v, eYDirection) + popOffset(id)];
 			return true;
 		}
 
 		// Front slip
 		if (normVec[eZDirection] == 1 && c_opt[v][eZDirection] == 1)
 		{
-			fNew[v + id * L_NUM_VELS] = f[GridUtils::getReflect(v, eZDirection) + id * L_NUM_VELS];
+			fNew[v + popOffset(id)] = f[GridUtils::getReflect(v, eZDirection) + popOffset(id)];
 			return true;
 		}
 
 		// Back slip
 		if (normVec[eZDirection] == -1 && c_opt[v][eZDirection] == -1)
 		{
-			fNew[v + id * L_NUM_VELS] = f[GridUtils::getReflect(v, eZDirection) + id * L_NUM_VELS];
+			fNew[v + popOffset(id)] = f[GridUtils::getReflect(v, eZDirection) + popOffset(id)];
 			return true;
 		}
 
@@ -887,10 +903,10 @@ void GridObj::_LBM_coalesce_opt(int i, int j, int k, int id, int v) {
 #endif
 			{
 				fNew_local +=
-					childGrid->f[v +
-					(cInd[2] + kk) * L_NUM_VELS +
-					(cInd[1] + jj) * L_NUM_VELS * cK_lim +
-					(cInd[0] + ii) * L_NUM_VELS * cK_lim * cM_lim];
+					childGrid->f[v + childGrid->popOffset(
+					(cInd[2] + kk) +
+					(cInd[1] + jj) * cK_lim +
+					(cInd[0] + ii) * cK_lim * cM_lim)];
 			}
 		}
 	}
@@ -902,7 +918,7 @@ void GridObj::_LBM_coalesce_opt(int i, int j, int k, int id, int v) {
 #endif
 
 	// Store back in memory
-	fNew[v + id * L_NUM_VELS] = fNew_local;
+	fNew[v + popOffset(id)] = fNew_local;
 
 }
 
@@ -924,12 +940,9 @@ void GridObj::_LBM_explode_opt(int id, int v, int src_x, int src_y, int src_z) {
 		src_z, CoarseLimsZ[eMinimum]);
 
 	// Pull value from parent
-	fNew[v + id * L_NUM_VELS] =
+	fNew[v + popOffset(id)] =
 		parentGrid->f[
-			v +
-				pInd[2] * L_NUM_VELS +
-				pInd[1] * L_NUM_VELS * parentGrid->K_lim +
-				pInd[0] * L_NUM_VELS * parentGrid->K_lim * parentGrid->M_lim
+			v + parentGrid->popOffset(pInd[0], pInd[1], pInd[2])
 		];
 }
 
@@ -1038,7 +1051,7 @@ double GridObj::_LBM_smag(int id, double omega)
  
 	// Compute non-equilibrium values
 	for (int v = 0; v < L_NUM_VELS; ++v)
-		fneq[v] = fNew[v + id*L_NUM_VELS] - _LBM_equilibrium_opt(id, v);
+		fneq[v] = fNew[v + popOffset(id)] - _LBM_equilibrium_opt(id, v);
 
 	// Calculate diagonal and upper diagonal of the non equilibrium stress tensor
 	for (int i = 0; i < L_DIMS; ++i)
@@ -1091,10 +1104,10 @@ void GridObj::_LBM_collide_opt(int id)
 	// Perform collision operation (using omega_s -- modified if using Smagorinksy)
 	for (int v = 0; v < L_NUM_VELS; ++v)
 	{
-		fNew[v + id * L_NUM_VELS] +=
+		fNew[v + popOffset(id)] +=
 			omega_s *	(
 			_LBM_equilibrium_opt(id, v) -
-			fNew[v + id * L_NUM_VELS]
+			fNew[v + popOffset(id)]
 			)
 
 #if (defined L_GRAVITY_ON || defined L_IBM_ON)
@@ -1161,11 +1174,11 @@ void GridObj::_LBM_macro_opt(int i, int j, int k, int id, eType type_local) {
 		// Sum to find rho and momentum
 		for (int v = 0; v < L_NUM_VELS; ++v)
 		{
-			rho_temp += fNew[v + id * L_NUM_VELS];
-			rhouX_temp += c_opt[v][0] * fNew[v + id * L_NUM_VELS];
-			rhouY_temp += c_opt[v][1] * fNew[v + id * L_NUM_VELS];
+			rho_temp += fNew[v + popOffset(id)];
+			rhouX_temp += c_opt[v][0] * fNew[v + popOffset(id)];
+			rhouY_temp += c_opt[v][1] * fNew[v + popOffset(id)];
 #if (L_DIMS == 3)
-			rhouZ_temp += c_opt[v][2] * fNew[v + id * L_NUM_VELS];
+			rhouZ_temp += c_opt[v][2] * fNew[v + popOffset(id)];
 #endif
 		}
 
@@ -1234,32 +1247,6 @@ void GridObj::_LBM_macro_opt(int i, int j, int k, int id, eType type_local) {
 		}
 	}
 
-	// TIME-AVERAGED QUANTITIES //
-
-#ifdef L_COMPUTE_TIME_AVERAGED_QUANTITIES
-	// Multiply current value by completed time steps to get sum
-	double ta_temp = rho_timeav[id] * (double)t;
-	// Add new value
-	ta_temp += rho[id];
-	// Divide by completed time steps + 1 to get new average
-	rho_timeav[id] = ta_temp / (double)(t + 1);
-
-	// Repeat for other quantities
-	int pq_combo = 0;
-	for (int p = 0; p < L_DIMS; p++) {
-		ta_temp = ui_timeav[p + id * L_DIMS] * (double)t;
-		ta_temp += u[p + id * L_DIMS];
-		ui_timeav[p + id * L_DIMS] = ta_temp / (double)(t + 1);
-		// Do necessary products
-		for (int q = p; q < L_DIMS; q++) {
-			ta_temp = uiuj_timeav[pq_combo + id * (3 * L_DIMS - 3)] * (double)t;
-			ta_temp += (u[p + id * L_DIMS] * u[q + id * L_DIMS]);
-			uiuj_timeav[pq_combo + id * (3 * L_DIMS - 3)] = ta_temp / (double)(t + 1);
-			pq_combo++;
-		}
-	}
-#endif
-
 }
 
 /// The below temperature can be put in _LBM_macro_opt in future 
@@ -1469,10 +1456,10 @@ bool GridObj::_LBM_applyBFL_opt(int id, int src_id, int v, int i, int j, int k,
 			stencil_k >= 0 && stencil_k < K_lim)
 		{
 			// Interpolate pre-stream value then perform bounceback stream
-			fNew[v + id * L_NUM_VELS] =
+			fNew[v + popOffset(id)] =
 				(1 - 2 * q_link) *
-				(f[GridUtils::getOpposite(v) + stencil_id * L_NUM_VELS] - f[GridUtils::getOpposite(v) + id * L_NUM_VELS])
-				+ f[GridUtils::getOpposite(v) + id * L_NUM_VELS];
+				(f[GridUtils::getOpposite(v) + popOffset(stencil_id)] - f[GridUtils::getOpposite(v) + popOffset(id)])
+				+ f[GridUtils::getOpposite(v) + popOffset(id)];
 
 			// Momentum exchange -- don't include forces computed on halo sites to avoid duplicates
 #ifdef L_LD_OUT
@@ -1488,10 +1475,10 @@ bool GridObj::_LBM_applyBFL_opt(int id, int src_id, int v, int i, int j, int k,
 		/* Wall must be nearer the source site than the current site. We can 
 		 * compute bounced value at current site from post-stream interpolated
 		 * values pointing away from the wall. */
-		fNew[v + id * L_NUM_VELS] =
+		fNew[v + popOffset(id)] =
 			(1 - 2 * q_link) *
-			((f[v + id * L_NUM_VELS] - f[GridUtils::getOpposite(v) + id * L_NUM_VELS]) / (2 - 2 * q_link))
-			+ f[GridUtils::getOpposite(v) + id * L_NUM_VELS];
+			((f[v + popOffset(id)] - f[GridUtils::getOpposite(v) + popOffset(id)]) / (2 - 2 * q_link))
+			+ f[GridUtils::getOpposite(v) + popOffset(id)];
 
 		// Momentum exchange -- don't include forces computed on halo sites to avoid duplicates
 #ifdef L_LD_OUT
@@ -1504,173 +1491,145 @@ bool GridObj::_LBM_applyBFL_opt(int id, int src_id, int v, int i, int j, int k,
 
 }
 
+#ifdef L_USE_KBC_COLLISION
+/* Tables for the optimised KBC kernel which depend on the ordering of c_opt 
+ * in stdafx.cpp. cKbcMoments holds the velocity products making up each of 
+ * the non-equilibrium moments used by the model (same ordering as the 
+ * unoptimised kernel) and cKbcShear the weight of each moment in the shear 
+ * part of each population for the KBC-N4 (3D) and KBC-D (2D) models. */
+#if (L_DIMS == 3)
+
+const static int cKbcNumMoments = 13;	///< Number of moments used by the KBC-N4 model
+
+const static double cKbcMoments[cKbcNumMoments][L_NUM_VELS] =
+{
+	{ 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0 },	// xx
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1, 1, 0 },	// xxy
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 1, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1, 0 },	// xxz
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, -1, 1, 1, 1, 1, -1, -1, -1, -1, 0 },	// xy
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, -1, 1, -1, 1, 1, -1, 0 },	// xyy
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, -1, 1, -1, 1, 0 },	// xyz
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, -1, 0, 0, 0, 0, 1, 1, -1, -1, -1, -1, 1, 1, 0 },	// xz
+	{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, 0, 0, 0, 0, 1, -1, -1, 1, -1, 1, 1, -1, 0 },	// xzz
+	{ 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0 },	// yy
+	{ 0, 0, 0, 0, 0, 0, 1, -1, -1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1, 0 },	// yyz
+	{ 0, 0, 0, 0, 0, 0, 1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, -1, 1, 1, -1, -1, 0 },	// yz
+	{ 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, -1, 1, 1, -1, -1, 1, 0 },	// yzz
+	{ 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0 }	// zz
+};
+
+const static double cKbcShear[L_NUM_VELS][cKbcNumMoments] =
+{
+	{ 0.5, 0.0, 0.0, 0.0, -0.5, 0.0, 0.0, -0.5, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 0
+	{ 0.5, 0.0, 0.0, 0.0, 0.5, 0.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 1
+	{ 0.0, -0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5, 0.0, 0.0, -0.5, 0.0 },	// 2
+	{ 0.0, 0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5, 0.0, 0.0, 0.5, 0.0 },	// 3
+	{ 0.0, 0.0, -0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.5, 0.0, 0.0, 0.5 },	// 4
+	{ 0.0, 0.0, 0.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.5, 0.0, 0.0, 0.5 },	// 5
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.25, 0.25, 0.25, 0.0 },	// 6
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.25, 0.25, -0.25, 0.0 },	// 7
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -0.25, -0.25, 0.25, 0.0 },	// 8
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.25, -0.25, -0.25, 0.0 },	// 9
+	{ 0.0, 0.0, 0.25, 0.0, 0.0, 0.0, 0.25, 0.25, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 10
+	{ 0.0, 0.0, -0.25, 0.0, 0.0, 0.0, 0.25, -0.25, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 11
+	{ 0.0, 0.0, -0.25, 0.0, 0.0, 0.0, -0.25, 0.25, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 12
+	{ 0.0, 0.0, 0.25, 0.0, 0.0, 0.0, -0.25, -0.25, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 13
+	{ 0.0, 0.25, 0.0, 0.25, 0.25, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 14
+	{ 0.0, -0.25, 0.0, 0.25, -0.25, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 15
+	{ 0.0, -0.25, 0.0, -0.25, 0.25, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 16
+	{ 0.0, 0.25, 0.0, -0.25, -0.25, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 17
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.125, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 18
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, -0.125, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 19
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.125, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 20
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, -0.125, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 21
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, -0.125, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 22
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.125, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 23
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, -0.125, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 24
+	{ 0.0, 0.0, 0.0, 0.0, 0.0, 0.125, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },	// 25
+	{ -1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -1.0, 0.0, 0.0, 0.0, -1.0 }	// 26
+};
+
+#else
+
+const static int cKbcNumMoments = 3;	///< Number of moments used by the KBC-D model
+
+const static double cKbcMoments[cKbcNumMoments][L_NUM_VELS] =
+{
+	{ 1, 1, 0, 0, 1, 1, 1, 1, 0 },	// xx
+	{ 0, 0, 0, 0, 1, 1, -1, -1, 0 },	// xy
+	{ 0, 0, 1, 1, 1, 1, 1, 1, 0 }	// yy
+};
+
+const static double cKbcShear[L_NUM_VELS][cKbcNumMoments] =
+{
+	{ 0.25, 0.0, -0.25 },	// 0
+	{ 0.25, 0.0, -0.25 },	// 1
+	{ -0.25, 0.0, 0.25 },	// 2
+	{ -0.25, 0.0, 0.25 },	// 3
+	{ 0.0, 0.25, 0.0 },	// 4
+	{ 0.0, 0.25, 0.0 },	// 5
+	{ 0.0, -0.25, 0.0 },	// 6
+	{ 0.0, -0.25, 0.0 },	// 7
+	{ 0.0, 0.0, 0.0 }	// 8
+};
+
+#endif
+
 // *****************************************************************************
 /// \brief	Optimised KBC collision operator.
 ///
 ///			Applies KBC collision operator using the KBC-N4 and KBC-D models in 
-///			3D and 2D, respectively.
+///			3D and 2D, respectively. The moments and shear parts are computed 
+///			from constant tables using fixed-length loops and stack storage so 
+///			the equilibrium is not written back to the grid.
 ///
 /// \param id		flattened index of the lattice site.
 void GridObj::_LBM_kbcCollide_opt(int id)
 {
 
 	// Declarations
+	double feq_loc[L_NUM_VELS];
+	double fneq[L_NUM_VELS];
 	double ds[L_NUM_VELS];
 	double dh[L_NUM_VELS];
-	double fneq[L_NUM_VELS];
+	double Mneq[cKbcNumMoments] = { 0.0 };
 	double gamma;
-	std::vector<double> Mneq;
-	std::vector<int> C;
-
-	// Compute required moments and equilibrium moments //
-#if (L_DIMS == 3)
-	int numMoments = 13;
-#else
-	int numMoments = 3;
-#endif
-	Mneq.resize(numMoments, 0.0);
-	C.resize(numMoments * L_NUM_VELS, 1);
+	const lbm_pop_t *f_loc = &f[popOffset(id)];
 
+	// Compute equilibrium and non-equilibrium parts
 	for (int v = 0; v < L_NUM_VELS; v++)
 	{
-
-		// Update feq and store fneq
-		feq[v + id * L_NUM_VELS] = _LBM_equilibrium_opt(id, v);
-		fneq[v] = f[v + id * L_NUM_VELS] - feq[v + id * L_NUM_VELS];
-
-		// 2-index and 3-index non-equilibrium moments
-		int idx = 0;
-		for (int sig = 0; sig < L_DIMS; ++sig)
-		{
-			for (int gam = sig; gam < L_DIMS; ++gam)
-			{
-				C[idx + v * numMoments] = c_opt[v][sig] * c_opt[v][gam];
-				Mneq[idx] += fneq[v] * C[idx + v * numMoments];
-				idx++;
-
-#if (L_DIMS == 3)
-				// Only need this inner loop for 3D moments
-				for (int del = gam; del < L_DIMS; ++del)
-				{
-					// Don't include if all the same index
-					if (sig != gam || gam != del || sig != del)
-					{
-						C[idx + v * numMoments] = c_opt[v][sig] * c_opt[v][gam] * c_opt[v][del];
-						Mneq[idx] += fneq[v] * C[idx + v * numMoments];
-						idx++;
-					}
-				}
-#endif
-			}
-		}		
+		feq_loc[v] = _LBM_equilibrium_opt(id, v);
+		fneq[v] = f_loc[v] - feq_loc[v];
 	}
 
-	// Compute ds
-	for (int v = 0; v < L_NUM_VELS; v++)
+	// Compute required non-equilibrium moments
+	for (int m = 0; m < cKbcNumMoments; m++)
 	{
-		/* s part dictated by KBC model choice and directions.
-		 * These are different in 2D and 3D so compile different options. */
-
-#if (L_DIMS == 3)
-
-		if (c_opt[v][0] == 0)
-		{
-			if (c_opt[v][1] == 0)
-			{
-				if (c_opt[v][2] == 0)
-				{
-					// First family
-					ds[v] = (-(Mneq[0] + Mneq[8] + Mneq[12]));
-				}
-				else
-				{
-					// Fourth family
-					ds[v] = ((-(Mneq[0] - Mneq[12]) - (Mneq[8] - Mneq[12])) / 6.0 + (Mneq[0] + Mneq[8] + Mneq[12]) / 6.0 - c_opt[v][2] * 0.5 * (Mneq[2] + Mneq[9]));
-				}
-			}
-			else
-			{
-				if (c_opt[v][2] == 0)
-				{
-					// Third family
-					ds[v] = ((-(Mneq[0] - Mneq[12]) + 2.0 * (Mneq[8] - Mneq[12])) / 6.0 + (Mneq[0] + Mneq[8] + Mneq[12]) / 6.0 - c_opt[v][1] * 0.5 * (Mneq[1] + Mneq[11]));
-				}
-				else
-				{	// Seventh family
-					ds[v] = (C[10 + v * numMoments] * 0.25 * Mneq[10] + (c_opt[v][2] * 0.25 * Mneq[9] + c_opt[v][1] * 0.25 * Mneq[11]));
-				}
-			}
-		}
-		else
+		for (int v = 0; v < L_NUM_VELS; v++)
 		{
-			if (c_opt[v][1] == 0)
-			{
-				if (c_opt[v][2] == 0)
-				{
-					// Second family
-					ds[v] = ((2.0 * (Mneq[0] - Mneq[12]) - (Mneq[8] - Mneq[12])) / 6.0 + (Mneq[0] + Mneq[8] + Mneq[12]) / 6.0 - c_opt[v][0] * 0.5 * (Mneq[4] + Mneq[7]));
-				}
-				else
-				{
-					// Sixth family
-					ds[v] = (C[6 + v * numMoments] * 0.25 * Mneq[6] + (c_opt[v][2] * 0.25 * Mneq[2] + c_opt[v][0] * 0.25 * Mneq[7]));
-				}
-			}
-			else
-			{
-				if (c_opt[v][2] == 0)
-				{
-					// Fifth family
-					ds[v] = (C[3 + v * numMoments] * 0.25 * Mneq[3] + (c_opt[v][1] * 0.25 * Mneq[1] + c_opt[v][0] * 0.25 * Mneq[4]));
-				}
-				else
-				{
-					// Eighth family
-					ds[v] = (C[5 + v * numMoments] * Mneq[5] / 8.0);
-				}
-			}
+			Mneq[m] += cKbcMoments[m][v] * fneq[v];
 		}
-#else
+	}
 
-		if (c_opt[v][0] == 0)
+	// Compute ds and dh and their scalar products in one pass
+	double top_prod = 0.0, bot_prod = 0.0;
+	for (int v = 0; v < L_NUM_VELS; v++)
+	{
+		// s part dictated by KBC model choice and direction
+		ds[v] = 0.0;
+		for (int m = 0; m < cKbcNumMoments; m++)
 		{
-			if (c_opt[v][1] == 0)
-			{
-				// First family
-				ds[v] = 0.0;
-			}
-			else
-			{
-				// Third family
-				ds[v] = -0.25 * (Mneq[0] - Mneq[2]);
-			}
-		}
-		else
-		{
-			if (c_opt[v][1] == 0)
-			{
-				// Second family
-				ds[v] = 0.25 * (Mneq[0] - Mneq[2]);
-			}
-			else
-			{
-				// Fourth family
-				ds[v] = 0.25 * C[1 + v * numMoments] * Mneq[1];
-			}
+			ds[v] += cKbcShear[v][m] * Mneq[m];
 		}
 
-#endif
 		// Compute dh
 		dh[v] = fneq[v] - ds[v];
-	}
 
-	// Once all dh and ds have been computed, compute the products
-	double top_prod = 0.0, bot_prod = 0.0;
-	for (int v = 0; v < L_NUM_VELS; v++)
-	{
 		// Compute scalar products
-		top_prod += ds[v] * dh[v] / feq[v + id * L_NUM_VELS];
-		bot_prod += dh[v] * dh[v] / feq[v + id * L_NUM_VELS];
+		double feq_inv = 1.0 / feq_loc[v];
+		top_prod += ds[v] * dh[v] * feq_inv;
+		bot_prod += dh[v] * dh[v] * feq_inv;
 	}
 
 	// Compute 1/beta
@@ -1681,12 +1640,13 @@ void GridObj::_LBM_kbcCollide_opt(int id)
 	else gamma = beta_m1 - (2.0 - beta_m1) * (top_prod / bot_prod);
 
 	// Finally perform collision
+	double beta = 1.0 / beta_m1;
 	for (int v = 0; v < L_NUM_VELS; v++)
 	{
 		// Perform collision
-		fNew[v + id * L_NUM_VELS] =
-			f[v + id * L_NUM_VELS] -
-			(1.0 / beta_m1) * (2.0 * ds[v] + gamma * dh[v])
+		fNew[v + popOffset(id)] =
+			f_loc[v] -
+			beta * (2.0 * ds[v] + gamma * dh[v])
 
 #if (defined L_GRAVITY_ON || defined L_IBM_ON)
 			+ force_i[v + id * L_NUM_VELS]
@@ -1695,6 +1655,8 @@ void GridObj::_LBM_kbcCollide_opt(int id)
 	}
 
 }
+#endif
+
 // *****************************************************************************
 /// \brief	Updates the Reynolds number at run time.
 ///
@@ -1728,6 +1690,56 @@ void GridObj::_LBM_resetForces()
 #endif
 }
 
+// *****************************************************************************
+/// \brief	Add a sample to the time-averaged quantities.
+///
+///			Called once per sampled time step after the macroscopic quantities
+///			have been updated. The running means are updated incrementally as
+///			mean += (x - mean) / n which avoids forming large sums and needs only
+///			a single reciprocal per step. Once L_TIME_AVERAGE_WINDOW samples have
+///			been taken the sample count restarts so the next sample overwrites
+///			the averages.
+void GridObj::_LBM_timeAverage_opt()
+{
+#if (L_TIME_AVERAGE_WINDOW > 0)
+	if (timeav_samples >= L_TIME_AVERAGE_WINDOW) timeav_samples = 0;
+#endif
+
+	// Weight of the new sample
+	++timeav_samples;
+	const double inv_n = 1.0 / static_cast<double>(timeav_samples);
+
+	// Loop over grid
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
+#endif
+	for (int id = 0; id < N_lim * M_lim * K_lim; ++id)
+	{
+		// Skip sites which are not updated by the kernel
+		eType type_local = LatTyp[id];
+		if (type_local == eRefined || type_local == eSolid || type_local == eCoupling
+#ifndef L_REGULARISED_BOUNDARIES
+			|| type_local == eVelocity
+#endif
+			) continue;
+
+		rho_timeav[id] += (rho[id] - rho_timeav[id]) * inv_n;
+
+		int pq_combo = 0;
+		for (int p = 0; p < L_DIMS; p++) {
+			const double u_p = u[p + id * L_DIMS];
+			ui_timeav[p + id * L_DIMS] += (u_p - ui_timeav[p + id * L_DIMS]) * inv_n;
+
+			// Do necessary products
+			for (int q = p; q < L_DIMS; q++) {
+				double &uiuj = uiuj_timeav[pq_combo + id * (3 * L_DIMS - 3)];
+				uiuj += (u_p * u[q + id * L_DIMS] - uiuj) * inv_n;
+				pq_combo++;
+			}
+		}
+	}
+}
+
 
 // *****************************************************************************
 /// \brief	Method to update macroscopic quantities on the fly and extrapolate from them.
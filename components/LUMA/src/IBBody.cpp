@@ -95,8 +95,9 @@ void IBBody::initialise(eMoveableType moveProperty)
 ///	\brief	Get the indexes of the valid markers (only relevant for owning ranks in parallel)
 void IBBody::getValidMarkers() {
 
-	// Clear the vector
+	// Clear the vector and the flattened support built from it
 	validMarkers.clear();
+	suppOffset.clear();
 
 	// Sort out the markers which do actually exist on this rank
 #ifdef L_BUILD_FOR_MPI
@@ -154,6 +155,9 @@ void IBBody::sortPtCloudMarkers() {
 	// Parallel build is more tricky as owning rank needs to gather all markers, sort then scatter to other ranks
 	MpiManager *mpim = MpiManager::getInstance();
 
+	// Sort local markers by ID first so the owning rank only has to merge the sorted runs
+	std::sort(markers.begin(), markers.end(), [](const IBMarker &a, const IBMarker &b) {return a.id < b.id;});
+
 	// Declare vectors for MPI comms
 	std::vector<double> recvPositionBuffer;
 	std::vector<int> recvIDBuffer;
@@ -179,8 +183,15 @@ void IBBody::sortPtCloudMarkers() {
 			}
 		}
 
-		// Sort the IDs according to the current ID values and return the indices
-		std::sort(indexIDs.begin(), indexIDs.end(), [&](int a, int b) {return recvIDBuffer[a] < recvIDBuffer[b];});
+		// Merge the sorted runs from each rank according to the current ID values and return the indices
+		auto byID = [&](int a, int b) {return recvIDBuffer[a] < recvIDBuffer[b];};
+		size_t nRuns = recvDisps.size();
+		for (size_t width = 1; width < nRuns; width *= 2) {
+			for (size_t r = 0; r + width < nRuns; r += 2 * width) {
+				std::inplace_merge(indexIDs.begin() + recvDisps[r], indexIDs.begin() + recvDisps[r + width],
+					(r + 2 * width < nRuns) ? indexIDs.begin() + recvDisps[r + 2 * width] : indexIDs.end(), byID);
+			}
+		}
 
 		// Pack into send buffer
 		sendSortedIDBuffer.resize(indexIDs.size(), 0);
@@ -137,3 +137,18 @@ SupportCommMarkerSideClass::SupportCommMarkerSideClass(int rankID, int body, int
 	supportID = support;
 	rankComm = rankID;
 }
+
+
+// ********************** Persistent Comm Methods ******************************
+
+// *****************************************************************************
+///	\brief	Default constructor for persistent IBM comm class
+IBCommPersistentClass::IBCommPersistentClass() {
+
+	// Buffers and requests are sized when the comm is built
+	sendBuffer.resize(0);
+	recvBuffer.resize(0);
+	sendDisps.resize(0);
+	recvDisps.resize(0);
+	requests.resize(0);
+}
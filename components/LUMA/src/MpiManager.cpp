@@ -55,11 +55,11 @@ MpiManager::MpiManager()
 #endif
 
 	// Resize buffer arrays based on number of MPI directions
-	f_buffer_send.resize(L_MPI_DIRS, std::vector<double>(0));
-	f_buffer_recv.resize(L_MPI_DIRS, std::vector<double>(0));	
+	f_buffer_send.resize(L_MPI_DIRS, std::vector<lbm_pop_t>(0));
+	f_buffer_recv.resize(L_MPI_DIRS, std::vector<lbm_pop_t>(0));	
 #ifdef L_TEMPERATURE
-	g_buffer_send.resize(L_MPI_DIRS, std::vector<double>(0));
-	g_buffer_recv.resize(L_MPI_DIRS, std::vector<double>(0));
+	g_buffer_send.resize(L_MPI_DIRS, std::vector<lbm_pop_t>(0));
+	g_buffer_recv.resize(L_MPI_DIRS, std::vector<lbm_pop_t>(0));
 #endif
 
 #ifdef L_PLE_DEBUG
@@ -76,6 +76,19 @@ MpiManager::MpiManager()
 	markerCommMarkerSide.resize(L_NUM_LEVELS+1);
 	supportCommMarkerSide.resize(L_NUM_LEVELS+1);
 	supportCommSupportSide.resize(L_NUM_LEVELS+1);
+	epsilonGatherComm.resize(L_NUM_LEVELS+1);
+	epsilonScatterComm.resize(L_NUM_LEVELS+1);
+	interpolateComm.resize(L_NUM_LEVELS+1);
+	spreadComm.resize(L_NUM_LEVELS+1);
+
+	// Give each persistent exchange empty offsets until the comms are built
+	std::vector<int> noCounts(num_ranks, 0);
+	for (int lev = 0; lev < L_NUM_LEVELS+1; lev++) {
+		mpi_buildPersistentComm(epsilonGatherComm[lev], noCounts, noCounts);
+		mpi_buildPersistentComm(epsilonScatterComm[lev], noCounts, noCounts);
+		mpi_buildPersistentComm(interpolateComm[lev], noCounts, noCounts);
+		mpi_buildPersistentComm(spreadComm[lev], noCounts, noCounts);
+	}
 }
 
 /// \brief	Default destructor.
@@ -84,6 +97,24 @@ MpiManager::MpiManager()
 ///
 MpiManager::~MpiManager(void)
 {
+	// Release persistent IBM requests and halo communicators if MPI is still available
+	int finalised;
+	MPI_Finalized(&finalised);
+	if (!finalised) {
+		for (HaloNeighbourStruct &hn : halo_neighbour_info) {
+#if (MPI_VERSION >= 4)
+			if (hn.request != MPI_REQUEST_NULL) MPI_Request_free(&hn.request);
+#endif
+			if (hn.graph_comm != MPI_COMM_NULL) MPI_Comm_free(&hn.graph_comm);
+		}
+		for (size_t lev = 0; lev < spreadComm.size(); lev++) {
+			mpi_freePersistentComm(epsilonGatherComm[lev]);
+			mpi_freePersistentComm(epsilonScatterComm[lev]);
+			mpi_freePersistentComm(interpolateComm[lev]);
+			mpi_freePersistentComm(spreadComm[lev]);
+		}
+	}
+
 	// Close the logfile
 	if (logout != nullptr)
 	{
@@ -281,6 +312,16 @@ void MpiManager::mpi_init()
 
 	}
 
+	// Select halo exchange engine (environment overrides the compiled default)
+	halo_engine = L_MPI_HALO_ENGINE;
+	const char *engine_env = getenv("LUMA_HALO_ENGINE");
+	if (engine_env != nullptr)
+	{
+		std::string engine_str(engine_env);
+		if (engine_str == "neighbour") halo_engine = eHaloNeighbourCollective;
+		else if (engine_str == "p2p") halo_engine = eHaloPointToPoint;
+	}
+
 	// End Initialisation //
 
 	return;
@@ -725,6 +766,13 @@ void MpiManager::mpi_communicate(int lev, int reg) {
 	GridObj* Grid = NULL;
 	GridUtils::getGrid(GridManager::getInstance()->Grids, lev, reg,  Grid);
 
+	// Neighbourhood collective engine handles all directions in one exchange
+	if (halo_engine == eHaloNeighbourCollective)
+	{
+		mpi_neighbourExchange(Grid);
+		return;
+	}
+
 
 	///////////////////////
 	// MPI Communication //
@@ -819,10 +867,10 @@ void MpiManager::mpi_communicate(int lev, int reg) {
 #endif
 #endif
 			// Post send message to message queue and log request handle in array
-			MPI_Isend( &f_buffer_send[dir].front(), static_cast<int>(f_buffer_send[dir].size()), MPI_DOUBLE, neighbour_rank[dir], 
+			MPI_Isend( &f_buffer_send[dir].front(), static_cast<int>(f_buffer_send[dir].size()), L_MPI_POP_TYPE, neighbour_rank[dir], 
 				TAG, world_comm, &send_requests[send_count-1] );
 #ifdef L_TEMPERATURE
-			MPI_Isend( &g_buffer_send[dir].front(), static_cast<int>(g_buffer_send[dir].size()), MPI_DOUBLE, neighbour_rank[dir], 
+			MPI_Isend( &g_buffer_send[dir].front(), static_cast<int>(g_buffer_send[dir].size()), L_MPI_POP_TYPE, neighbour_rank[dir], 
 				TAG_T, world_comm, &send_requests_t[send_count-1] );
 #endif
 
@@ -868,11 +916,11 @@ void MpiManager::mpi_communicate(int lev, int reg) {
 #endif
 
 			// Use a blocking receive call if required
-			MPI_Recv( &f_buffer_recv[dir].front(), static_cast<int>(f_buffer_recv[dir].size()), MPI_DOUBLE, neighbour_rank[opp_dir], 
+			MPI_Recv( &f_buffer_recv[dir].front(), static_cast<int>(f_buffer_recv[dir].size()), L_MPI_POP_TYPE, neighbour_rank[opp_dir], 
 				TAG, world_comm, &recv_stat );
 #ifdef L_TEMPERATURE
 			// Use a blocking receive call for passive scalar if required
-			MPI_Recv( &g_buffer_recv[dir].front(), static_cast<int>(g_buffer_recv[dir].size()), MPI_DOUBLE, neighbour_rank[opp_dir], 
+			MPI_Recv( &g_buffer_recv[dir].front(), static_cast<int>(g_buffer_recv[dir].size()), L_MPI_POP_TYPE, neighbour_rank[opp_dir], 
 				TAG_T, world_comm, &recv_stat_t );
 #endif
 
@@ -924,26 +972,220 @@ void MpiManager::mpi_communicate(int lev, int reg) {
 	// Print Time of MPI comms
 	t_end = clock();
 	secs = t_end - t_start;
+	mpi_communicateReport(Grid, secs);
+
+}
+
+// ************************************************************************* //
+/// \brief	Record the overhead of a halo exchange.
+///
+///			Updates the average MPI overhead time for the grid and writes the
+///			periodic text and log output. Shared by both halo exchange engines.
+///
+/// \param	g		grid which has been communicated.
+/// \param	secs	clock ticks taken by the exchange.
+void MpiManager::mpi_communicateReport(GridObj* const g, clock_t secs) {
 
 	// Update average MPI overhead time for this particular grid
-	Grid->timeav_mpi_overhead *= (Grid->t-1);
-	Grid->timeav_mpi_overhead += ((double)secs)/CLOCKS_PER_SEC;
-	Grid->timeav_mpi_overhead /= Grid->t;
+	g->timeav_mpi_overhead *= (g->t-1);
+	g->timeav_mpi_overhead += ((double)secs)/CLOCKS_PER_SEC;
+	g->timeav_mpi_overhead /= g->t;
 
 #ifdef L_TEXTOUT
-	if (Grid->t % L_GRID_OUT_FREQ == 0) {
+	if (g->t % L_GRID_OUT_FREQ == 0) {
 		*GridUtils::logfile << "Writing out to <Grids.out>" << std::endl;
-		Grid->io_textout("POST MPI COMMS");
+		g->io_textout("POST MPI COMMS");
 	}
 #endif
 
-	if (Grid->t % L_GRID_OUT_FREQ == 0) {
+	if (g->t % L_GRID_OUT_FREQ == 0) {
 		// Performance Data
 		L_INFO("MPI overhead taking an average of " + 
-			std::to_string(Grid->timeav_mpi_overhead * 1000) + "ms", GridUtils::logfile);
+			std::to_string(g->timeav_mpi_overhead * 1000) + "ms", GridUtils::logfile);
 	}
+}
 
+// ************************************************************************* //
+/// \brief	Build neighbourhood collective communicators.
+///
+///			For each grid a communicator is split from the Cartesian one
+///			containing only the ranks which hold that grid. A distributed graph
+///			is then created on it with one edge per direction which has a
+///			non-zero buffer. Edges are listed in direction order on both sides
+///			so that repeated edges between the same pair of ranks (small or
+///			periodic topologies) match in the same order as the tagged
+///			point-to-point scheme. Must be called on all ranks after the buffer
+///			sizes have been computed.
+void MpiManager::mpi_buildNeighbourComms() {
+
+	// Release any previous communicators
+	for (HaloNeighbourStruct &hn : halo_neighbour_info) {
+#if (MPI_VERSION >= 4)
+		if (hn.request != MPI_REQUEST_NULL) MPI_Request_free(&hn.request);
+#endif
+		if (hn.graph_comm != MPI_COMM_NULL) MPI_Comm_free(&hn.graph_comm);
+	}
+	halo_neighbour_info.clear();
+	halo_neighbour_info.reserve(L_NUM_LEVELS * L_NUM_REGIONS + 1);	// Persistent requests hold buffer addresses
+
+	// Group of the Cartesian communicator for rank translation
+	MPI_Group world_group;
+	MPI_Comm_group(world_comm, &world_group);
+
+	// Loop over grids in the same order on every rank
+	GridObj* g;
+	for (int l = 0; l <= L_NUM_LEVELS; l++) {
+		for (int r = 0; r < L_NUM_REGIONS; r++) {
+			if (l == 0 && r != 0) continue;		// L0 can only be R0
+
+			// Split off the ranks which hold this grid (collective on world_comm)
+			g = NULL;
+			GridUtils::getGrid(GridManager::getInstance()->Grids, l, r, g);
+			MPI_Comm grid_comm;
+			MPI_Comm_split(world_comm, (g == NULL ? MPI_UNDEFINED : 0), my_rank, &grid_comm);
+			if (g == NULL) continue;
+
+			// Find buffer sizes for this grid
+			const BufferSizeStruct *bufs = nullptr, *bufr = nullptr;
+			for (size_t i = 0; i < buffer_send_info.size(); i++) {
+				if (buffer_send_info[i].level == l && buffer_send_info[i].region == r) bufs = &buffer_send_info[i];
+				if (buffer_recv_info[i].level == l && buffer_recv_info[i].region == r) bufr = &buffer_recv_info[i];
+			}
 
+			// Translate neighbour ranks into the grid communicator
+			MPI_Group grid_group;
+			MPI_Comm_group(grid_comm, &grid_group);
+			int grid_neighbour[L_MPI_DIRS];
+			MPI_Group_translate_ranks(world_group, L_MPI_DIRS, neighbour_rank, grid_group, grid_neighbour);
+			MPI_Group_free(&grid_group);
+
+			// Build edge lists
+			halo_neighbour_info.emplace_back(l, r);
+			HaloNeighbourStruct &hn = halo_neighbour_info.back();
+			std::vector<int> destinations, sources;
+#ifdef L_TEMPERATURE
+			int fields = 2;
+#else
+			int fields = 1;
+#endif
+			int send_total = 0, recv_total = 0;
+			for (int dir = 0; dir < L_MPI_DIRS; dir++) {
+
+				if (bufs->size[dir] > 0) {
+					if (grid_neighbour[dir] == MPI_UNDEFINED)
+						L_ERROR("L" + std::to_string(l) + "R" + std::to_string(r) + " -- Rank " + std::to_string(neighbour_rank[dir]) +
+							" is expecting halo data but does not hold this grid.", GridUtils::logfile);
+					destinations.push_back(grid_neighbour[dir]);
+					hn.send_dirs.push_back(dir);
+					hn.send_counts.push_back(bufs->size[dir] * L_NUM_VELS * fields);
+					hn.send_displs.push_back(send_total);
+					send_total += hn.send_counts.back();
+				}
+
+				int opp_dir = mpi_getOpposite(dir);
+				if (bufr->size[dir] > 0) {
+					if (grid_neighbour[opp_dir] == MPI_UNDEFINED)
+						L_ERROR("L" + std::to_string(l) + "R" + std::to_string(r) + " -- Rank " + std::to_string(neighbour_rank[opp_dir]) +
+							" is sending halo data but does not hold this grid.", GridUtils::logfile);
+					sources.push_back(grid_neighbour[opp_dir]);
+					hn.recv_dirs.push_back(dir);
+					hn.recv_counts.push_back(bufr->size[dir] * L_NUM_VELS * fields);
+					hn.recv_displs.push_back(recv_total);
+					recv_total += hn.recv_counts.back();
+				}
+			}
+
+			// Single packed buffers
+			hn.send_buffer.resize(send_total);
+			hn.recv_buffer.resize(recv_total);
+
+			// Create the graph (no reordering as buffers are laid out by rank already)
+			MPI_Dist_graph_create_adjacent(grid_comm,
+				static_cast<int>(sources.size()), sources.data(), MPI_UNWEIGHTED,
+				static_cast<int>(destinations.size()), destinations.data(), MPI_UNWEIGHTED,
+				MPI_INFO_NULL, 0, &hn.graph_comm);
+			MPI_Comm_free(&grid_comm);
+
+#if (MPI_VERSION >= 4)
+			// Persistent collective bound to the packed buffers
+			MPI_Neighbor_alltoallv_init(hn.send_buffer.data(), hn.send_counts.data(), hn.send_displs.data(), L_MPI_POP_TYPE,
+				hn.recv_buffer.data(), hn.recv_counts.data(), hn.recv_displs.data(), L_MPI_POP_TYPE,
+				hn.graph_comm, MPI_INFO_NULL, &hn.request);
+#endif
+
+#ifdef L_MPI_VERBOSE
+			*logout << "Neighbourhood graph for L" << l << "R" << r << " has " << destinations.size()
+				<< " outgoing and " << sources.size() << " incoming edges" << std::endl;
+#endif
+		}
+	}
+
+	MPI_Group_free(&world_group);
+}
+
+// ************************************************************************* //
+/// \brief	Halo exchange using a neighbourhood collective.
+///
+///			Each direction is packed with the usual pack routine and copied
+///			into a single contiguous buffer which is exchanged with one
+///			MPI_Neighbor_alltoallv (persistent where MPI-4 is available)
+///			before being unpacked direction by direction. The MPI overhead
+///			for the grid is recorded by mpi_communicateReport().
+///
+/// \param	g	grid to communicate.
+void MpiManager::mpi_neighbourExchange(GridObj* const g) {
+
+	// Start the clock
+	clock_t t_start = clock();
+
+	// Find exchange data for this grid
+	HaloNeighbourStruct *hn = nullptr;
+	for (HaloNeighbourStruct &h : halo_neighbour_info) {
+		if (h.level == g->level && h.region == g->region_number) hn = &h;
+	}
+	if (hn == nullptr) {
+		L_ERROR("No neighbourhood communicator built for L" + std::to_string(g->level) +
+			"R" + std::to_string(g->region_number), GridUtils::logfile);
+	}
+
+	// Pack each outgoing direction then copy into the single buffer
+	for (size_t e = 0; e < hn->send_dirs.size(); e++) {
+		int dir = hn->send_dirs[e];
+		size_t n = hn->send_counts[e];
+#ifdef L_TEMPERATURE
+		n /= 2;
+		g_buffer_send[dir].resize(n);
+#endif
+		f_buffer_send[dir].resize(n);
+		mpi_buffer_pack(dir, g);
+		std::copy(f_buffer_send[dir].begin(), f_buffer_send[dir].end(), hn->send_buffer.begin() + hn->send_displs[e]);
+#ifdef L_TEMPERATURE
+		std::copy(g_buffer_send[dir].begin(), g_buffer_send[dir].end(), hn->send_buffer.begin() + hn->send_displs[e] + n);
+#endif
+	}
+
+	// Exchange
+#if (MPI_VERSION >= 4)
+	MPI_Start(&hn->request);
+	MPI_Wait(&hn->request, MPI_STATUS_IGNORE);
+#else
+	MPI_Neighbor_alltoallv(hn->send_buffer.data(), hn->send_counts.data(), hn->send_displs.data(), L_MPI_POP_TYPE,
+		hn->recv_buffer.data(), hn->recv_counts.data(), hn->recv_displs.data(), L_MPI_POP_TYPE, hn->graph_comm);
+#endif
+
+	// Copy out and unpack each incoming direction
+	for (size_t e = 0; e < hn->recv_dirs.size(); e++) {
+		int dir = hn->recv_dirs[e];
+		size_t n = hn->recv_counts[e];
+#ifdef L_TEMPERATURE
+		n /= 2;
+		g_buffer_recv[dir].assign(hn->recv_buffer.begin() + hn->recv_displs[e] + n, hn->recv_buffer.begin() + hn->recv_displs[e] + 2 * n);
+#endif
+		f_buffer_recv[dir].assign(hn->recv_buffer.begin() + hn->recv_displs[e], hn->recv_buffer.begin() + hn->recv_displs[e] + n);
+		mpi_buffer_unpack(dir, g);
+	}
+
+	mpi_communicateReport(g, clock() - t_start);
 }
 
 // ************************************************************************* //
@@ -1127,6 +1369,13 @@ void MpiManager::mpi_buffer_size() {
 
 #endif
 
+	// Build the neighbourhood collective communicators if required
+	if (halo_engine == eHaloNeighbourCollective)
+	{
+		L_INFO("Using neighbourhood collective halo exchange.", GridUtils::logfile);
+		mpi_buildNeighbourComms();
+	}
+
 }
 
 // ************************************************************************* //
@@ -29,18 +29,21 @@
 // *****************************************************************************
 ///	\brief	Do communication required for spreading to off-rank support points
 ///
+///			Forces are packed into the persistent spread exchange and the
+///			received values are left in its receive buffer, ordered by rank.
+///
 ///	\param	level			current grid level
-///	\param	spreadForces	forces that have been spread
-void MpiManager::mpi_spreadComm(int level, std::vector<std::vector<double>> &spreadForces) {
+void MpiManager::mpi_spreadComm(int level) {
 
 	// Get object manager instance
 	ObjectManager *objman = ObjectManager::getInstance();
 
 	// Declare values
 	int toRank, ib , m, s;
-	std::vector<std::vector<double>> sendForce(num_ranks, std::vector<double>(0));
+	IBCommPersistentClass &comm = spreadComm[level];
+	std::vector<int> idx(comm.sendDisps.begin(), comm.sendDisps.end() - 1);
 
-	// Pack and send data first
+	// Pack data
 	for (int i = 0; i < supportCommMarkerSide[level].size(); i++) {
 
 		// Get body index
@@ -63,65 +66,35 @@ void MpiManager::mpi_spreadComm(int level, std::vector<std::vector<double>> &spr
 
 			// Pack into buffer
 			for (int dir = 0; dir < L_DIMS; dir++) {
-				sendForce[toRank].push_back(objman->iBody[ib].markers[m].deltaval[s] * objman->iBody[ib].markers[m].force_xyz[dir] *
-						volWidth * volDepth * objman->iBody[ib].markers[m].ds);
+				comm.sendBuffer[idx[toRank]++] = objman->iBody[ib].markers[m].deltaval[s] * objman->iBody[ib].markers[m].force_xyz[dir] *
+						volWidth * volDepth * objman->iBody[ib].markers[m].ds;
 			}
 		}
 	}
 
-	// Now send the values
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-
-		// Check if current rank needs to send stuff to rank toRank
-		if (sendForce[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendForce[toRank].front(), static_cast<int>(sendForce[toRank].size()),
-				MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
-
-	// Get receive sizes from each rank
-	std::vector<int> bufferSize(num_ranks, 0);
-	for (int i = 0; i < supportCommSupportSide[level].size(); i++) {
-		if (objman->iBody[objman->bodyIDToIdx[supportCommSupportSide[level][i].bodyID]]._Owner->level == level)
-			bufferSize[supportCommSupportSide[level][i].rankComm] += L_DIMS;
-	}
-
-	// Now receive the velocity values
-	spreadForces.resize(num_ranks, std::vector<double>(0));
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// If there is data to receive from rank fromRank
-		if (bufferSize[fromRank] > 0) {
-			spreadForces[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&spreadForces[fromRank].front(), static_cast<int>(spreadForces[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
-
-	// If sending any messages then wait for request status
-	//MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
-	MPI_Barrier(MpiManager::getInstance()->world_comm);
+	// Exchange
+	mpi_exchangePersistentComm(comm);
 }
 
 
 // *****************************************************************************
 ///	\brief	Do communication required for interpolating from off-rank support points
 ///
+///			Density and momentum are packed into the persistent interpolation
+///			exchange and the received values are left in its receive buffer.
+///
 ///	\param	level			current grid level
-///	\param	recvVel			velocities that have been interpolated
-void MpiManager::mpi_interpolateComm(int level, std::vector<std::vector<double>> &recvVel) {
+void MpiManager::mpi_interpolateComm(int level) {
 
 	// Get object manager instance
 	ObjectManager *objman = ObjectManager::getInstance();
 
 	// Declare values
 	int toRank, ib;
-	std::vector<int> idx(3, 0);
-	std::vector<std::vector<double>> sendVel(num_ranks, std::vector<double>(0));
+	IBCommPersistentClass &comm = interpolateComm[level];
+	std::vector<int> idx(comm.sendDisps.begin(), comm.sendDisps.end() - 1);
 
-	// Pack and send data first
+	// Pack data
 	for (int i = 0; i < supportCommSupportSide[level].size(); i++) {
 
 		// Get body ID
@@ -140,66 +113,25 @@ void MpiManager::mpi_interpolateComm(int level, std::vector<std::vector<double>>
 #endif
 
 			// Get indices
-			idx = supportCommSupportSide[level][i].supportIdx;
+			const std::vector<int> &supp = supportCommSupportSide[level][i].supportIdx;
 
 			// Pack density and momentum into buffer
 #if (L_DIMS == 2)
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim));
-
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], eXDirection, M_lim, L_DIMS));
-
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], M_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], eYDirection, M_lim, L_DIMS));
+			double rho = objman->iBody[ib]._Owner->rho(supp[eXDirection], supp[eYDirection], M_lim);
+			comm.sendBuffer[idx[toRank]++] = rho;
+			for (int dir = 0; dir < L_DIMS; dir++)
+				comm.sendBuffer[idx[toRank]++] = rho * objman->iBody[ib]._Owner->u(supp[eXDirection], supp[eYDirection], dir, M_lim, L_DIMS);
 #elif (L_DIMS == 3)
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim));
-
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eXDirection, M_lim, K_lim, L_DIMS));
-
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eYDirection, M_lim, K_lim, L_DIMS));
-
-			sendVel[toRank].push_back(objman->iBody[ib]._Owner->rho(idx[eXDirection], idx[eYDirection], idx[eZDirection], M_lim, K_lim) *
-									  objman->iBody[ib]._Owner->u(idx[eXDirection], idx[eYDirection], idx[eZDirection], eZDirection, M_lim, K_lim, L_DIMS));
+			double rho = objman->iBody[ib]._Owner->rho(supp[eXDirection], supp[eYDirection], supp[eZDirection], M_lim, K_lim);
+			comm.sendBuffer[idx[toRank]++] = rho;
+			for (int dir = 0; dir < L_DIMS; dir++)
+				comm.sendBuffer[idx[toRank]++] = rho * objman->iBody[ib]._Owner->u(supp[eXDirection], supp[eYDirection], supp[eZDirection], dir, M_lim, K_lim, L_DIMS);
 #endif
 		}
 	}
 
-	// Now send the values
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-
-		// Check if current rank needs to send stuff to rank toRank
-		if (sendVel[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendVel[toRank].front(), static_cast<int>(sendVel[toRank].size()),
-				MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
-
-	// Get receive sizes from each rank
-	std::vector<int> bufferSize(num_ranks, 0);
-	for (int i = 0; i < supportCommMarkerSide[level].size(); i++) {
-		if (objman->iBody[objman->bodyIDToIdx[supportCommMarkerSide[level][i].bodyID]]._Owner->level == level)
-			bufferSize[supportCommMarkerSide[level][i].rankComm] += L_DIMS + 1;
-	}
-
-	// Now receive the velocity values
-	recvVel.resize(num_ranks, std::vector<double>(0));
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// If there is data to receive from rank fromRank
-		if (bufferSize[fromRank] > 0) {
-			recvVel[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&recvVel[fromRank].front(), static_cast<int>(recvVel[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
-
-	// If sending any messages then wait for request status
-	//MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
-	MPI_Barrier(MpiManager::getInstance()->world_comm);
+	// Exchange
+	mpi_exchangePersistentComm(comm);
 }
 
 
@@ -212,10 +144,11 @@ void MpiManager::mpi_epsilonCommScatter(int level) {
 	// Get object manager instance
 	ObjectManager *objman = ObjectManager::getInstance();
 
-	// Declare send buffer
-	std::vector<std::vector<double>> sendBuffer(num_ranks, std::vector<double>(0));
+	// Get persistent exchange and running send offsets
+	IBCommPersistentClass &comm = epsilonScatterComm[level];
+	std::vector<int> idx(comm.sendDisps.begin(), comm.sendDisps.end() - 1);
 
-	// Pack and send the other epsilon values
+	// Pack the other epsilon values
 	int toRank, ib, markerID;
 	for (int i = 0; i < markerCommOwnerSide[level].size(); i++) {
 
@@ -225,52 +158,18 @@ void MpiManager::mpi_epsilonCommScatter(int level) {
 		markerID = markerCommOwnerSide[level][i].markerID;
 
 		// Insert into buffer
-		sendBuffer[toRank].push_back(objman->iBody[ib].markers[markerID].epsilon);
-	}
-
-	// Loop through and post send if there is data
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-		if (sendBuffer[toRank].size() > 0) {
-
-#ifdef L_MPI_VERBOSE
-			L_INFO("Sending epsilon values to rank " + std::to_string(toRank), MpiManager::logout);
-#endif
-
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendBuffer[toRank].front(), static_cast<int>(sendBuffer[toRank].size()),
-				MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
+		comm.sendBuffer[idx[toRank]++] = objman->iBody[ib].markers[markerID].epsilon;
 	}
 
-	// Set up receive buffer sizes
-	std::vector<int> bufferSize(num_ranks, 0);
-
-	// Size the receive buffer
-	for (int i = 0; i < markerCommMarkerSide[level].size(); i++)
-		bufferSize[markerCommMarkerSide[level][i].rankComm]++;
-
-	// Declare receive buffer
-	std::vector<std::vector<double>> recvBuffer(num_ranks, std::vector<double>(0));
-
-	// Loop through and receive if there is data
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// Only do if there is information to receive
-		if (bufferSize[fromRank] > 0) {
-
 #ifdef L_MPI_VERBOSE
-			L_INFO("Receiving epsilon values from rank " + std::to_string(fromRank), MpiManager::logout);
+	L_INFO("Exchanging epsilon values with " + std::to_string(comm.requests.size()) + " persistent requests", MpiManager::logout);
 #endif
 
-			recvBuffer[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&recvBuffer[fromRank].front(), static_cast<int>(recvBuffer[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
+	// Exchange
+	mpi_exchangePersistentComm(comm);
 
-	// Create idx vector
-	std::vector<int> idx(num_ranks, 0);
+	// Reset idx vector to receive offsets
+	idx.assign(comm.recvDisps.begin(), comm.recvDisps.end() - 1);
 
 	// Now unpack into epsilon values
 	int fromRank, markerIdx;
@@ -282,13 +181,8 @@ void MpiManager::mpi_epsilonCommScatter(int level) {
 		markerIdx = markerCommMarkerSide[level][i].markerIdx;
 
 		// Put into epsilon
-		objman->iBody[ib].markers[markerIdx].epsilon = recvBuffer[fromRank][idx[fromRank]];
-		idx[fromRank]++;
+		objman->iBody[ib].markers[markerIdx].epsilon = comm.recvBuffer[idx[fromRank]++];
 	}
-
-	// If sending any messages then wait for request status
-	//MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
-	MPI_Barrier(MpiManager::getInstance()->world_comm);
 }
 
 
@@ -301,8 +195,9 @@ void MpiManager::mpi_epsilonCommGather(int level) {
 	// Get object manager instance
 	ObjectManager *objman = ObjectManager::getInstance();
 
-	// Declare send buffer
-	std::vector<std::vector<double>> sendBuffer(num_ranks, std::vector<double>(0));
+	// Get persistent exchange and running send offsets
+	IBCommPersistentClass &comm = epsilonGatherComm[level];
+	std::vector<int> idx(comm.sendDisps.begin(), comm.sendDisps.end() - 1);
 
 	// Pack the data to send
 	int toRank, ib, m;
@@ -315,45 +210,20 @@ void MpiManager::mpi_epsilonCommGather(int level) {
 
 		// Pack support data
 		for (int s = 0; s < objman->iBody[ib].markers[m].deltaval.size(); s++) {
-			sendBuffer[toRank].push_back(objman->iBody[ib].markers[m].supp_x[s]);
-			sendBuffer[toRank].push_back(objman->iBody[ib].markers[m].supp_y[s]);
+			comm.sendBuffer[idx[toRank]++] = objman->iBody[ib].markers[m].supp_x[s];
+			comm.sendBuffer[idx[toRank]++] = objman->iBody[ib].markers[m].supp_y[s];
 #if (L_DIMS == 3)
-			sendBuffer[toRank].push_back(objman->iBody[ib].markers[m].supp_z[s]);
+			comm.sendBuffer[idx[toRank]++] = objman->iBody[ib].markers[m].supp_z[s];
 #endif
-			sendBuffer[toRank].push_back(objman->iBody[ib].markers[m].deltaval[s]);
+			comm.sendBuffer[idx[toRank]++] = objman->iBody[ib].markers[m].deltaval[s];
 		}
 	}
 
-	// Now loop through send buffer and send to appropriate ranks
-	std::vector<MPI_Request> sendRequests;
-	for (int toRank = 0; toRank < num_ranks; toRank++) {
-		if (sendBuffer[toRank].size() > 0) {
-			sendRequests.push_back(MPI_REQUEST_NULL);
-			MPI_Isend(&sendBuffer[toRank].front(), static_cast<int>(sendBuffer[toRank].size()), MPI_DOUBLE, toRank, my_rank, world_comm, &sendRequests.back());
-		}
-	}
+	// Exchange
+	mpi_exchangePersistentComm(comm);
 
-	// Get buffer sizes
-	std::vector<int> bufferSize(num_ranks, 0);
-	for (int i = 0; i < markerCommOwnerSide[level].size(); i++)
-		bufferSize[markerCommOwnerSide[level][i].rankComm] += markerCommOwnerSide[level][i].nSupportSites * (L_DIMS + 1);
-
-	// Now create receive buffer
-	std::vector<std::vector<double>> recvBuffer(num_ranks, std::vector<double>(0));
-
-	// Now loop through and receive the buffer
-	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
-
-		// Only do if there is information to receive
-		if (bufferSize[fromRank] > 0) {
-			recvBuffer[fromRank].resize(bufferSize[fromRank]);
-			MPI_Recv(&recvBuffer[fromRank].front(), static_cast<int>(recvBuffer[fromRank].size()),
-				MPI_DOUBLE, fromRank, fromRank, world_comm, MPI_STATUS_IGNORE);
-		}
-	}
-
-	// Index vector for looping through recvBuffer
-	std::vector<int> idx(num_ranks, 0);
+	// Reset idx vector to receive offsets
+	idx.assign(comm.recvDisps.begin(), comm.recvDisps.end() - 1);
 
 	// Now unpack
 	int fromRank, nSupports;
@@ -373,22 +243,18 @@ void MpiManager::mpi_epsilonCommGather(int level) {
 
 		// Unpack into iBody
 		for (int s = 0; s < nSupports; s++) {
-			objman->iBody[ib].markers[m].supp_x[s] = recvBuffer[fromRank][idx[fromRank]];
-			objman->iBody[ib].markers[m].supp_y[s] = recvBuffer[fromRank][idx[fromRank]+1];
+			objman->iBody[ib].markers[m].supp_x[s] = comm.recvBuffer[idx[fromRank]];
+			objman->iBody[ib].markers[m].supp_y[s] = comm.recvBuffer[idx[fromRank]+1];
 #if (L_DIMS == 3)
-			objman->iBody[ib].markers[m].supp_z[s] = recvBuffer[fromRank][idx[fromRank]+2];
+			objman->iBody[ib].markers[m].supp_z[s] = comm.recvBuffer[idx[fromRank]+2];
 #endif
 			idx[fromRank] += L_DIMS;
 
 			// Get delta values
-			objman->iBody[ib].markers[m].deltaval[s] = recvBuffer[fromRank][idx[fromRank]];
+			objman->iBody[ib].markers[m].deltaval[s] = comm.recvBuffer[idx[fromRank]];
 			idx[fromRank]++;
 		}
 	}
-
-	// If sending any messages then wait for request status
-	//MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
-	MPI_Barrier(MpiManager::getInstance()->world_comm);
 }
 
 
@@ -818,6 +684,24 @@ void MpiManager::mpi_buildMarkerComms(int level) {
 	// If sending any messages then wait for request status
 	//MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
 	MPI_Barrier(MpiManager::getInstance()->world_comm);
+
+	// Get message sizes for the epsilon exchanges
+	std::vector<int> ownerCounts(num_ranks, 0), ownerSupportCounts(num_ranks, 0);
+	std::vector<int> markerCounts(num_ranks, 0), markerSupportCounts(num_ranks, 0);
+	for (int i = 0; i < markerCommOwnerSide[level].size(); i++) {
+		ownerCounts[markerCommOwnerSide[level][i].rankComm]++;
+		ownerSupportCounts[markerCommOwnerSide[level][i].rankComm] += markerCommOwnerSide[level][i].nSupportSites * (L_DIMS + 1);
+	}
+	for (int i = 0; i < markerCommMarkerSide[level].size(); i++) {
+		ib = objman->bodyIDToIdx[markerCommMarkerSide[level][i].bodyID];
+		m = markerCommMarkerSide[level][i].markerIdx;
+		markerCounts[markerCommMarkerSide[level][i].rankComm]++;
+		markerSupportCounts[markerCommMarkerSide[level][i].rankComm] += static_cast<int>(objman->iBody[ib].markers[m].deltaval.size()) * (L_DIMS + 1);
+	}
+
+	// Rebuild persistent requests for the epsilon exchanges
+	mpi_buildPersistentComm(epsilonGatherComm[level], markerSupportCounts, ownerSupportCounts);
+	mpi_buildPersistentComm(epsilonScatterComm[level], ownerCounts, markerCounts);
 }
 
 // *****************************************************************************
@@ -955,6 +839,108 @@ void MpiManager::mpi_buildSupportComms(int level) {
 	// If sending any messages then wait for request status
 	//MPI_Waitall(static_cast<int>(sendRequests.size()), &sendRequests.front(), MPI_STATUS_IGNORE);
 	MPI_Barrier(MpiManager::getInstance()->world_comm);
+
+	// Get message sizes for the interpolation and spreading exchanges
+	std::vector<int> supportCounts(num_ranks, 0), markerCounts(num_ranks, 0);
+	for (int i = 0; i < supportCommSupportSide[level].size(); i++) {
+		if (objman->iBody[objman->bodyIDToIdx[supportCommSupportSide[level][i].bodyID]]._Owner->level == level)
+			supportCounts[supportCommSupportSide[level][i].rankComm]++;
+	}
+	for (int i = 0; i < supportCommMarkerSide[level].size(); i++) {
+		if (objman->iBody[objman->bodyIDToIdx[supportCommMarkerSide[level][i].bodyID]]._Owner->level == level)
+			markerCounts[supportCommMarkerSide[level][i].rankComm]++;
+	}
+
+	// Interpolation sends density and momentum per support site
+	std::vector<int> sendCounts(num_ranks, 0), recvCounts(num_ranks, 0);
+	for (int rank = 0; rank < num_ranks; rank++) {
+		sendCounts[rank] = supportCounts[rank] * (L_DIMS + 1);
+		recvCounts[rank] = markerCounts[rank] * (L_DIMS + 1);
+	}
+	mpi_buildPersistentComm(interpolateComm[level], sendCounts, recvCounts);
+
+	// Spreading returns a force per support site
+	for (int rank = 0; rank < num_ranks; rank++) {
+		sendCounts[rank] = markerCounts[rank] * L_DIMS;
+		recvCounts[rank] = supportCounts[rank] * L_DIMS;
+	}
+	mpi_buildPersistentComm(spreadComm[level], sendCounts, recvCounts);
+}
+
+
+// *****************************************************************************
+///	\brief	Build persistent requests for an IBM exchange
+///
+///			Any requests from a previous build are released first. Buffers are
+///			laid out contiguously by rank and must not be resized afterwards
+///			as the requests are bound to their addresses.
+///
+///	\param	comm			persistent exchange to build.
+///	\param	sendCounts		number of values to send to each rank.
+///	\param	recvCounts		number of values to receive from each rank.
+void MpiManager::mpi_buildPersistentComm(IBCommPersistentClass &comm, std::vector<int> &sendCounts, std::vector<int> &recvCounts) {
+
+	// Release the old requests
+	mpi_freePersistentComm(comm);
+
+	// Get offsets into the flat buffers
+	comm.sendDisps.assign(num_ranks + 1, 0);
+	comm.recvDisps.assign(num_ranks + 1, 0);
+	for (int rank = 0; rank < num_ranks; rank++) {
+		comm.sendDisps[rank + 1] = comm.sendDisps[rank] + sendCounts[rank];
+		comm.recvDisps[rank + 1] = comm.recvDisps[rank] + recvCounts[rank];
+	}
+
+	// Size the buffers
+	comm.sendBuffer.assign(comm.sendDisps[num_ranks], 0.0);
+	comm.recvBuffer.assign(comm.recvDisps[num_ranks], 0.0);
+
+	// Post persistent receives first then sends
+	for (int fromRank = 0; fromRank < num_ranks; fromRank++) {
+		if (recvCounts[fromRank] > 0) {
+			comm.requests.push_back(MPI_REQUEST_NULL);
+			MPI_Recv_init(&comm.recvBuffer[comm.recvDisps[fromRank]], recvCounts[fromRank],
+				MPI_DOUBLE, fromRank, fromRank, world_comm, &comm.requests.back());
+		}
+	}
+	for (int toRank = 0; toRank < num_ranks; toRank++) {
+		if (sendCounts[toRank] > 0) {
+			comm.requests.push_back(MPI_REQUEST_NULL);
+			MPI_Send_init(&comm.sendBuffer[comm.sendDisps[toRank]], sendCounts[toRank],
+				MPI_DOUBLE, toRank, my_rank, world_comm, &comm.requests.back());
+		}
+	}
+}
+
+
+// *****************************************************************************
+///	\brief	Start a persistent IBM exchange and wait for it to complete
+///
+///	\param	comm			persistent exchange with packed send buffer.
+void MpiManager::mpi_exchangePersistentComm(IBCommPersistentClass &comm) {
+
+	// Nothing to do if this rank has no partners
+	if (comm.requests.empty())
+		return;
+
+	// Start all and wait for completion
+	MPI_Startall(static_cast<int>(comm.requests.size()), &comm.requests.front());
+	MPI_Waitall(static_cast<int>(comm.requests.size()), &comm.requests.front(), MPI_STATUSES_IGNORE);
+}
+
+
+// *****************************************************************************
+///	\brief	Release the persistent requests of an IBM exchange
+///
+///	\param	comm			persistent exchange to release.
+void MpiManager::mpi_freePersistentComm(IBCommPersistentClass &comm) {
+
+	// Free each request
+	for (size_t i = 0; i < comm.requests.size(); i++) {
+		if (comm.requests[i] != MPI_REQUEST_NULL)
+			MPI_Request_free(&comm.requests[i]);
+	}
+	comm.requests.clear();
 }
 
 
@@ -1138,3 +1124,94 @@ void MpiManager::mpi_ptCloudMarkerScatter(IBBody *iBody, std::vector<int> &sendS
 		}
 	}
 }
+
+
+// *****************************************************************************
+///	\brief	Distribute point cloud points to the ranks on which they lie
+///
+///			Used when each rank has read a different chunk of a point cloud. 
+///			Every point is sent to each rank for which GridUtils::isOnThisRank
+///			would return true (core or receiver layer) so the result is the 
+///			same as every rank reading the whole cloud and filtering it. Points 
+///			are received in rank order so remain ordered by point ID provided 
+///			the chunks were read in rank order.
+///
+///	\param	_PCpts	point cloud data (replaced by the points on this rank)
+void MpiManager::mpi_ptCloudDistribute(PCpts *_PCpts) {
+
+	// Get receiver layer positions of every rank
+	std::vector<double> allRecvLayers(num_ranks * 12, 0.0);
+	MPI_Allgather(&recv_layer_pos, 12, MPI_DOUBLE, allRecvLayers.data(), 12, MPI_DOUBLE, world_comm);
+
+	// Pack points into a buffer for each rank they lie on
+	std::vector<std::vector<double>> sendPositions(num_ranks);
+	std::vector<std::vector<int>> sendIDs(num_ranks);
+	for (size_t a = 0; a < _PCpts->x.size(); a++) {
+
+		double pos[3] = { _PCpts->x[a], _PCpts->y[a], _PCpts->z[a] };
+		for (int r = 0; r < num_ranks; r++) {
+
+			// Check core
+			bool onRank = true;
+			for (int d = 0; d < L_DIMS; d++) {
+				if (pos[d] < rank_core_edge[eXMin + 2 * d][r] || pos[d] >= rank_core_edge[eXMax + 2 * d][r])
+					onRank = false;
+			}
+
+			// Check receiver layers (same logic as GridUtils::isOnRecvLayer)
+			const double *layers = &allRecvLayers[r * 12];
+			for (int d = 0; d < L_DIMS && !onRank; d++) {
+				if ((pos[d] >= layers[d * 4 + eLeftMin] && pos[d] < layers[d * 4 + eLeftMax]) ||
+					(pos[d] >= layers[d * 4 + eRightMin] && pos[d] < layers[d * 4 + eRightMax]))
+					onRank = true;
+			}
+
+			// Add to buffer
+			if (onRank) {
+				sendPositions[r].insert(sendPositions[r].end(), pos, pos + 3);
+				sendIDs[r].push_back(_PCpts->id[a]);
+			}
+		}
+	}
+
+	// Flatten buffers and exchange sizes
+	std::vector<int> sendSizes(num_ranks, 0), recvSizes(num_ranks, 0);
+	std::vector<int> sendDisps(num_ranks, 0), recvDisps(num_ranks, 0);
+	std::vector<double> sendPositionBuffer;
+	std::vector<int> sendIDBuffer;
+	for (int r = 0; r < num_ranks; r++) {
+		sendSizes[r] = static_cast<int>(sendIDs[r].size());
+		sendDisps[r] = static_cast<int>(sendIDBuffer.size());
+		sendIDBuffer.insert(sendIDBuffer.end(), sendIDs[r].begin(), sendIDs[r].end());
+		sendPositionBuffer.insert(sendPositionBuffer.end(), sendPositions[r].begin(), sendPositions[r].end());
+	}
+	MPI_Alltoall(sendSizes.data(), 1, MPI_INT, recvSizes.data(), 1, MPI_INT, world_comm);
+	for (int r = 1; r < num_ranks; r++)
+		recvDisps[r] = recvDisps[r - 1] + recvSizes[r - 1];
+	int nRecv = recvDisps[num_ranks - 1] + recvSizes[num_ranks - 1];
+
+	// Exchange IDs
+	std::vector<int> recvIDBuffer(nRecv, 0);
+	MPI_Alltoallv(sendIDBuffer.data(), sendSizes.data(), sendDisps.data(), MPI_INT,
+		recvIDBuffer.data(), recvSizes.data(), recvDisps.data(), MPI_INT, world_comm);
+
+	// Exchange positions
+	for (int r = 0; r < num_ranks; r++) {
+		sendSizes[r] *= 3; sendDisps[r] *= 3;
+		recvSizes[r] *= 3; recvDisps[r] *= 3;
+	}
+	std::vector<double> recvPositionBuffer(3 * nRecv, 0.0);
+	MPI_Alltoallv(sendPositionBuffer.data(), sendSizes.data(), sendDisps.data(), MPI_DOUBLE,
+		recvPositionBuffer.data(), recvSizes.data(), recvDisps.data(), MPI_DOUBLE, world_comm);
+
+	// Replace the point cloud with the points on this rank
+	_PCpts->x.resize(nRecv);
+	_PCpts->y.resize(nRecv);
+	_PCpts->z.resize(nRecv);
+	_PCpts->id = recvIDBuffer;
+	for (int a = 0; a < nRecv; a++) {
+		_PCpts->x[a] = recvPositionBuffer[a * 3];
+		_PCpts->y[a] = recvPositionBuffer[a * 3 + 1];
+		_PCpts->z[a] = recvPositionBuffer[a * 3 + 2];
+	}
+}
@@ -89,7 +89,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -126,7 +126,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -163,7 +163,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -200,7 +200,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -237,7 +237,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -275,7 +275,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -312,7 +312,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -349,7 +349,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -388,7 +388,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -422,7 +422,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -456,7 +456,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -490,7 +490,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -524,7 +524,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -558,7 +558,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -592,7 +592,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -626,7 +626,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -660,7 +660,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -694,7 +694,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -728,7 +728,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -762,7 +762,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -796,7 +796,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -830,7 +830,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -864,7 +864,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -898,7 +898,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -932,7 +932,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -966,7 +966,7 @@ void MpiManager::mpi_buffer_pack(int dir, GridObj* const g) {
 						) {
 							// Must be a site to send
 							for (v = 0; v < L_NUM_VELS; v++) {
-								f_buffer_send[dir][idx] = g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
+								f_buffer_send[dir][idx] = g->f[v + g->popOffset(i, j, k)];
 #ifdef L_TEMPERATURE
 								g_buffer_send[dir][idx] = g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS);
 #endif
@@ -80,7 +80,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -120,7 +120,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -160,7 +160,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -200,7 +200,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -240,7 +240,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -281,7 +281,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -321,7 +321,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -361,7 +361,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -403,7 +403,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -440,7 +440,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -477,7 +477,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -514,7 +514,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -551,7 +551,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -588,7 +588,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -625,7 +625,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -662,7 +662,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -699,7 +699,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -736,7 +736,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -773,7 +773,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -810,7 +810,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -847,7 +847,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -884,7 +884,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -921,7 +921,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -958,7 +958,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -995,7 +995,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
@@ -1032,7 +1032,7 @@ void MpiManager::mpi_buffer_unpack( int dir, GridObj* const g ) {
 						) {
 							// Must be suitable receiver site
 							for (v = 0; v < L_NUM_VELS; v++) {
-								g->f(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = f_buffer_recv[dir][idx];
+								g->f[v + g->popOffset(i, j, k)] = f_buffer_recv[dir][idx];
 #ifdef L_TEMPERATURE
 								g->g(i,j,k,v,M_lim,K_lim,L_NUM_VELS) = g_buffer_recv[dir][idx];
 #endif
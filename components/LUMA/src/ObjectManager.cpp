@@ -76,15 +76,22 @@ ObjectManager::ObjectManager(GridObj* g) : _Grids(g)
 	// Set sub-iteration loop values
 	timeav_subResidual = 0.0;
 	timeav_subIterations = 0.0;
+
+	// Resize sub-iteration storage
+	subSavedIds.resize(L_NUM_LEVELS+1);
+	subSavedVel.resize(L_NUM_LEVELS+1);
+	subSavedFlag.resize(L_NUM_LEVELS+1);
 };
 
 // ************************************************************************* //
 /// \brief	Compute forces on a BB rigid object.
 ///
 ///			Uses momentum exchange to compute forces on rigid bodies.
-///			Currently working with bounce-back objects only. There is no 
-///			bounding box so if we have walls in the domain they will be counted 
-///			as well.
+///			Per-site version which is only used when L_MOMEX_DEBUG is defined 
+///			as it writes the contribution of every link to the debugging file.
+///			There is no bounding box so if we have walls in the domain they 
+///			will be counted as well. As sites are not matched to a body, all
+///			contributions are added to the first BB body on the rank.
 ///
 /// \param	i	local i-index of solid site.
 /// \param	j	local j-index of solid site.
@@ -92,13 +99,13 @@ ObjectManager::ObjectManager(GridObj* g) : _Grids(g)
 /// \param	g	pointer to grid on which object resides.
 void ObjectManager::computeLiftDrag(int i, int j, int k, GridObj *g) {
 
-	// TODO: Need a bounding box for object if we have walls in the domain otherwise they will also be counted
-	// TODO: Also need to be able to identify which body this site relates to so we can differentiate
-
 	int N_lim = g->N_lim;
 	int M_lim = g->M_lim;
 	int K_lim = g->K_lim;
 
+	// Nothing to add to if no BB body on this rank
+	if (bbbBodyID.empty()) return;
+
 	// For MPI builds, ignore if part of object is in halo region as represented on another rank
 #ifdef L_BUILD_FOR_MPI
 	if (!GridUtils::isOnRecvLayer(g->XPos[i], g->YPos[j], g->ZPos[k]))
@@ -144,9 +151,9 @@ void ObjectManager::computeLiftDrag(int i, int j, int k, GridObj *g) {
 				 */
 
 				 // Store contribution in this direction
-				contrib_x = 2.0 * c[eXDirection][n_opp] * g->f(xdest, ydest, zdest, n_opp, M_lim, K_lim, L_NUM_VELS);
-				contrib_y = 2.0 * c[eYDirection][n_opp] * g->f(xdest, ydest, zdest, n_opp, M_lim, K_lim, L_NUM_VELS);
-				contrib_z = 2.0 * c[eZDirection][n_opp] * g->f(xdest, ydest, zdest, n_opp, M_lim, K_lim, L_NUM_VELS);
+				contrib_x = 2.0 * c[eXDirection][n_opp] * g->f[n_opp + g->popOffset(xdest, ydest, zdest)];
+				contrib_y = 2.0 * c[eYDirection][n_opp] * g->f[n_opp + g->popOffset(xdest, ydest, zdest)];
+				contrib_z = 2.0 * c[eZDirection][n_opp] * g->f[n_opp + g->popOffset(xdest, ydest, zdest)];
 			}
 
 #ifdef L_MOMEX_DEBUG
@@ -155,14 +162,48 @@ void ObjectManager::computeLiftDrag(int i, int j, int k, GridObj *g) {
 				debugstream << "," << std::to_string(contrib_x) << "," << std::to_string(contrib_y) << "," << std::to_string(contrib_z);
 #endif
 			// Add the contribution of this link to the body forces
-			bbbForceOnObjectX += contrib_x;
-			bbbForceOnObjectY += contrib_y;
-			bbbForceOnObjectZ += contrib_z;
+			bbbForceOnObjectX[0] += contrib_x;
+			bbbForceOnObjectY[0] += contrib_y;
+			bbbForceOnObjectZ[0] += contrib_z;
 
 		}
 	}
 }
 
+// ************************************************************************* //
+/// \brief	Compute forces on a BB rigid object from the link list.
+///
+///			Uses momentum exchange to compute forces on rigid bodies by 
+///			reducing over the fluid-body links built by buildMomexLinks(). 
+///			Only links into sites labelled by a BB body are included so
+///			walls and other solid sites do not contribute. Each link adds 
+///			to the force on the body it points into. Must be called before
+///			the distributions are swapped.
+///
+/// \param	g	pointer to grid on which method was called.
+void ObjectManager::computeLiftDrag(GridObj *g)
+{
+	// Only the grid on which the body resides has links
+	if (g->level != bbbOnGridLevel || g->region_number != bbbOnGridReg) return;
+
+	const lbm_pop_t *f = g->f.data();
+	const int nLinks = static_cast<int>(bbbLinkSite.size());
+
+	// Loop over links
+	for (int a = 0; a < nLinks; ++a)
+	{
+		/* For HWBB the force is twice the pre-stream population 
+		 * travelling toward the wall resolved in the link direction 
+		 * -- see per-site version for details. */
+		int n = bbbLinkDir[a];
+		int b = bbbLinkBody[a];
+		double fIn = 2.0 * f[n + g->popOffset(bbbLinkSite[a])];
+		bbbForceOnObjectX[b] += c[eXDirection][n] * fIn;
+		bbbForceOnObjectY[b] += c[eYDirection][n] * fIn;
+		bbbForceOnObjectZ[b] += c[eZDirection][n] * fIn;
+	}
+}
+
 // ************************************************************************* //
 /// \brief	Compute forces on a BFL rigid object.
 ///
@@ -181,11 +222,11 @@ void ObjectManager::computeLiftDrag(int v, int id, GridObj *g, int markerID)
 
 	// Similar to BBB but we cannot assume that bounced-back population is the same anymore
 	pBody[0].markers[markerID].forceX +=
-		c[eXDirection][v_opp] * (g->f[v_opp + id * L_NUM_VELS] + g->fNew[v + id * L_NUM_VELS]);
+		c[eXDirection][v_opp] * (g->f[v_opp + g->popOffset(id)] + g->fNew[v + g->popOffset(id)]);
 	pBody[0].markers[markerID].forceY +=
-		c[eYDirection][v_opp] * (g->f[v_opp + id * L_NUM_VELS] + g->fNew[v + id * L_NUM_VELS]);
+		c[eYDirection][v_opp] * (g->f[v_opp + g->popOffset(id)] + g->fNew[v + g->popOffset(id)]);
 	pBody[0].markers[markerID].forceZ +=
-		c[eZDirection][v_opp] * (g->f[v_opp + id * L_NUM_VELS] + g->fNew[v + id * L_NUM_VELS]);
+		c[eZDirection][v_opp] * (g->f[v_opp + g->popOffset(id)] + g->fNew[v + g->popOffset(id)]);
 }
 
 // ************************************************************************* //
@@ -197,13 +238,16 @@ void ObjectManager::resetMomexBodyForces(GridObj * grid)
 {
 	if (grid->level == bbbOnGridLevel && grid->region_number == bbbOnGridReg)
 	{
-		bbbForceOnObjectX = 0.0;
-		bbbForceOnObjectY = 0.0;
-		bbbForceOnObjectZ = 0.0;
+		std::fill(bbbForceOnObjectX.begin(), bbbForceOnObjectX.end(), 0.0);
+		std::fill(bbbForceOnObjectY.begin(), bbbForceOnObjectY.end(), 0.0);
+		std::fill(bbbForceOnObjectZ.begin(), bbbForceOnObjectZ.end(), 0.0);
 
 #ifdef L_MOMEX_DEBUG
 		// Open file for momentum exchange information
 		toggleDebugStream(grid);
+#else
+		// Build the link list the first time round
+		if (!bbbLinksBuilt) buildMomexLinks(grid);
 #endif
 
 	}
@@ -226,6 +270,81 @@ void ObjectManager::resetMomexBodyForces(GridObj * grid)
 	}
 }
 
+// ************************************************************************* //
+/// \brief	Builds the list of fluid-body links for momentum exchange.
+///
+///			Each link is stored as the flattened index of the fluid site, 
+///			the lattice direction pointing from that site into a solid site 
+///			labelled by a BB body and the index of that body. As BB bodies 
+///			do not move, the list is built once the first time it is required.
+///
+///	\param	g	pointer to grid on which the BB body resides.
+void ObjectManager::buildMomexLinks(GridObj *g)
+{
+	// Clear any existing links
+	bbbLinkSite.clear();
+	bbbLinkDir.clear();
+	bbbLinkBody.clear();
+	bbbLinksBuilt = true;
+
+	int M_lim = g->M_lim;
+	int K_lim = g->K_lim;
+	size_t nSites = 0;
+
+	// Loop over bodies
+	for (int b = 0; b < static_cast<int>(bbbSolidSites.size()); b++)
+	{
+		std::vector<int>& sites = bbbSolidSites[b];
+
+		// The cloud may label the same site more than once
+		std::sort(sites.begin(), sites.end());
+		sites.erase(std::unique(sites.begin(), sites.end()), sites.end());
+		nSites += sites.size();
+
+		// Loop over solid sites of the body
+		for (int id : sites)
+		{
+			// Body may have been overwritten by something else
+			if (g->LatTyp[id] != eSolid) continue;
+
+			// Get indices
+			int i = id / (K_lim * M_lim);
+			int j = (id / K_lim) % M_lim;
+			int k = id % K_lim;
+
+			// For MPI builds, ignore if part of object is in halo region as represented on another rank
+#ifdef L_BUILD_FOR_MPI
+			if (GridUtils::isOnRecvLayer(g->XPos[i], g->YPos[j], g->ZPos[k])) continue;
+#endif
+
+			// Loop over directions from solid site
+			for (int n = 0; n < L_NUM_VELS; n++)
+			{
+				// Get incoming direction
+				int n_opp = GridUtils::getOpposite(n);
+
+				// Compute destination coordinates (does not assume any periodicity)
+				int xdest = i - c[eXDirection][n_opp];
+				int ydest = j - c[eYDirection][n_opp];
+				int zdest = k - c[eZDirection][n_opp];
+
+				// Objects on edges will not get a periodic contribution && only applies to fluid sites
+				if (!GridUtils::isOffGrid(xdest, ydest, zdest, g) &&
+					g->LatTyp(xdest, ydest, zdest, M_lim, K_lim) == eFluid)
+				{
+					bbbLinkSite.push_back(zdest + ydest * K_lim + xdest * K_lim * M_lim);
+					bbbLinkDir.push_back(n_opp);
+					bbbLinkBody.push_back(b);
+				}
+			}
+		}
+	}
+
+	*GridUtils::logfile << "Momentum exchange link list built with " << bbbLinkSite.size() <<
+		" links for " << nSites << " sites of " << bbbSolidSites.size() << " bodies on grid " << g->level << 
+		", region " << g->region_number << std::endl;
+}
+
 // ************************************************************************* //
 /// \brief	Adds a bounce-back body to the grid by labelling sites.
 ///
@@ -241,6 +360,11 @@ void ObjectManager::addBouncebackObject(GeomPacked *geom, PCpts *_PCpts)
 	// Store information about the body in the Object Manager
 	bbbOnGridLevel = geom->onGridLev;
 	bbbOnGridReg = geom->onGridReg;
+	bbbBodyID.push_back(geom->bodyID);
+	bbbSolidSites.emplace_back();
+	bbbForceOnObjectX.push_back(0.0);
+	bbbForceOnObjectY.push_back(0.0);
+	bbbForceOnObjectZ.push_back(0.0);
 
 	// Declarations
 	std::vector<int> ijk;
@@ -281,6 +405,10 @@ void ObjectManager::addBouncebackObject(GeomPacked *geom, PCpts *_PCpts)
 						// Change type
 						g->LatTyp(ijk[0], ijk[1], ijk[2], g->M_lim, g->K_lim) = eSolid;
 
+						// Record site for momentum exchange if on the body grid
+						if (lev == bbbOnGridLevel && reg == bbbOnGridReg)
+							bbbSolidSites.back().push_back(ijk[2] + ijk[1] * g->K_lim + ijk[0] * g->K_lim * g->M_lim);
+
 						// Change macro
 						g->u(ijk[0], ijk[1], ijk[2], 0, g->M_lim, g->K_lim, L_DIMS) = 0.0;
 						g->u(ijk[0], ijk[1], ijk[2], 1, g->M_lim, g->K_lim, L_DIMS) = 0.0;
@@ -311,6 +439,11 @@ void ObjectManager::addBouncebackObject(GridObj *g, GeomPacked *geom, PCpts *_PC
 	// Store information about the body in the Object Manager
 	bbbOnGridLevel = geom->onGridLev;
 	bbbOnGridReg = geom->onGridReg;
+	bbbBodyID.push_back(geom->bodyID);
+	bbbSolidSites.emplace_back();
+	bbbForceOnObjectX.push_back(0.0);
+	bbbForceOnObjectY.push_back(0.0);
+	bbbForceOnObjectZ.push_back(0.0);
 
 	// Declarations
 	std::vector<int> ijk;
@@ -329,6 +462,9 @@ void ObjectManager::addBouncebackObject(GridObj *g, GeomPacked *geom, PCpts *_PC
 				// Change type
 				g->LatTyp(ijk[0], ijk[1], ijk[2], g->M_lim, g->K_lim) = eSolid;
 
+				// Record site for momentum exchange
+				bbbSolidSites.back().push_back(ijk[2] + ijk[1] * g->K_lim + ijk[0] * g->K_lim * g->M_lim);
+
 				// Change macro
 				g->u(ijk[0], ijk[1], ijk[2], 0, g->M_lim, g->K_lim, L_DIMS) = 0.0;
 				g->u(ijk[0], ijk[1], ijk[2], 1, g->M_lim, g->K_lim, L_DIMS) = 0.0;
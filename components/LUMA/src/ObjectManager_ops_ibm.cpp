@@ -70,10 +70,14 @@ void ObjectManager::ibm_moveBodies(int level) {
 	mpim->mpi_forceCommGather(level);
 #endif
 
-	// Loop through flexible bodies and apply FEM
-	for (auto ib : idxFEM) {
+	// Loop through flexible bodies and apply FEM (bodies are independent so solve as a batch)
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+	for (int a = 0; a < static_cast<int>(idxFEM.size()); a++) {
 
 		// Only do if on this grid level
+		int ib = idxFEM[a];
 		if (iBody[ib]._Owner->level == level)
 			iBody[ib].fBody->dynamicFEM();
 	}
@@ -101,6 +105,9 @@ void ObjectManager::ibm_moveBodies(int level) {
 
 	// Find epsilon for the body
 	ibm_findEpsilon(level);
+
+	// Flatten the new support for the interpolate and spread kernels
+	ibm_buildSupportCache(level);
 }
 
 
@@ -119,11 +126,19 @@ void ObjectManager::ibm_subIterate(GridObj *g) {
 	// Do the while loop for sub iteration
 	do {
 
+#ifdef L_IBM_SUBIT_SUPPORT_ONLY
+		// Reset velocities and forces at the modified support sites only
+		ibm_restoreSupportVelocities(g);
+
+		// Save any sites the moved support now covers
+		ibm_saveSupportVelocities(g, false);
+#else
 		// Reset velocities to start of time step
 		g->u = g->u_n;
 
 		// Reset forces
 		g->_LBM_resetForces();
+#endif
 
 		// Apply IBM again
 		ibm_apply(g, false);
@@ -153,6 +168,9 @@ void ObjectManager::ibm_subIterate(GridObj *g) {
 
 			// Set displacement vector
 			iBody[ib].fBody->U_n = iBody[ib].fBody->U;
+
+			// Restart relaxation for the next time step
+			iBody[ib].fBody->subIt = 0;
 			iBody[ib].fBody->Udot_n = iBody[ib].fBody->Udot;
 			iBody[ib].fBody->Udotdot_n = iBody[ib].fBody->Udotdot;
 
@@ -185,6 +203,100 @@ void ObjectManager::ibm_subIterate(GridObj *g) {
 }
 
 
+// *****************************************************************************
+///	\brief	Save velocities at support sites before they are modified by IBM
+///
+///			At the start of a time step the saved set is cleared and the current
+///			support sites are stored. During sub-iteration the support moves so
+///			any newly covered sites are appended before they are modified. This
+///			replaces a copy of the whole velocity field each time step.
+///
+///	\param	g			pointer to current grid
+///	\param	bNewStep	flag to clear the saved sites at the start of a time step
+void ObjectManager::ibm_saveSupportVelocities(GridObj *g, bool bNewStep) {
+
+	int level = g->level;
+	std::vector<int> &ids = subSavedIds[level];
+	std::vector<double> &vel = subSavedVel[level];
+	std::vector<char> &flag = subSavedFlag[level];
+
+	// Allocate flags once
+	size_t nSites = static_cast<size_t>(g->N_lim) * g->M_lim * g->K_lim;
+	if (flag.size() != nSites) {
+		flag.assign(nSites, 0);
+		ids.clear();
+		vel.clear();
+	}
+
+	// Clear the previous time step's sites
+	if (bNewStep) {
+		for (auto id : ids)
+			flag[id] = 0;
+		ids.clear();
+		vel.clear();
+	}
+
+	// Support sites this rank owns for markers on this rank
+	for (size_t ib = 0; ib < iBody.size(); ib++) {
+
+		if (iBody[ib]._Owner->level != level) continue;
+
+		if (iBody[ib].suppOffset.empty())
+			ibm_buildSupportCache(level);
+
+		for (auto id : iBody[ib].suppSiteId) {
+			if (flag[id]) continue;
+			flag[id] = 1;
+			ids.push_back(id);
+			for (int d = 0; d < L_DIMS; d++)
+				vel.push_back(g->u[d + id * L_DIMS]);
+		}
+	}
+
+	// Support sites this rank owns for markers off-rank
+#ifdef L_BUILD_FOR_MPI
+	MpiManager *mpim = MpiManager::getInstance();
+	for (size_t i = 0; i < mpim->supportCommSupportSide[level].size(); i++) {
+
+		int id = mpim->supportCommSupportSide[level][i].supportIdx[eZDirection] +
+			mpim->supportCommSupportSide[level][i].supportIdx[eYDirection] * g->K_lim +
+			mpim->supportCommSupportSide[level][i].supportIdx[eXDirection] * g->K_lim * g->M_lim;
+
+		if (flag[id]) continue;
+		flag[id] = 1;
+		ids.push_back(id);
+		for (int d = 0; d < L_DIMS; d++)
+			vel.push_back(g->u[d + id * L_DIMS]);
+	}
+#endif
+}
+
+
+// *****************************************************************************
+///	\brief	Restore velocities and reset forces at saved support sites
+///
+///	\param	g			pointer to current grid
+void ObjectManager::ibm_restoreSupportVelocities(GridObj *g) {
+
+	int level = g->level;
+	std::vector<int> &ids = subSavedIds[level];
+	std::vector<double> &vel = subSavedVel[level];
+
+	for (size_t n = 0; n < ids.size(); n++) {
+
+		int id = ids[n];
+		for (int d = 0; d < L_DIMS; d++) {
+			g->u[d + id * L_DIMS] = vel[d + n * L_DIMS];
+			g->force_xyz[d + id * L_DIMS] = 0.0;
+		}
+
+#ifdef L_GRAVITY_ON
+		g->force_xyz[L_GRAVITY_DIRECTION + id * L_DIMS] = g->rho[id] * g->gravity * g->refinement_ratio;
+#endif
+	}
+}
+
+
 // *****************************************************************************
 ///	\brief	Initialise the array of iBodies
 void ObjectManager::ibm_initialise() {
@@ -243,6 +355,10 @@ void ObjectManager::ibm_initialise() {
 		ibm_debug_epsilon(ib);
 #endif
 
+	// Flatten the support for the interpolate and spread kernels
+	for (int lev = 0; lev < (levToLoop+1); lev++)
+		ibm_buildSupportCache(lev);
+
 }
 
 
@@ -292,6 +408,9 @@ void ObjectManager::ibm_findSupport(int ib) {
 	std::vector<double> nearpos(3, 0);
 	std::vector<double> estimated_position(3, 0);
 
+	// Flattened support is invalid from now on
+	iBody[ib].suppOffset.clear();
+
 	// Loop through all valid markers (which exist on this rank)
 	for (auto m : iBody[ib].validMarkers) {
 
@@ -492,84 +611,100 @@ void ObjectManager::ibm_initialiseSupport(int ib, int m, std::vector<double> &es
 
 
 // *****************************************************************************
-///	\brief	Interpolate velocity field onto markers
+///	\brief	Flatten the on-rank support of all bodies on a level
+///
+///			The support sites owned by this rank are packed into contiguous
+///			per-body arrays of flattened site indices and delta values, ordered
+///			by valid marker, so that the interpolate and spread kernels do not
+///			need to test the owning rank or rebuild indices on every call. Must
+///			be called whenever the support or the set of valid markers changes,
+///			which clear the cache so that it is also rebuilt on first use.
 ///
 ///	\param	level		current grid level
-void ObjectManager::ibm_interpolate(int level) {
+void ObjectManager::ibm_buildSupportCache(int level) {
 
 	// Get rank
 	int rank = GridUtils::safeGetRank();
 
-	// Loop through all bodies
+	// Loop through all bodies on this level
 	for (size_t ib = 0; ib < iBody.size(); ib++) {
 
-		// Only interpolate the bodies that exist on this grid level
-		if (iBody[ib]._Owner->level == level) {
+		if (iBody[ib]._Owner->level != level) continue;
 
-			// Get grid sizes
-			size_t M_lim = iBody[ib]._Owner->M_lim;
-#if (L_DIMS == 3)
-			size_t K_lim = iBody[ib]._Owner->K_lim;
-#endif
+		IBBody &body = iBody[ib];
+		int M_lim = body._Owner->M_lim;
+		int K_lim = body._Owner->K_lim;
 
-			// For each marker
-			for (auto m : iBody[ib].validMarkers) {
+		body.suppOffset.assign(1, 0);
+		body.suppSiteId.clear();
+		body.suppDelta.clear();
 
-				// Reset the values of interpolated velocity and density
-				std::fill(iBody[ib].markers[m].interpMom.begin(), iBody[ib].markers[m].interpMom.end(), 0.0);
-				iBody[ib].markers[m].interpRho = 0.0;
+		// Pack the on-rank support sites of each valid marker
+		for (auto m : body.validMarkers) {
+			for (size_t s = 0; s < body.markers[m].deltaval.size(); s++) {
 
-				// Loop over support nodes
-				for (size_t i = 0; i < iBody[ib].markers[m].deltaval.size(); i++) {
+				if (body.markers[m].support_rank[s] != rank) continue;
 
-					// Only interpolate over data this rank actually owns at the moment
-					if (rank == iBody[ib].markers[m].support_rank[i]) {
+				body.suppSiteId.push_back(body.markers[m].supp_k[s] +
+					body.markers[m].supp_j[s] * K_lim +
+					body.markers[m].supp_i[s] * K_lim * M_lim);
+				body.suppDelta.push_back(body.markers[m].deltaval[s]);
+			}
+			body.suppOffset.push_back(static_cast<int>(body.suppSiteId.size()));
+		}
+	}
+}
 
 
-						// Interpolate density
-#if (L_DIMS == 2)
-						iBody[ib].markers[m].interpRho += iBody[ib]._Owner->rho(
-								iBody[ib].markers[m].supp_i[i],
-								iBody[ib].markers[m].supp_j[i], M_lim) *
-								iBody[ib].markers[m].deltaval[i] * iBody[ib].markers[m].local_area;
-#else
-						iBody[ib].markers[m].interpRho += iBody[ib]._Owner->rho(
-								iBody[ib].markers[m].supp_i[i],
-								iBody[ib].markers[m].supp_j[i],
-								iBody[ib].markers[m].supp_k[i],
-								M_lim, K_lim) *
-								iBody[ib].markers[m].deltaval[i] * iBody[ib].markers[m].local_area;
-#endif
+// *****************************************************************************
+///	\brief	Interpolate velocity field onto markers
+///
+///	\param	level		current grid level
+void ObjectManager::ibm_interpolate(int level) {
+
+	// Loop through all bodies
+	for (size_t ib = 0; ib < iBody.size(); ib++) {
 
-						// Loop over directions x y z
-						for (int dir = 0; dir < L_DIMS; dir++) {
+		// Only interpolate the bodies that exist on this grid level
+		if (iBody[ib]._Owner->level == level) {
 
-							// Read given velocity component from support node, multiply by delta function
-							// for that support node and sum to get interpolated velocity.
-#if (L_DIMS == 2)
+			// Raw pointers to the fields being interpolated
+			IBBody &body = iBody[ib];
+			if (body.suppOffset.empty())
+				ibm_buildSupportCache(level);
+			const double *rho = body._Owner->rho.data();
+			const double *u = body._Owner->u.data();
+			const int nMarkers = static_cast<int>(body.validMarkers.size());
 
-							iBody[ib].markers[m].interpMom[dir] += iBody[ib]._Owner->rho(
-									iBody[ib].markers[m].supp_i[i],
-									iBody[ib].markers[m].supp_j[i], M_lim) *
-									iBody[ib]._Owner->u(
-									iBody[ib].markers[m].supp_i[i],
-									iBody[ib].markers[m].supp_j[i],
-									dir, M_lim, L_DIMS) * iBody[ib].markers[m].deltaval[i] * iBody[ib].markers[m].local_area;
-#else
-							iBody[ib].markers[m].interpMom[dir] += iBody[ib]._Owner->rho(
-									iBody[ib].markers[m].supp_i[i],
-									iBody[ib].markers[m].supp_j[i],
-									iBody[ib].markers[m].supp_k[i],
-									M_lim, K_lim) *
-									iBody[ib]._Owner->u(
-									iBody[ib].markers[m].supp_i[i],
-									iBody[ib].markers[m].supp_j[i],
-									iBody[ib].markers[m].supp_k[i],
-									dir, M_lim, K_lim, L_DIMS) * iBody[ib].markers[m].deltaval[i] * iBody[ib].markers[m].local_area;
+			// For each marker
+#ifdef L_ENABLE_OPENMP
+#pragma omp parallel for
 #endif
-						}
-					}
+			for (int n = 0; n < nMarkers; n++) {
+
+				IBMarker &marker = body.markers[body.validMarkers[n]];
+				double rhoSum = 0.0;
+				double momSum[L_DIMS] = { 0.0 };
+
+				// Loop over the support sites this rank owns
+				for (int s = body.suppOffset[n]; s < body.suppOffset[n + 1]; s++) {
+
+					const int id = body.suppSiteId[s];
+					const double rhoDelta = rho[id] * body.suppDelta[s];
+
+					// Interpolate density
+					rhoSum += rhoDelta;
+
+					// Interpolate momentum in each direction
+					for (int dir = 0; dir < L_DIMS; dir++)
+						momSum[dir] += rhoDelta * u[dir + id * L_DIMS];
 				}
+
+				// Scale by area and store
+				std::fill(marker.interpMom.begin(), marker.interpMom.end(), 0.0);
+				marker.interpRho = rhoSum * marker.local_area;
+				for (int dir = 0; dir < L_DIMS; dir++)
+					marker.interpMom[dir] = momSum[dir] * marker.local_area;
 			}
 		}
 	}
@@ -620,53 +755,40 @@ void ObjectManager::ibm_computeForce(int level) {
 ///	\param	level		current grid level
 void ObjectManager::ibm_spread(int level) {
 
-	// Get rank
-	int rank = GridUtils::safeGetRank();
-
 	// Loop through bodies
 	for (size_t ib = 0; ib < iBody.size(); ib++) {
 
 		// Only spread the bodies that exist on this grid level
 		if (iBody[ib]._Owner->level == level) {
 
-			// Get volume scaling
-			double volWidth, volDepth;
+			// Raw pointer to the grid force
+			IBBody &body = iBody[ib];
+			if (body.suppOffset.empty())
+				ibm_buildSupportCache(level);
+			double *force = body._Owner->force_xyz.data();
+			const int nMarkers = static_cast<int>(body.validMarkers.size());
 
-			// Get grid sizes
-			size_t M_lim = iBody[ib]._Owner->M_lim;
-			size_t K_lim = iBody[ib]._Owner->K_lim;
+			// Loop through markers (serial as markers may share support sites)
+			for (int n = 0; n < nMarkers; n++) {
 
-			// Loop through markers
-			for (auto m : iBody[ib].validMarkers) {
+				IBMarker &marker = body.markers[body.validMarkers[n]];
 
-				// Loop through support sites
-				for (size_t s = 0; s < iBody[ib].markers[m].deltaval.size(); s++) {
-
-					// Only spread over data this rank actually owns at the moment
-					if (rank == iBody[ib].markers[m].support_rank[s]) {
-
-						// Set volume scaling
-						volWidth = iBody[ib].markers[m].epsilon;
-						volDepth = 1.0;
+				// Marker force scaled by volume
+				double volDepth = 1.0;
 #if (L_DIMS == 3)
-						volDepth = iBody[ib].markers[m].ds;
+				volDepth = marker.ds;
 #endif
+				double markerForce[L_DIMS];
+				for (int dir = 0; dir < L_DIMS; dir++)
+					markerForce[dir] = marker.force_xyz[dir] * marker.epsilon * volDepth * marker.ds;
 
-						// Loop over directions x y z
-						for (size_t dir = 0; dir < L_DIMS; dir++) {
-
-							// Add contribution of current marker force to support node Cartesian force vector using delta values computed when support was computed
-							iBody[ib]._Owner->force_xyz(
-									iBody[ib].markers[m].supp_i[s],
-									iBody[ib].markers[m].supp_j[s],
-									iBody[ib].markers[m].supp_k[s],
-									dir, M_lim, K_lim, L_DIMS) -=
-									iBody[ib].markers[m].deltaval[s] *
-									iBody[ib].markers[m].force_xyz[dir] *
-									volWidth * volDepth *
-									iBody[ib].markers[m].ds;
-						}
-					}
+				// Add contribution of current marker force to the support sites this rank owns
+				for (int s = body.suppOffset[n]; s < body.suppOffset[n + 1]; s++) {
+
+					const int id = body.suppSiteId[s];
+					const double delta = body.suppDelta[s];
+					for (int dir = 0; dir < L_DIMS; dir++)
+						force[dir + id * L_DIMS] -= delta * markerForce[dir];
 				}
 			}
 		}
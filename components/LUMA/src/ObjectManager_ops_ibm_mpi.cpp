@@ -52,11 +52,11 @@ void ObjectManager::ibm_interpolateOffRankVels(int level) {
 	MpiManager *mpim = MpiManager::getInstance();
 
 	// Perform interpolation communication
-	std::vector<std::vector<double>> interpVels;
-	mpim->mpi_interpolateComm(level, interpVels);
+	mpim->mpi_interpolateComm(level);
+	const std::vector<double> &interpVels = mpim->interpolateComm[level].recvBuffer;
 
-	// Create idx vector
-	std::vector<int> idx(mpim->num_ranks, 0);
+	// Create idx vector starting at each rank's offset in the receive buffer
+	std::vector<int> idx(mpim->interpolateComm[level].recvDisps.begin(), mpim->interpolateComm[level].recvDisps.end() - 1);
 
 	// Now interpolate these remaining values onto the marker
 	int ib, m, s, fromRank;
@@ -74,14 +74,14 @@ void ObjectManager::ibm_interpolateOffRankVels(int level) {
 			fromRank = mpim->supportCommMarkerSide[level][i].rankComm;
 
 			// Interpolate density
-			iBody[ib].markers[m].interpRho += interpVels[fromRank][idx[fromRank]] * iBody[ib].markers[m].deltaval[s] * iBody[ib].markers[m].local_area;
+			iBody[ib].markers[m].interpRho += interpVels[idx[fromRank]] * iBody[ib].markers[m].deltaval[s] * iBody[ib].markers[m].local_area;
 
 			// Shift index
 			idx[fromRank]++;
 
 			// Interpolate these values
 			for (int dir = 0; dir < L_DIMS; dir++)
-				iBody[ib].markers[m].interpMom[dir] += interpVels[fromRank][dir+idx[fromRank]] * iBody[ib].markers[m].deltaval[s] * iBody[ib].markers[m].local_area;
+				iBody[ib].markers[m].interpMom[dir] += interpVels[dir+idx[fromRank]] * iBody[ib].markers[m].deltaval[s] * iBody[ib].markers[m].local_area;
 
 			// Shift index
 			idx[fromRank] += L_DIMS;
@@ -99,12 +99,12 @@ void ObjectManager::ibm_spreadOffRankForces(int level) {
 	// Get the mpi manager instance
 	MpiManager *mpim = MpiManager::getInstance();
 
-	// Perform interpolation communication
-	std::vector<std::vector<double>> spreadForces;
-	mpim->mpi_spreadComm(level, spreadForces);
+	// Perform spreading communication
+	mpim->mpi_spreadComm(level);
+	const std::vector<double> &spreadForces = mpim->spreadComm[level].recvBuffer;
 
-	// Create idx vector
-	std::vector<int> idx(mpim->num_ranks, 0);
+	// Create idx vector starting at each rank's offset in the receive buffer
+	std::vector<int> idx(mpim->spreadComm[level].recvDisps.begin(), mpim->spreadComm[level].recvDisps.end() - 1);
 	std::vector<int> suppIdx(3, 0);
 
 	// Now interpolate these remaining values onto the marker
@@ -128,7 +128,7 @@ void ObjectManager::ibm_spreadOffRankForces(int level) {
 			// Interpolate these values
 			for (int dir = 0; dir < L_DIMS; dir++)
 				iBody[ib]._Owner->force_xyz(suppIdx[eXDirection], suppIdx[eYDirection], suppIdx[eZDirection], dir, M_lim, K_lim, L_DIMS) -=
-						spreadForces[fromRank][idx[fromRank] + dir];
+						spreadForces[idx[fromRank] + dir];
 
 			// Shift index
 			idx[fromRank] += L_DIMS;
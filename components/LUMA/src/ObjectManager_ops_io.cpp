@@ -805,7 +805,9 @@ void ObjectManager::io_readInGeomConfig() {
 /// \brief	Read in point cloud data
 ///
 ///			Input data must be in tab separated, 3-column format in the input
-///			directory.
+///			directory. Files with a .bin extension are instead read as raw 
+///			float32 X, Y, Z triplets with each rank reading a different chunk 
+///			and the points then sent to the ranks on which they lie.
 ///
 ///	\param	_PCpts		reference to pointer to empty point cloud data container
 ///	\param	geom		structure containing object data as parsed from the config file
@@ -819,13 +821,9 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 	// Case-specific variables
 	GridObj* g = NULL;
 
-	// Open input file
-	std::ifstream file;
-	file.open("./input/" + geom->fileName, std::ios::in);
-
-	// Handle failure to open
-	if (!file.is_open())
-		L_ERROR("Error opening cloud input file: " + geom->fileName + ". Exiting.", GridUtils::logfile);
+	// Binary clouds are read collectively so every rank must take part
+	bool bBinaryCloud = geom->fileName.size() > 4 &&
+		geom->fileName.compare(geom->fileName.size() - 4, 4, ".bin") == 0;
 
 	// If the level is set to -1 then object can span levels
 	if (geom->onGridLev < 0)
@@ -842,10 +840,10 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 		GridUtils::getGrid(_Grids, geom->onGridLev, geom->onGridReg, g);
 
 		// Return if this process does not have this grid
-		if (g == NULL) return;
+		if (g == NULL && !bBinaryCloud) return;
 
 		// Set scaling
-		dCell = g->dh;
+		dCell = (g != NULL) ? g->dh : _Grids[0].dh / pow(2, geom->onGridLev);
 	}
 
 	// Round reference values to complete number of voxels as measured from origin
@@ -864,44 +862,70 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 	L_DEBUG(msg, GridUtils::logfile);
 #endif
 
-	// Loop over lines in file
-	while (!file.eof()) {
+	// Extent of the whole cloud
+	double cloudMin[3], cloudMax[3];
 
-		// Read in one line of file at a time
-		std::string line_in;	// String to store line in
-		std::istringstream iss;	// Buffer stream to store characters
+	if (bBinaryCloud)
+	{
+		// Read this rank's chunk of the binary file
+		io_readInBinaryCloud(_PCpts, geom->fileName, cloudMin, cloudMax);
+	}
+	else
+	{
+		// Open input file
+		std::ifstream file;
+		file.open("./input/" + geom->fileName, std::ios::in);
+
+		// Handle failure to open
+		if (!file.is_open())
+			L_ERROR("Error opening cloud input file: " + geom->fileName + ". Exiting.", GridUtils::logfile);
+
+		// Loop over lines in file
+		while (!file.eof()) {
+
+			// Read in one line of file at a time
+			std::string line_in;	// String to store line in
+			std::istringstream iss;	// Buffer stream to store characters
 
-		// Get line up to new line separator and put in buffer
-		std::getline(file, line_in, '\n');
-		iss.str(line_in);	// Put line in the buffer
-		iss.seekg(0);		// Reset buffer position to start of buffer
+			// Get line up to new line separator and put in buffer
+			std::getline(file, line_in, '\n');
+			iss.str(line_in);	// Put line in the buffer
+			iss.seekg(0);		// Reset buffer position to start of buffer
 
-		// Add coordinates to data store
-		iss >> tmp_x;
-		iss >> tmp_y;
-		iss >> tmp_z;
+			// Add coordinates to data store
+			iss >> tmp_x;
+			iss >> tmp_y;
+			iss >> tmp_z;
 
-		_PCpts->x.push_back(tmp_x);
-		_PCpts->y.push_back(tmp_y);
+			_PCpts->x.push_back(tmp_x);
+			_PCpts->y.push_back(tmp_y);
 
-		// If running a 2D calculation, only read in x and y coordinates and force z coordinates to match the domain
+			// If running a 2D calculation, only read in x and y coordinates and force z coordinates to match the domain
 #if (L_DIMS == 3)
-		_PCpts->z.push_back(tmp_z);
+			_PCpts->z.push_back(tmp_z);
 #else
-		_PCpts->z.push_back(0);
+			_PCpts->z.push_back(0);
 #endif
 
-		// Insert the ID of the point within this point cloud (needed later for assigning marker IDs)
-		_PCpts->id.push_back(static_cast<int>(_PCpts->id.size()));
+			// Insert the ID of the point within this point cloud (needed later for assigning marker IDs)
+			_PCpts->id.push_back(static_cast<int>(_PCpts->id.size()));
 
-	}
-	file.close();
+		}
+		file.close();
 
-	// Error if no data
-	if (_PCpts->x.empty() || _PCpts->y.empty() || _PCpts->z.empty())
-		L_ERROR("Failed to read object data from cloud input file.", GridUtils::logfile);
-	else
-		L_INFO("Successfully acquired object data from cloud input file.", GridUtils::logfile);
+		// Error if no data
+		if (_PCpts->x.empty() || _PCpts->y.empty() || _PCpts->z.empty())
+			L_ERROR("Failed to read object data from cloud input file.", GridUtils::logfile);
+
+		// Get extent
+		cloudMin[eXDirection] = *std::min_element(_PCpts->x.begin(), _PCpts->x.end());
+		cloudMin[eYDirection] = *std::min_element(_PCpts->y.begin(), _PCpts->y.end());
+		cloudMin[eZDirection] = *std::min_element(_PCpts->z.begin(), _PCpts->z.end());
+		cloudMax[eXDirection] = *std::max_element(_PCpts->x.begin(), _PCpts->x.end());
+		cloudMax[eYDirection] = *std::max_element(_PCpts->y.begin(), _PCpts->y.end());
+		cloudMax[eZDirection] = *std::max_element(_PCpts->z.begin(), _PCpts->z.end());
+	}
+	L_INFO("Successfully acquired object data from cloud input file.", GridUtils::logfile);
 
 
 	// Rescale coordinates to fit into size required
@@ -914,17 +938,17 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 	if (geom->scaleDirection == eXDirection)
 	{
 		scale_factor = (bodyLength - 2 * L_SMALL_NUMBER * dCell) /
-			std::fabs(*std::max_element(_PCpts->x.begin(), _PCpts->x.end()) - *std::min_element(_PCpts->x.begin(), _PCpts->x.end()));
+			std::fabs(cloudMax[eXDirection] - cloudMin[eXDirection]);
 	}
 	else if (geom->scaleDirection == eYDirection)
 	{
 		scale_factor = (bodyLength - 2 * L_SMALL_NUMBER * dCell) /
-			std::fabs(*std::max_element(_PCpts->y.begin(), _PCpts->y.end()) - *std::min_element(_PCpts->y.begin(), _PCpts->y.end()));
+			std::fabs(cloudMax[eYDirection] - cloudMin[eYDirection]);
 	}
 	else if (geom->scaleDirection == eZDirection)
 	{
 		scale_factor = (bodyLength - 2 * L_SMALL_NUMBER * dCell) /
-		std::fabs(*std::max_element(_PCpts->z.begin(), _PCpts->z.end()) - *std::min_element(_PCpts->z.begin(), _PCpts->z.end()));
+		std::fabs(cloudMax[eZDirection] - cloudMin[eZDirection]);
 	}
 
 	// If reference is a centre, shift to centre of voxel
@@ -932,43 +956,40 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 	if (geom->isRefXCentre)
 	{
 		bodyRefX += (dCell / 2.0);
-		scaledDistance = scale_factor * 
-			std::fabs(*std::max_element(_PCpts->x.begin(), _PCpts->x.end()) - *std::min_element(_PCpts->x.begin(), _PCpts->x.end()));
+		scaledDistance = scale_factor * std::fabs(cloudMax[eXDirection] - cloudMin[eXDirection]);
 		scaledDistance = std::round(scaledDistance / dCell) * dCell;	// Round to nearest voxel multiple
 		startPos = bodyRefX - (scaledDistance / 2.0);
-		shiftX = startPos - scale_factor * *std::min_element(_PCpts->x.begin(), _PCpts->x.end());
+		shiftX = startPos - scale_factor * cloudMin[eXDirection];
 	}
 	else
 	{
-		shiftX = (bodyRefX + L_SMALL_NUMBER * dCell) - scale_factor * *std::min_element(_PCpts->x.begin(), _PCpts->x.end());
+		shiftX = (bodyRefX + L_SMALL_NUMBER * dCell) - scale_factor * cloudMin[eXDirection];
 	}
 
 	if (geom->isRefYCentre)
 	{
 		bodyRefY += (dCell / 2.0);
-		scaledDistance = scale_factor *
-			std::fabs(*std::max_element(_PCpts->y.begin(), _PCpts->y.end()) - *std::min_element(_PCpts->y.begin(), _PCpts->y.end()));
+		scaledDistance = scale_factor * std::fabs(cloudMax[eYDirection] - cloudMin[eYDirection]);
 		scaledDistance = std::round(scaledDistance / dCell) * dCell;
 		startPos = bodyRefY - (scaledDistance / 2.0);
-		shiftY = startPos - scale_factor * *std::min_element(_PCpts->y.begin(), _PCpts->y.end());
+		shiftY = startPos - scale_factor * cloudMin[eYDirection];
 	}
 	else
 	{
-		shiftY = (bodyRefY + L_SMALL_NUMBER * dCell) - scale_factor * *std::min_element(_PCpts->y.begin(), _PCpts->y.end());
+		shiftY = (bodyRefY + L_SMALL_NUMBER * dCell) - scale_factor * cloudMin[eYDirection];
 	}
 
 	if (geom->isRefZCentre)
 	{
 		bodyRefZ += (dCell / 2.0);
-		scaledDistance = scale_factor *
-			std::fabs(*std::max_element(_PCpts->z.begin(), _PCpts->z.end()) - *std::min_element(_PCpts->z.begin(), _PCpts->z.end()));
+		scaledDistance = scale_factor * std::fabs(cloudMax[eZDirection] - cloudMin[eZDirection]);
 		scaledDistance = std::round(scaledDistance / dCell) * dCell;
 		startPos = bodyRefZ - (scaledDistance / 2.0);
-		shiftZ = startPos - scale_factor * *std::min_element(_PCpts->z.begin(), _PCpts->z.end());
+		shiftZ = startPos - scale_factor * cloudMin[eZDirection];
 	}
 	else
 	{
-		shiftZ = (bodyRefZ + L_SMALL_NUMBER * dCell) - scale_factor * *std::min_element(_PCpts->z.begin(), _PCpts->z.end());
+		shiftZ = (bodyRefZ + L_SMALL_NUMBER * dCell) - scale_factor * cloudMin[eZDirection];
 	}
 
 	// Declare local indices
@@ -987,8 +1008,8 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 		_PCpts->z[a] *= scale_factor; _PCpts->z[a] += shiftZ;
 #endif
 
-		// Apply a rank filter at the same time
-		if (GridUtils::isOnThisRank(_PCpts->x[a], _PCpts->y[a], _PCpts->z[a], &loc, g))
+		// Apply a rank filter at the same time (binary chunks are filtered once distributed)
+		if (bBinaryCloud || GridUtils::isOnThisRank(_PCpts->x[a], _PCpts->y[a], _PCpts->z[a], &loc, g))
 		{
 			_filtered->x.push_back(_PCpts->x[a]);
 			_filtered->y.push_back(_PCpts->y[a]);
@@ -998,6 +1019,37 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 
 	}
 
+	// Send the points of each chunk to the ranks on which they lie
+#ifdef L_BUILD_FOR_MPI
+	if (bBinaryCloud)
+		MpiManager::getInstance()->mpi_ptCloudDistribute(_filtered);
+#endif
+
+	// Nothing more to do if this process does not have this grid
+	if (g == NULL)
+	{
+		delete _filtered;
+		return;
+	}
+
+	// Distributed binary points only carry rank ownership so apply the grid filter now
+	if (bBinaryCloud)
+	{
+		PCpts *_owned = new PCpts();
+		for (a = 0; a < static_cast<int>(_filtered->x.size()); a++)
+		{
+			if (GridUtils::isOnThisRank(_filtered->x[a], _filtered->y[a], _filtered->z[a], &loc, g))
+			{
+				_owned->x.push_back(_filtered->x[a]);
+				_owned->y.push_back(_filtered->y[a]);
+				_owned->z.push_back(_filtered->z[a]);
+				_owned->id.push_back(_filtered->id[a]);
+			}
+		}
+		delete _filtered;
+		_filtered = _owned;
+	}
+
 	// Free old array and assign new array to pointer which will be passed back out
 	delete _PCpts;
 	_PCpts = _filtered;
@@ -1051,6 +1103,103 @@ void ObjectManager::io_readInCloud(PCpts*& _PCpts, GeomPacked *geom)
 }
 
 
+// *****************************************************************************
+/// \brief	Read in a binary point cloud
+///
+///			The file is a sequence of float32 X, Y, Z triplets with no header. 
+///			For MPI builds each rank reads a contiguous chunk of points with a 
+///			collective read and the extent of the whole cloud is then found by
+///			reduction. Point IDs are the position of the point in the file.
+///
+///	\param	_PCpts		pointer to empty point cloud data container
+///	\param	fileName	name of file in the input directory
+///	\param	cloudMin	minimum X, Y, Z of the whole cloud
+///	\param	cloudMax	maximum X, Y, Z of the whole cloud
+void ObjectManager::io_readInBinaryCloud(PCpts *_PCpts, const std::string &fileName, double *cloudMin, double *cloudMax)
+{
+	std::string path = "./input/" + fileName;
+	std::vector<float> buffer;
+	long long nPoints, start;
+
+#ifdef L_BUILD_FOR_MPI
+	MpiManager *mpim = MpiManager::getInstance();
+
+	// Open file on all ranks
+	MPI_File fh;
+	if (MPI_File_open(mpim->world_comm, const_cast<char*>(path.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL, &fh) != MPI_SUCCESS)
+		L_ERROR("Error opening cloud input file: " + fileName + ". Exiting.", GridUtils::logfile);
+
+	// Split the points evenly between ranks
+	MPI_Offset fileSize;
+	MPI_File_get_size(fh, &fileSize);
+	nPoints = static_cast<long long>(fileSize) / (3 * sizeof(float));
+	start = nPoints * mpim->my_rank / mpim->num_ranks;
+	long long end = nPoints * (mpim->my_rank + 1) / mpim->num_ranks;
+
+	// Read chunk
+	buffer.resize(3 * (end - start));
+	MPI_File_read_at_all(fh, static_cast<MPI_Offset>(start * 3 * sizeof(float)), buffer.data(),
+		static_cast<int>(buffer.size()), MPI_FLOAT, MPI_STATUS_IGNORE);
+	MPI_File_close(&fh);
+#else
+
+	// Read the whole file
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		L_ERROR("Error opening cloud input file: " + fileName + ". Exiting.", GridUtils::logfile);
+	file.seekg(0, std::ios::end);
+	nPoints = static_cast<long long>(file.tellg()) / (3 * sizeof(float));
+	start = 0;
+	file.seekg(0, std::ios::beg);
+	buffer.resize(3 * nPoints);
+	file.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(float));
+	file.close();
+#endif
+
+	// Error if no data
+	if (nPoints == 0)
+		L_ERROR("Failed to read object data from cloud input file.", GridUtils::logfile);
+
+	// Unpack into the point cloud and get extent of this chunk
+	size_t nLocal = buffer.size() / 3;
+	_PCpts->x.resize(nLocal);
+	_PCpts->y.resize(nLocal);
+	_PCpts->z.resize(nLocal, 0.0);
+	_PCpts->id.resize(nLocal);
+	for (int d = 0; d < 3; d++)
+	{
+		cloudMin[d] = std::numeric_limits<double>::max();
+		cloudMax[d] = std::numeric_limits<double>::lowest();
+	}
+	for (size_t a = 0; a < nLocal; a++)
+	{
+		_PCpts->x[a] = buffer[a * 3];
+		_PCpts->y[a] = buffer[a * 3 + 1];
+
+		// If running a 2D calculation force z coordinates to match the domain
+#if (L_DIMS == 3)
+		_PCpts->z[a] = buffer[a * 3 + 2];
+#endif
+		_PCpts->id[a] = static_cast<int>(start + a);
+
+		cloudMin[eXDirection] = std::min(cloudMin[eXDirection], _PCpts->x[a]);
+		cloudMin[eYDirection] = std::min(cloudMin[eYDirection], _PCpts->y[a]);
+		cloudMin[eZDirection] = std::min(cloudMin[eZDirection], _PCpts->z[a]);
+		cloudMax[eXDirection] = std::max(cloudMax[eXDirection], _PCpts->x[a]);
+		cloudMax[eYDirection] = std::max(cloudMax[eYDirection], _PCpts->y[a]);
+		cloudMax[eZDirection] = std::max(cloudMax[eZDirection], _PCpts->z[a]);
+	}
+
+	// Get extent of the whole cloud
+#ifdef L_BUILD_FOR_MPI
+	MPI_Allreduce(MPI_IN_PLACE, cloudMin, 3, MPI_DOUBLE, MPI_MIN, mpim->world_comm);
+	MPI_Allreduce(MPI_IN_PLACE, cloudMax, 3, MPI_DOUBLE, MPI_MAX, mpim->world_comm);
+#endif
+
+	*GridUtils::logfile << "Read " << nLocal << " of " << nPoints << " points from binary cloud file " << fileName << std::endl;
+}
+
+
 // *****************************************************************************
 /// \brief	Write out the forces on a solid object
 ///
@@ -1081,18 +1230,22 @@ void ObjectManager::io_writeForcesOnObjects(double tval) {
 		fout.open(fileName.str().c_str(), std::ios::out | std::ios::app);
 
 		// Write out the header (first time step only)
-		if (static_cast<int>(tval) == L_EXTRA_OUT_FREQ) fout << "Time,Fx,Fy,Fz" << std::endl;
+		if (static_cast<int>(tval) == L_EXTRA_OUT_FREQ) fout << "Time,BodyID,Fx,Fy,Fz" << std::endl;
 
-		// Scaled with respect to refinement ratio
-		fout << std::to_string(tval) << ","
-			<< std::to_string(bbbForceOnObjectX * g->refinement_ratio) << ","
-			<< std::to_string(bbbForceOnObjectY * g->refinement_ratio) << ","
+		// One line per body, scaled with respect to refinement ratio
+		for (size_t b = 0; b < bbbBodyID.size(); b++)
+		{
+			fout << std::to_string(tval) << ","
+				<< std::to_string(bbbBodyID[b]) << ","
+				<< std::to_string(bbbForceOnObjectX[b] * g->refinement_ratio) << ","
+				<< std::to_string(bbbForceOnObjectY[b] * g->refinement_ratio) << ","
 #if (dims == 3)
-			<< std::to_string(bbbForceOnObjectZ * g->refinement_ratio)
+				<< std::to_string(bbbForceOnObjectZ[b] * g->refinement_ratio)
 #else
-			<< std::to_string(0.0)
+				<< std::to_string(0.0)
 #endif
-			<< std::endl;
+				<< std::endl;
+		}
 
 		fout.close();
 	}
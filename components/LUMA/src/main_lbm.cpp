@@ -51,6 +51,7 @@
 #include "../inc/ObjectManager.h"	// Object manager class definition
 #include "../inc/PCpts.h"			// Point cloud class
 #include "../inc/TimingWriter.h"	// Timing data writer class definition
+#include "../inc/ExtractManager.h"	// Extract manager class definition
 
 #ifdef L_ACTIVATE_PLE	//
 #include "../inc/PLEAdapter.h"
@@ -375,6 +376,11 @@ int main( int argc, char* argv[] )
 
 #endif
 
+#ifdef L_SPARSE_STORAGE
+	// Site labels are now final so drop population storage of inactive sites
+	Grids->LBM_compactStorage();
+#endif
+
 	/*
 	****************************************************************************
 	*************************** CLOSE INITIALISATION ***************************
@@ -402,6 +408,13 @@ int main( int argc, char* argv[] )
 
 #endif
 
+#ifdef L_EXTRACT_OUTPUT
+	// Read in extract definitions and locate their sites
+	ExtractManager *extMan = ExtractManager::getInstance();
+	extMan->io_readInExtractConfig();
+	extMan->initialise(Grids);
+#endif
+
 	// Write out t = 0
 #ifdef L_TEXTOUT
 	L_INFO("Writing out to <Grids.out>...", GridUtils::logfile);
@@ -459,6 +472,11 @@ int main( int argc, char* argv[] )
 	}
 #endif	// L_PROBE_OUTPUT
 
+#ifdef L_EXTRACT_OUTPUT
+	L_INFO("Initial extract write out...", GridUtils::logfile);
+	extMan->io_writeExtracts(Grids->t);
+#endif
+
 #ifdef L_BUILD_FOR_MPI
 	// Barrier before recording completion of initialisation
 	MPI_Barrier(mpim->world_comm);
@@ -665,6 +683,15 @@ int main( int argc, char* argv[] )
 		}
 #endif
 
+		// Extract output has different frequency
+#ifdef L_EXTRACT_OUTPUT
+		if (Grids->t % L_EXTRACT_OUT_FREQ == 0)
+		{
+			L_INFO("Extract write out...", GridUtils::logfile);
+			extMan->io_writeExtracts(Grids->t);
+		}
+#endif
+
 
 		/////////////////////////
 		// Restart File Output //
@@ -783,6 +810,9 @@ int main( int argc, char* argv[] )
 	logfile.close();
 
 	// Destroy singletons
+#ifdef L_EXTRACT_OUTPUT
+	ExtractManager::destroyInstance();
+#endif
 	ObjectManager::destroyInstance();
 	MpiManager::destroyInstance();
 	GridManager::destroyInstance();
@@ -0,0 +1,424 @@
+/*
+* --------------------------------------------------------------
+*
+* ------ Lattice Boltzmann @ The University of Manchester ------
+*
+* -------------------------- L-U-M-A ---------------------------
+*
+*  Copyright (C) The University of Manchester 2017
+*  E-mail contact: info@luma.manchester.ac.uk
+*
+* This software is for academic use only and not available for
+* further distribution commericially or otherwise without written consent.
+*
+*/
+
+#ifndef IMAGEDATACONVERTER_H
+#define IMAGEDATACONVERTER_H
+
+#include "h5mgm.h"
+#include <mpi.h>
+
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkXMLImageDataWriter.h"
+
+/*
+* Parallel, streaming converter which writes each LUMA grid as a uniform
+* vtkImageData block rather than merging all grids into one voxel mesh.
+* Every (timestep, grid) pair is an independent work item and items are
+* distributed round-robin across MPI ranks. A rank only ever holds one grid
+* at one timestep in memory. Sites which are refined, transition to a coarser
+* grid or are cut are blanked using the VTK ghost array. Rank 0 writes a
+* multiblock index (.vtm) for each timestep and a .pvd collection so the
+* series can be opened directly in Paraview.
+*/
+class ImageDataConverter
+{
+
+public:
+
+	ImageDataConverter(std::string case_num, int rank, int num_ranks)
+		: case_num(case_num), rank(rank), num_ranks(num_ranks), dimensions_p(3),
+		levels(1), regions(1), timesteps(0), out_every(1), mpi_flag(0) {};
+	~ImageDataConverter() {};
+
+	// Wrapper
+	void convert()
+	{
+		// Read global attributes from L0 file
+		if (!readGlobalAttributes())
+		{
+			writeInfo("Cannot read attributes from L0 file -- exiting early.", eFatal);
+			return;
+		}
+
+		// Read the layout of each grid
+		for (int lev = 0; lev < levels; lev++) {
+			for (int reg = 0; reg < regions; reg++) {
+
+				// L0 doesn't have different regions
+				if (lev == 0 && reg != 0) continue;
+
+				GridInfo gi;
+				gi.lev = lev;
+				gi.reg = reg;
+				if (readGridInfo(gi)) grids.push_back(gi);
+			}
+		}
+
+		// Build list of time steps
+		std::vector<size_t> times;
+		for (size_t t = 0; t <= (size_t)timesteps; t += out_every) times.push_back(t);
+
+		// Create a directory for the blocks of each time step
+		if (rank == 0)
+		{
+			for (size_t t : times)
+			{
+				std::string command = "mkdir -p " + std::string(H5MGM_OUTPUT_PATH) + "/" + blockDirectory(t);
+				system(command.c_str());
+			}
+		}
+		MPI_Barrier(MPI_COMM_WORLD);
+
+		// Process work items owned by this rank
+		size_t num_items = times.size() * grids.size();
+		std::vector<int> success(num_items, 1);
+		for (size_t n = rank; n < num_items; n += num_ranks)
+		{
+			size_t ti = n / grids.size();
+			size_t gi = n % grids.size();
+			success[n] = convertBlock(times[ti], grids[gi]) ? 1 : 0;
+
+			if (rank == 0)
+			{
+				std::cout << "\r" << std::to_string((int)(((float)(n + 1) /
+					(float)num_items) * 100.0f)) << "% complete." << std::flush;
+			}
+		}
+
+		// Collect status of all items on rank 0
+		std::vector<int> all_success(num_items, 0);
+		MPI_Reduce(success.data(), all_success.data(), static_cast<int>(num_items),
+			MPI_INT, MPI_MIN, 0, MPI_COMM_WORLD);
+
+		// Write multiblock index files and time series collection
+		if (rank == 0)
+		{
+			std::cout << std::endl;
+			writeIndexFiles(times, all_success);
+		}
+	}
+
+private:
+
+	// Layout of a single grid
+	struct GridInfo
+	{
+		int lev;				// Level
+		int reg;				// Region
+		int gridsize[3];		// Number of sites in each direction
+		double dx;				// Lattice spacing
+		double origin[3];		// Position of the lower corner of the first cell
+	};
+
+	std::string case_num;			// Case number used in file names
+	int rank;						// Rank of this process
+	int num_ranks;					// Number of processes
+	int dimensions_p;				// Dimensionality of the simulation
+	int levels;						// Number of levels
+	int regions;					// Number of regions
+	int timesteps;					// Final time step
+	int out_every;					// Output frequency
+	int mpi_flag;					// Flag indicating an MPI build wrote the files
+	std::vector<GridInfo> grids;	// Layout of each grid
+
+
+	// Input file name for a grid
+	static std::string inputFileName(int lev, int reg)
+	{
+		return "./hdf_R" + std::to_string(reg) + "N" + std::to_string(lev) + ".h5";
+	}
+
+	// Block directory relative to the output path
+	std::string blockDirectory(size_t t) const
+	{
+		return "luma_" + case_num + "." + std::to_string(t);
+	}
+
+	// Block file name relative to the output path
+	std::string blockFileName(size_t t, const GridInfo& gi) const
+	{
+		return blockDirectory(t) + "/L" + std::to_string(gi.lev) + "R" + std::to_string(gi.reg) + ".vti";
+	}
+
+	// Read an attribute from an open file
+	template <typename T>
+	static bool readAttribute(hid_t fid, std::string name, hid_t H5Type, T *buffer)
+	{
+		hid_t aid = H5Aopen(fid, name.c_str(), H5P_DEFAULT);
+		if (aid <= 0)
+		{
+			writeInfo("Cannot open attribute " + name + "!", eHDF);
+			return false;
+		}
+		herr_t status = H5Aread(aid, H5Type, buffer);
+		if (status != 0) writeInfo("Cannot read attribute " + name + "!", eHDF);
+		H5Aclose(aid);
+		return (status == 0);
+	}
+
+	// Read the attributes common to all grids
+	bool readGlobalAttributes()
+	{
+		hid_t input_fid = H5Fopen(inputFileName(0, 0).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+		if (input_fid <= 0)
+		{
+			writeInfo("Cannot open input file!", eHDF);
+			return false;
+		}
+
+		bool ok = readAttribute(input_fid, "Dimensions", H5T_NATIVE_INT, &dimensions_p) &&
+			readAttribute(input_fid, "NumberOfGrids", H5T_NATIVE_INT, &levels) &&
+			readAttribute(input_fid, "NumberOfRegions", H5T_NATIVE_INT, &regions) &&
+			readAttribute(input_fid, "Timesteps", H5T_NATIVE_INT, &timesteps) &&
+			readAttribute(input_fid, "OutputFrequency", H5T_NATIVE_INT, &out_every) &&
+			readAttribute(input_fid, "Mpi", H5T_NATIVE_INT, &mpi_flag);
+
+		H5Fclose(input_fid);
+		return ok;
+	}
+
+	// Read the first value of a position vector to locate the grid
+	static bool readFirstPosition(hid_t fid, std::string VAR, double *value)
+	{
+		std::string variable_string = "/Time_0" + VAR;
+		hid_t did = H5Dopen(fid, variable_string.c_str(), H5P_DEFAULT);
+		if (did <= 0)
+		{
+			writeInfo("Cannot open input dataset: " + variable_string, eHDF);
+			return false;
+		}
+
+		// Select the first element only (a 1 x ... x 1 block of the dataset rank)
+		hid_t fsid = H5Dget_space(did);
+		int rank = H5Sget_simple_extent_ndims(fsid);
+		if (rank <= 0)
+		{
+			writeInfo("Cannot get rank of input dataset: " + variable_string, eHDF);
+			H5Sclose(fsid);
+			H5Dclose(did);
+			return false;
+		}
+		std::vector<hsize_t> offset(rank, 0);
+		std::vector<hsize_t> count(rank, 1);
+		H5Sselect_hyperslab(fsid, H5S_SELECT_SET, offset.data(), NULL, count.data(), NULL);
+		hid_t msid = H5Screate_simple(rank, count.data(), NULL);
+		herr_t status = H5Dread(did, H5T_NATIVE_DOUBLE, msid, fsid, H5P_DEFAULT, value);
+		if (status != 0) writeInfo("Cannot read input dataset!", eHDF);
+
+		H5Sclose(msid);
+		H5Sclose(fsid);
+		H5Dclose(did);
+		return (status == 0);
+	}
+
+	// Read the layout of a grid
+	bool readGridInfo(GridInfo& gi)
+	{
+		hid_t input_fid = H5Fopen(inputFileName(gi.lev, gi.reg).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+		if (input_fid <= 0)
+		{
+			writeInfo("Cannot open input file " + inputFileName(gi.lev, gi.reg) + "!", eHDF);
+			return false;
+		}
+
+		gi.gridsize[2] = 1;
+		gi.origin[2] = 0.0;
+		bool ok = readAttribute(input_fid, "GridSize", H5T_NATIVE_INT, &gi.gridsize[0]) &&
+			readAttribute(input_fid, "Dx", H5T_NATIVE_DOUBLE, &gi.dx) &&
+			readFirstPosition(input_fid, "/XPos", &gi.origin[0]) &&
+			readFirstPosition(input_fid, "/YPos", &gi.origin[1]);
+		if (ok && dimensions_p == 3) ok = readFirstPosition(input_fid, "/ZPos", &gi.origin[2]);
+
+		// Convert site centre to lower corner
+		for (int d = 0; d < dimensions_p; ++d) gi.origin[d] -= gi.dx / 2;
+
+		H5Fclose(input_fid);
+		return ok;
+	}
+
+	// Read a dataset and add it to the image in VTK (x-fastest) ordering
+	template <typename T, typename vtkT>
+	static bool addArray(std::string VAR, std::string TIME_STRING, hid_t input_fid, hid_t input_sid,
+		hid_t H5Type, const GridInfo& gi, std::vector<T>& buffer, vtkSmartPointer<vtkImageData> image)
+	{
+		// Skip datasets which were not written
+		std::string variable_string = TIME_STRING + VAR;
+		if (H5Lexists(input_fid, variable_string.c_str(), H5P_DEFAULT) <= 0) return false;
+
+		if (readDataset(VAR, TIME_STRING, input_fid, input_sid, H5Type, buffer.data()) != 0) return false;
+
+		const int nx = gi.gridsize[0], ny = gi.gridsize[1], nz = gi.gridsize[2];
+		vtkSmartPointer<vtkT> arr = vtkSmartPointer<vtkT>::New();
+		arr->SetName(VAR.substr(1).c_str());
+		arr->SetNumberOfTuples(static_cast<vtkIdType>(nx) * ny * nz);
+
+		// File is stored with z fastest
+		for (int i = 0; i < nx; ++i) {
+			for (int j = 0; j < ny; ++j) {
+				for (int k = 0; k < nz; ++k) {
+					arr->SetValue(i + nx * (j + ny * k), buffer[k + nz * (j + ny * i)]);
+				}
+			}
+		}
+
+		image->GetCellData()->AddArray(arr);
+		return true;
+	}
+
+	// Convert a single grid at a single time step
+	bool convertBlock(size_t t, const GridInfo& gi)
+	{
+		std::string TIME_STRING = "/Time_" + std::to_string(t);
+		const int nx = gi.gridsize[0], ny = gi.gridsize[1], nz = gi.gridsize[2];
+		const size_t num_sites = static_cast<size_t>(nx) * ny * nz;
+
+		hid_t input_fid = H5Fopen(inputFileName(gi.lev, gi.reg).c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+		if (input_fid <= 0)
+		{
+			writeInfo("Cannot open input file " + inputFileName(gi.lev, gi.reg) + "!", eHDF);
+			return false;
+		}
+
+		// Create input dataspace
+		hsize_t dims_input[1];
+		dims_input[0] = num_sites;
+		hid_t input_sid = H5Screate_simple(1, dims_input, NULL);
+		if (input_sid <= 0) writeInfo("Cannot create input dataspace!", eHDF);
+
+		// Create uniform image for this grid
+		vtkSmartPointer<vtkImageData> image = vtkSmartPointer<vtkImageData>::New();
+		image->SetOrigin(gi.origin[0], gi.origin[1], gi.origin[2]);
+		image->SetSpacing(gi.dx, gi.dx, gi.dx);
+		image->SetDimensions(nx + 1, ny + 1, (dimensions_p == 3) ? nz + 1 : 1);
+
+		// Typing matrix is required -- if missing assume the time step is not available
+		std::vector<int> ibuffer(num_sites);
+		if (!addArray<int, vtkIntArray>("/LatTyp", TIME_STRING, input_fid, input_sid, H5T_NATIVE_INT, gi, ibuffer, image))
+		{
+			writeInfo("Couldn't find time step " + std::to_string(t) + " on L" + std::to_string(gi.lev) +
+				" R" + std::to_string(gi.reg) + ". Skipping block.", eFatal);
+			H5Sclose(input_sid);
+			H5Fclose(input_fid);
+			return false;
+		}
+
+		// Blank sites on the ignore list using the ghost array
+		vtkSmartPointer<vtkUnsignedCharArray> ghosts = vtkSmartPointer<vtkUnsignedCharArray>::New();
+		ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+		ghosts->SetNumberOfTuples(num_sites);
+		for (int i = 0; i < nx; ++i) {
+			for (int j = 0; j < ny; ++j) {
+				for (int k = 0; k < nz; ++k) {
+					ghosts->SetValue(i + nx * (j + ny * k),
+						isOnIgnoreList(static_cast<eType>(ibuffer[k + nz * (j + ny * i)])) ? 
+						vtkDataSetAttributes::HIDDENCELL : 0);
+				}
+			}
+		}
+		image->GetCellData()->AddArray(ghosts);
+
+		// MPI block data always read from Time_0
+		if (mpi_flag)
+		{
+			if (addArray<int, vtkIntArray>("/MpiBlock", "/Time_0", input_fid, input_sid, H5T_NATIVE_INT, gi, ibuffer, image))
+				image->GetCellData()->GetArray("MpiBlock")->SetName("MpiBlockNumber");
+		}
+#ifdef L_TEMPERATURE
+		addArray<int, vtkIntArray>("/LatTTyp", TIME_STRING, input_fid, input_sid, H5T_NATIVE_INT, gi, ibuffer, image);
+#endif
+		ibuffer.clear();
+		ibuffer.shrink_to_fit();
+
+		// Add any double datasets which are present
+		std::vector<std::string> names = {
+			"/Rho", "/Rho_TimeAv", "/Ux", "/Uy", "/Ux_TimeAv", "/Uy_TimeAv",
+			"/UxUx_TimeAv", "/UxUy_TimeAv", "/UyUy_TimeAv", "/Temperature" };
+		if (dimensions_p == 3)
+		{
+			std::vector<std::string> names3D = {
+				"/Uz", "/Uz_TimeAv", "/UxUz_TimeAv", "/UyUz_TimeAv", "/UzUz_TimeAv" };
+			names.insert(names.end(), names3D.begin(), names3D.end());
+		}
+
+		std::vector<double> dbuffer(num_sites);
+		for (const std::string& VAR : names)
+			addArray<double, vtkDoubleArray>(VAR, TIME_STRING, input_fid, input_sid, H5T_NATIVE_DOUBLE, gi, dbuffer, image);
+
+		// Close input
+		herr_t status = H5Sclose(input_sid);
+		if (status != 0) writeInfo("Cannot close input dataspace!", eHDF);
+		status = H5Fclose(input_fid);
+		if (status != 0) writeInfo("Cannot close input file!", eHDF);
+
+		// Write block to file
+		std::string vtkFilename = std::string(H5MGM_OUTPUT_PATH) + "/" + blockFileName(t, gi);
+		vtkSmartPointer<vtkXMLImageDataWriter> writer = vtkSmartPointer<vtkXMLImageDataWriter>::New();
+		writer->SetFileName(vtkFilename.c_str());
+		writer->SetInputData(image);
+		if (writer->Write() == 0)
+		{
+			writeInfo("Cannot write output file " + vtkFilename + "!", eFatal);
+			return false;
+		}
+
+		return true;
+	}
+
+	// Write the multiblock index for each time step and the time series collection
+	void writeIndexFiles(const std::vector<size_t>& times, const std::vector<int>& success)
+	{
+		std::ofstream pvd(std::string(H5MGM_OUTPUT_PATH) + "/luma_" + case_num + ".pvd", std::ios::out);
+		pvd << "<?xml version=\"1.0\"?>" << std::endl;
+		pvd << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\">" << std::endl;
+		pvd << "  <Collection>" << std::endl;
+
+		for (size_t ti = 0; ti < times.size(); ++ti)
+		{
+			// Skip time steps with no converted blocks
+			bool bAny = false;
+			for (size_t gi = 0; gi < grids.size(); ++gi)
+				if (success[ti * grids.size() + gi]) bAny = true;
+			if (!bAny) continue;
+
+			std::string vtmName = blockDirectory(times[ti]) + ".vtm";
+			std::ofstream vtm(std::string(H5MGM_OUTPUT_PATH) + "/" + vtmName, std::ios::out);
+			vtm << "<?xml version=\"1.0\"?>" << std::endl;
+			vtm << "<VTKFile type=\"vtkMultiBlockDataSet\" version=\"1.0\" byte_order=\"LittleEndian\">" << std::endl;
+			vtm << "  <vtkMultiBlockDataSet>" << std::endl;
+			int index = 0;
+			for (size_t gi = 0; gi < grids.size(); ++gi)
+			{
+				if (!success[ti * grids.size() + gi]) continue;
+				vtm << "    <DataSet index=\"" << index++ << "\" name=\"L" << grids[gi].lev << "R" << grids[gi].reg
+					<< "\" file=\"" << blockFileName(times[ti], grids[gi]) << "\"/>" << std::endl;
+			}
+			vtm << "  </vtkMultiBlockDataSet>" << std::endl;
+			vtm << "</VTKFile>" << std::endl;
+			vtm.close();
+
+			pvd << "    <DataSet timestep=\"" << times[ti] << "\" file=\"" << vtmName << "\"/>" << std::endl;
+		}
+
+		pvd << "  </Collection>" << std::endl;
+		pvd << "</VTKFile>" << std::endl;
+		pvd.close();
+	}
+
+};
+
+#endif
@@ -14,6 +14,7 @@
 */
 
 #include "VelocitySorter.h"
+#include "ImageDataConverter.h"
 #include "ThirdParty/vtkCleanUnstructuredGrid.h"
 #include "../../../../inc/definitions.h"
 
@@ -120,41 +121,74 @@ int main(int argc, char* argv[])
 		{
 			bSorter = true;
 		}
+		else if (arg_str == "image")
+		{
+			bImage = true;
+		}
 		else
 		{
 			case_num = std::string(argv[a]);
 		}
 	}
 
+	// Initialise MPI
+	int rank = 0, num_ranks = 1;
+	MPI_Init(&argc, &argv);
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+	// Only the image mode runs in parallel so other ranks have nothing to do
+	if (!bImage && rank != 0)
+	{
+		MPI_Finalize();
+		return 0;
+	}
+
 	// Print out to screen
-	std::cout << "H5MultiGridMerge (h5mgm) Version " << H5MGM_VERSION << ". Running..." << std::endl;
+	if (rank == 0)
+		std::cout << "H5MultiGridMerge (h5mgm) Version " << H5MGM_VERSION << ". Running on " << num_ranks << " process(es)..." << std::endl;
 
 	// Path for output
 	std::string path_str(H5MGM_OUTPUT_PATH);
 
 	// Create directory
 	std::string command = "mkdir -p " + path_str;
+	if (rank == 0)
+	{
 #ifdef _WIN32   // Running on Windows
-	CreateDirectoryA((LPCSTR)path_str.c_str(), NULL);
+		CreateDirectoryA((LPCSTR)path_str.c_str(), NULL);
 #else   // Running on Unix system
-	system(command.c_str());
+		system(command.c_str());
 #endif // _WIN32
+	}
+	if (bImage) MPI_Barrier(MPI_COMM_WORLD);
 
-	// Open log file if not set to quiet
+	// Open log file if not set to quiet (one per rank in parallel)
 	if (bQuiet == false)
 	{
 		std::string logpath = H5MGM_OUTPUT_PATH;
-		logpath += "/h5mgm.log";
+		logpath += "/h5mgm";
+		if (rank != 0) logpath += "." + std::to_string(rank);
+		logpath += ".log";
 		logfile.open(logpath, std::ios::out | std::ios::app);
 		logfile << "---------------------------------------" << std::endl;
 	}
 
 	// Start process
-	std::cout << "Reconstructing HDF data..." << std::endl;
+	if (rank == 0) std::cout << "Reconstructing HDF data..." << std::endl;
 
 	// Turn auto error printing off
 	H5Eset_auto(H5E_DEFAULT, NULL, NULL);
 
+	// If writing image data use the parallel converter then return
+	if (bImage)
+	{
+		ImageDataConverter *idc = new ImageDataConverter(case_num, rank, num_ranks);
+		idc->convert();
+		delete idc;
+		MPI_Finalize();
+		return 0;
+	}
 
 	// If using the sorter use the standalone class then return
 	if (bSorter)
@@ -162,6 +196,7 @@ int main(int argc, char* argv[])
 		VelocitySorter<double> *vs = new VelocitySorter<double>();
 		vs->readAndSort();
 		delete vs;
+		MPI_Finalize();
 		return 0;
 	}
 
@@ -679,6 +714,7 @@ int main(int argc, char* argv[])
 		UyUy_TimeAv = NULL;
 	}
 
+	MPI_Finalize();
 	return 0;
 }
 
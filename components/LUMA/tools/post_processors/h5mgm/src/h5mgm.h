@@ -15,7 +15,10 @@
 
 /* H5 Multi-Grid Merge Tool for post-processing HDF5 files written by LUMA */
 
-#define H5MGM_VERSION "0.3.2"
+#ifndef H5MGM_H
+#define H5MGM_H
+
+#define H5MGM_VERSION "0.4.0"
 
 #include "hdf5.h"
 #define H5_BUILT_AS_DYNAMIC_LIB
@@ -57,6 +60,7 @@ static std::ofstream logfile;
 static bool bCutSolid = false;
 static bool bLegacy = false;
 static bool bSorter = false;
+static bool bImage = false;
 
 // Unit vectors for node positions on each cell
 const int e[3][8] =
@@ -255,4 +259,6 @@ herr_t addDataToGrid(std::string VAR, std::string TIME_STRING,
 	return 0;
 }
 
+#endif
+
 /* End of header */
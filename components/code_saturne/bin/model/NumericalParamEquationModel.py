@@ -573,9 +573,11 @@ class NumericalParamEquationModel(Model):
         self.isInList(value, ('multigrid', 'multigrid_k_cycle',
                               'conjugate_gradient',
                               'flexible_conjugate_gradient',
-                              'inexact_conjugate_gradient', 'jacobi',
-                              'bi_cgstab', 'bi_cgstab2', 'gmres', 'automatic',
-                              'gauss_seidel', 'symmetric_gauss_seidel', 'PCR3'))
+                              'inexact_conjugate_gradient',
+                              'pipelined_conjugate_gradient', 'jacobi',
+                              'bi_cgstab', 'bi_cgstab2', 'pipelined_bi_cgstab',
+                              'gmres', 'ca_gmres', 'automatic', 'gauss_seidel',
+                              'symmetric_gauss_seidel', 'PCR3'))
         node = self._getSolverNameNode(name)
 
         default = self._defaultValues()['solver_choice']
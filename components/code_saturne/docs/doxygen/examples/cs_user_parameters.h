@@ -404,6 +404,17 @@
 
   \snippet cs_user_parameters-linear_solvers.c sles_mg_parall
 
+  \subsection cs_user_parameters_h_sles_mg_reuse Multigrid coarsening reuse
+
+  When the matrix structure is fixed and its coefficients vary slowly
+  from one time step to the next, the coarse grid aggregation may be kept
+  across setups, so that only the coarse matrix coefficients are recomputed.
+  A full coarsening is done periodically, or when the number of cycles
+  increases too much relative to the solve following the last full
+  coarsening.
+
+  \snippet cs_user_parameters-linear_solvers.c sles_mg_reuse
+
   \subsection cs_user_parameters_h_sles_rad_dom Example: DOM radiation settings
 
   For DOM radiation models, 1 solver is assigned for each direction
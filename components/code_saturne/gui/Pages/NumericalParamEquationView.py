@@ -123,10 +123,13 @@ class SolverChoiceDelegate(QItemDelegate):
         editor.addItem("Conjugate gradient")
         editor.addItem("Flexible conjugate gradient")
         editor.addItem("Inexact conjugate gradient")
+        editor.addItem("Pipelined conjugate gradient")
         editor.addItem("Jacobi")
         editor.addItem("BiCGstab")
         editor.addItem("BiCGstab2")
+        editor.addItem("Pipelined BiCGstab")
         editor.addItem("GMRES")
+        editor.addItem("Communication-avoiding GMRES")
         editor.addItem("Gauss Seidel")
         editor.addItem("Symmetric Gauss Seidel")
         editor.addItem("conjugate residual")
@@ -142,15 +145,18 @@ class SolverChoiceDelegate(QItemDelegate):
                 "conjugate_gradient": 1,
                 "flexible_conjugate_gradient": 2,
                 "inexact_conjugate_gradient": 3,
-                "jacobi": 4,
-                "bi_cgstab": 5,
-                "bi_cgstab2": 6,
-                "gmres": 7,
-                "gauss_seidel": 8,
-                "symmetric_gauss_seidel": 9,
-                "PCR3": 10,
-                "multigrid": 11,
-                "multigrid_k_cycle": 12}
+                "pipelined_conjugate_gradient": 4,
+                "jacobi": 5,
+                "bi_cgstab": 6,
+                "bi_cgstab2": 7,
+                "pipelined_bi_cgstab": 8,
+                "gmres": 9,
+                "ca_gmres": 10,
+                "gauss_seidel": 11,
+                "symmetric_gauss_seidel": 12,
+                "PCR3": 13,
+                "multigrid": 14,
+                "multigrid_k_cycle": 15}
         row = index.row()
         string = index.model().dataSolver[row]['iresol']
         idx = dico[string]
@@ -524,10 +530,13 @@ class StandardItemModelSolver(QStandardItemModel):
                        "Conjugate gradient"     : 'conjugate_gradient',
                        "Flexible conjugate gradient" : 'flexible_conjugate_gradient',
                        "Inexact conjugate gradient"  : 'inexact_conjugate_gradient',
+                       "Pipelined conjugate gradient" : 'pipelined_conjugate_gradient',
                        "Jacobi"                 : 'jacobi',
                        "BiCGstab"               : 'bi_cgstab',
                        "BiCGstab2"              : 'bi_cgstab2',
+                       "Pipelined BiCGstab"     : 'pipelined_bi_cgstab',
                        "GMRES"                  : 'gmres',
+                       "Communication-avoiding GMRES" : 'ca_gmres',
                        "Automatic"              : "automatic",
                        "Gauss Seidel"           : "gauss_seidel",
                        "Symmetric Gauss Seidel" : "symmetric_gauss_seidel",
@@ -540,10 +549,13 @@ class StandardItemModelSolver(QStandardItemModel):
                        "conjugate_gradient"     : 'Conjugate gradient',
                        "inexact_conjugate_gradient"  : 'Inexact conjugate gradient',
                        "flexible_conjugate_gradient" : 'Flexible conjugate gradient',
+                       "pipelined_conjugate_gradient" : 'Pipelined conjugate gradient',
                        "jacobi"                 : 'Jacobi',
                        "bi_cgstab"              : 'BiCGstab',
                        "bi_cgstab2"             : 'BiCGstab2',
+                       "pipelined_bi_cgstab"    : 'Pipelined BiCGstab',
                        'gmres'                  : "GMRES",
+                       'ca_gmres'               : "Communication-avoiding GMRES",
                        "automatic"              : "Automatic",
                        "gauss_seidel"           : "Gauss Seidel",
                        "symmetric_gauss_seidel" : "Symmetric Gauss Seidel",
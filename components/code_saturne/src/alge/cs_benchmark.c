@@ -76,6 +76,7 @@
 
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_gradient.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
@@ -574,6 +575,276 @@ _matrix_check_compare(cs_lnum_t        n_elts,
   return dmax;
 }
 
+/*----------------------------------------------------------------------------
+ * Measure matrix.vector product performance with single-precision
+ * extra-diagonal coefficients (as used on mixed-precision multigrid
+ * coarse levels), compared to the usual double-precision coefficients.
+ *
+ * parameters:
+ *   t_measure   <-- minimum time for each measure (< 0 for single pass)
+ *   n_cells     <-- number of cells
+ *   n_cells_ext <-- number of cells including ghost cells (array size)
+ *   n_faces     <-- local number of internal faces
+ *   face_cell   <-- face -> cells connectivity
+ *   halo        <-- cell halo structure
+ *   x           <-> vector
+ *   y           --> vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mixed_precision_matrix_vector_test(double               t_measure,
+                                    cs_lnum_t            n_cells,
+                                    cs_lnum_t            n_cells_ext,
+                                    cs_lnum_t            n_faces,
+                                    const cs_lnum_2_t   *face_cell,
+                                    const cs_halo_t     *halo,
+                                    cs_real_t           *restrict x,
+                                    cs_real_t           *restrict y)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_ops, n_ops_glob;
+
+  cs_real_t  *da = NULL, *xa = NULL, *yr = NULL;
+
+  const char *p_name[] = {N_("double precision"),
+                          N_("single precision")};
+
+  /* n_faces*2 extradiagonal + n_cells diagonal nonzeroes */
+
+  n_ops = n_cells + n_faces*4;
+
+  if (cs_glob_n_ranks == 1)
+    n_ops_glob = n_ops;
+  else
+    n_ops_glob = (cs_glob_mesh->n_g_cells + cs_glob_mesh->n_g_i_faces*4);
+
+  /* Coefficients not exactly representable in single precision */
+
+  BFT_MALLOC(da, n_cells_ext, cs_real_t);
+  BFT_MALLOC(xa, n_faces, cs_real_t);
+  BFT_MALLOC(yr, n_cells_ext, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++)
+    da[ii] = 7.0;
+  for (cs_lnum_t ii = 0; ii < n_faces; ii++)
+    xa[ii] = -1.0/3.0;
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_MSR,
+                                 true,
+                                 n_cells,
+                                 n_cells_ext,
+                                 n_faces,
+                                 face_cell,
+                                 halo,
+                                 NULL);
+  cs_matrix_t *m = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(m, true, NULL, NULL,
+                             n_faces, face_cell, da, xa);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "Matrix.vector product, MSR coefficients precision\n"
+                "=================================================\n");
+
+  for (int p_id = 0; p_id < 2; p_id++) {
+
+    if (p_id == 1)
+      cs_matrix_set_msr_x_val_f(m);
+
+    double test_sum = 0.0;
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 8;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      double test_sum_mult = 1.0/n_runs;
+      while (run_id < n_runs) {
+        cs_matrix_vector_multiply_nosync(m, x, y);
+        test_sum += y[n_cells-1]*test_sum_mult;
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (wt1 - wt0 < t_measure)
+        n_runs *= 2;
+    }
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "\n"
+                  "Extradiagonal coefficients: %s\n"
+                  "---------------------------\n",
+                  _(p_name[p_id]));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  (calls: %d;  test sum: %12.5f)\n",
+                  n_runs, test_sum);
+
+    _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+
+    if (p_id == 0)
+      memcpy(yr, y, n_cells*sizeof(cs_real_t));
+    else {
+      double dmax = _matrix_check_compare(n_cells, y, yr);
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  Max. difference with double precision: %12.5e\n",
+                    dmax);
+      cs_log_printf_flush(CS_LOG_PERFORMANCE);
+    }
+
+  }
+
+  cs_matrix_destroy(&m);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(yr);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure least-squares gradient performance with face-based scatter
+ * (using face group renumbering) and cell-based gather (using the
+ * cell -> interior faces adjacency) loops on interior faces.
+ *
+ * parameters:
+ *   t_measure   <-- minimum time for each measure (< 0 for single pass)
+ *   n_cells     <-- number of cells
+ *   n_cells_ext <-- number of cells including ghost cells (array size)
+ *   n_b_faces   <-- local number of boundary faces
+ *   x           <-> vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_gather_test(double      t_measure,
+                      cs_lnum_t   n_cells,
+                      cs_lnum_t   n_cells_ext,
+                      cs_lnum_t   n_b_faces,
+                      cs_real_t  *restrict x)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_ops, n_ops_glob;
+
+  cs_real_t  *coefa = NULL, *coefb = NULL;
+  cs_real_3_t  *grad = NULL, *grad_r = NULL;
+
+  const char *l_name[] = {N_("face-based scatter"),
+                          N_("cell-based gather")};
+
+  const bool gather_ini = cs_gradient_get_lsq_gather();
+
+  /* Approximate operation count: about 20 per interior face
+     (for both paths), and 15 per cell for the final solve */
+
+  n_ops = n_cells*15 + cs_glob_mesh->n_i_faces*20;
+
+  if (cs_glob_n_ranks == 1)
+    n_ops_glob = n_ops;
+  else
+    n_ops_glob = (  cs_glob_mesh->n_g_cells*15
+                  + cs_glob_mesh->n_g_i_faces*20);
+
+  /* Homogeneous Neumann boundary conditions */
+
+  BFT_MALLOC(coefa, n_b_faces, cs_real_t);
+  BFT_MALLOC(coefb, n_b_faces, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(grad_r, n_cells_ext, cs_real_3_t);
+
+  for (cs_lnum_t ii = 0; ii < n_b_faces; ii++) {
+    coefa[ii] = 0.;
+    coefb[ii] = 1.;
+  }
+
+  cs_gradient_initialize();
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "Least-squares gradient, interior faces loop\n"
+                "===========================================\n");
+
+  for (int l_id = 0; l_id < 2; l_id++) {
+
+    cs_gradient_set_lsq_gather(l_id == 1);
+
+    double test_sum = 0.0;
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 8;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      double test_sum_mult = 1.0/n_runs;
+      while (run_id < n_runs) {
+        cs_gradient_scalar("benchmark",
+                           CS_GRADIENT_LSQ,
+                           CS_HALO_STANDARD,
+                           1,      /* inc */
+                           false,  /* recompute_cocg */
+                           1,      /* n_r_sweeps */
+                           0,      /* tr_dim */
+                           0,      /* hyd_p_flag */
+                           1,      /* w_stride */
+                           0,      /* verbosity */
+                           CS_GRADIENT_LIMIT_NONE,
+                           1e-5,   /* epsilon */
+                           1.5,    /* clip_coeff */
+                           NULL,   /* f_ext */
+                           coefa,
+                           coefb,
+                           x,
+                           NULL,   /* c_weight */
+                           NULL,   /* cpl */
+                           grad);
+        test_sum += grad[n_cells-1][0]*test_sum_mult;
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (wt1 - wt0 < t_measure)
+        n_runs *= 2;
+    }
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "\n"
+                  "Interior faces loop: %s\n"
+                  "--------------------\n",
+                  _(l_name[l_id]));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  (calls: %d;  test sum: %12.5f)\n",
+                  n_runs, test_sum);
+
+    _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+
+    if (l_id == 0)
+      memcpy(grad_r, grad, n_cells*sizeof(cs_real_3_t));
+    else {
+      double dmax = _matrix_check_compare(n_cells*3,
+                                          (const cs_real_t *)grad,
+                                          (cs_real_t *)grad_r);
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  Max. difference with scatter: %12.5e\n",
+                    dmax);
+      cs_log_printf_flush(CS_LOG_PERFORMANCE);
+    }
+
+  }
+
+  cs_gradient_set_lsq_gather(gather_ini);
+
+  cs_gradient_finalize();
+
+  BFT_FREE(grad_r);
+  BFT_FREE(grad);
+  BFT_FREE(coefb);
+  BFT_FREE(coefa);
+}
+
 /*----------------------------------------------------------------------------
  * Check local matrix.vector product operations using matrix assembler
  *
@@ -1069,6 +1340,21 @@ cs_benchmark(int  mpi_trace_mode)
                           x,
                           y);
 
+  _mixed_precision_matrix_vector_test(t_measure,
+                                      n_cells,
+                                      n_cells_ext,
+                                      n_faces,
+                                      i_face_cells,
+                                      mesh->halo,
+                                      x,
+                                      y);
+
+  _gradient_gather_test(t_measure,
+                        n_cells,
+                        n_cells_ext,
+                        mesh->n_b_faces,
+                        x);
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
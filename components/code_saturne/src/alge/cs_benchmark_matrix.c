@@ -348,6 +348,18 @@ _variant_build_list(int                             n_fill_types,
 
 #endif
 
+      _variant_add("Native, gather",
+                   CS_MATRIX_NATIVE,
+                   n_fill_types,
+                   fill_types,
+                   2, /* ed_flag */
+                   "gather",
+                   NULL,
+                   NULL,
+                   n_variants,
+                   &n_variants_max,
+                   m_variant);
+
       if (numbering->type == CS_NUMBERING_VECTORIZE)
         _variant_add("Native, vectorized",
                      CS_MATRIX_NATIVE,
@@ -483,6 +495,54 @@ _variant_build_list(int                             n_fill_types,
 
   }
 
+  if (type_filter[CS_MATRIX_SELL]) {
+
+    _variant_add("SELL",
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 "standard",
+                 "standard",
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#if defined(__AVX2__) && !defined(HAVE_LONG_LNUM)
+
+    _variant_add("SELL, with AVX2",
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 "avx2",
+                 "avx2",
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#endif
+
+#if defined(__AVX512F__) && !defined(HAVE_LONG_LNUM)
+
+    _variant_add("SELL, with AVX-512",
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 "avx512",
+                 "avx512",
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#endif
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_timing_variant_t);
 }
@@ -1425,7 +1485,9 @@ cs_benchmark_matrix(double                 t_measure,
   bool                   type_filter[CS_MATRIX_N_BUILTIN_TYPES] = {true,
                                                                    true,
                                                                    true,
-                                                                   true};
+                                                                   true,
+                                                                   true,
+                                                                   false};
 
   int                    _n_fill_types_default = 3;
   cs_matrix_fill_type_t  _fill_types_default[] = {CS_MATRIX_SCALAR,
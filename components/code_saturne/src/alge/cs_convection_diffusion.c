@@ -3015,6 +3015,655 @@ cs_convection_diffusion_scalar(int                       idtvar,
   BFT_FREE(courant);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the fused convection/diffusion balance and matrix
+ * assembly (\ref cs_convection_diffusion_matrix_scalar) may be used
+ * for a given scalar system.
+ *
+ * The fused kernel handles unsteady computations with isotropic diffusion,
+ * upwind boundary convective fluxes, no internal coupling, no
+ * Cp multiplier, and all interior face schemes except NVD/TVD ones.
+ *
+ * \param[in]     idtvar        indicator of the temporal scheme
+ * \param[in]     imucpp        indicator
+ *                               - 0 do not multiply the convective term by Cp
+ *                               - 1 do multiply the convective term by Cp
+ * \param[in]     icvflb        global indicator of boundary convection flux
+ *                               - 0 upwind scheme at all boundary faces
+ *                               - 1 imposed flux at some boundary faces
+ * \param[in]     var_cal_opt   pointer to variable calculation options
+ *
+ * \return  true if the fused kernel may be used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_convection_diffusion_matrix_fusable(int                      idtvar,
+                                       int                      imucpp,
+                                       int                      icvflb,
+                                       const cs_var_cal_opt_t  *var_cal_opt)
+{
+  if (idtvar < 0 || imucpp != 0 || icvflb != 0)
+    return false;
+
+  if (!(var_cal_opt->idften & CS_ISOTROPIC_DIFFUSION))
+    return false;
+
+  if (var_cal_opt->icoupl > 0)
+    return false;
+
+  if (var_cal_opt->iconv > 0 && var_cal_opt->blencv > 0.) {
+    if (var_cal_opt->ischcv == 4)
+      return false;
+    if (var_cal_opt->isstpc == 0 && var_cal_opt->ischcv > 2)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the explicit part of the convection/diffusion terms of a
+ * standard transport equation of a scalar field \f$ \varia \f$, and
+ * build the associated implicit matrix, in a single pass over faces.
+ *
+ * This combines \ref cs_convection_diffusion_scalar (unsteady case) and
+ * \ref cs_matrix_wrapper_scalar (without penalization): face geometry,
+ * mass fluxes and upwind/slope test indicators are evaluated once per face
+ * for both the right hand side and the matrix coefficients.
+ * Cell gradients (and slope test or upwind gradients if required)
+ * still need to be computed beforehand, and are not fused.
+ *
+ * Only configurations for which
+ * \ref cs_convection_diffusion_matrix_fusable returns true
+ * are handled.
+ *
+ * \param[in]     f_id          field id (or -1)
+ * \param[in]     var_cal_opt   variable calculation options
+ * \param[in]     isym          indicator
+ *                               - 1 symmetric matrix
+ *                               - 2 non symmmetric matrix
+ * \param[in]     inc           indicator
+ *                               - 0 when solving an increment
+ *                               - 1 otherwise
+ * \param[in]     iccocg        indicator
+ *                               - 1 re-compute cocg matrix
+ *                                   (for iterative gradients)
+ *                               - 0 otherwise
+ * \param[in]     imasac        take mass accumulation into account?
+ * \param[in]     pvar          solved variable (current time step)
+ * \param[in]     pvara         solved variable (previous time step)
+ * \param[in]     coefap        boundary condition array for the variable
+ *                               (explicit part)
+ * \param[in]     coefbp        boundary condition array for the variable
+ *                               (implicit part)
+ * \param[in]     cofafp        boundary condition array for the diffusion
+ *                               of the variable (explicit part)
+ * \param[in]     cofbfp        boundary condition array for the diffusion
+ *                               of the variable (implicit part)
+ * \param[in]     i_massflux    mass flux at interior faces
+ * \param[in]     b_massflux    mass flux at boundary faces
+ * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the r.h.s.
+ * \param[in]     b_visc        \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the r.h.s.
+ * \param[in]     i_viscm       \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the matrix
+ * \param[in]     b_viscm       \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the matrix
+ * \param[in]     rovsdt        working array
+ * \param[in,out] rhs           right hand side \f$ \vect{Rhs} \f$
+ * \param[out]    da            diagonal part of the matrix
+ * \param[out]    xa            extra interleaved diagonal part of the matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_matrix_scalar(int                       f_id,
+                                      const cs_var_cal_opt_t    var_cal_opt,
+                                      int                       isym,
+                                      int                       inc,
+                                      int                       iccocg,
+                                      int                       imasac,
+                                      cs_real_t       *restrict pvar,
+                                      const cs_real_t *restrict pvara,
+                                      const cs_real_t           coefap[],
+                                      const cs_real_t           coefbp[],
+                                      const cs_real_t           cofafp[],
+                                      const cs_real_t           cofbfp[],
+                                      const cs_real_t           i_massflux[],
+                                      const cs_real_t           b_massflux[],
+                                      const cs_real_t           i_visc[],
+                                      const cs_real_t           b_visc[],
+                                      const cs_real_t           i_viscm[],
+                                      const cs_real_t           b_viscm[],
+                                      const cs_real_t           rovsdt[],
+                                      cs_real_t       *restrict rhs,
+                                      cs_real_t       *restrict da,
+                                      cs_real_t       *restrict xa)
+{
+  const int iconvp = var_cal_opt.iconv;
+  const int idiffp = var_cal_opt.idiff;
+  const int nswrgp = var_cal_opt.nswrgr;
+  const int imrgra = var_cal_opt.imrgra;
+  const int imligp = var_cal_opt.imligr;
+  const int ircflp = var_cal_opt.ircflu;
+  const int ischcp = var_cal_opt.ischcv;
+  const int isstpp = var_cal_opt.isstpc;
+  const int iwarnp = var_cal_opt.verbosity;
+  const double blencp = var_cal_opt.blencv;
+  const double blend_st = var_cal_opt.blend_st;
+  const double epsrgp = var_cal_opt.epsrgr;
+  const double climgp = var_cal_opt.climgr;
+  const double thetap = var_cal_opt.thetav;
+
+  const cs_mesh_t  *m = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  const int *bc_type = cs_glob_bc_type;
+
+  /* Local variables */
+
+  char var_name[64];
+
+  int iupwin = 0;
+  int tr_dim = 0;
+  int w_stride = 1;
+
+  bool recompute_cocg = (iccocg) ? true : false;
+
+  cs_real_3_t *grad;
+  cs_real_3_t *gradup = NULL;
+  cs_real_3_t *gradst = NULL;
+  cs_field_t *f = NULL;
+
+  cs_real_t *cv_limiter = NULL;
+  cs_real_t *df_limiter = NULL;
+  cs_real_t *hybrid_blend = NULL;
+
+  cs_real_t *gweight = NULL;
+
+  cs_real_t  *v_slope_test = cs_get_v_slope_test(f_id,  var_cal_opt);
+
+  if (isym != 1 && isym != 2) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isym"));
+  }
+
+  /* Initialization */
+
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+
+  /* Choose gradient type */
+
+  cs_halo_type_t halo_type = CS_HALO_STANDARD;
+  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+
+  cs_gradient_type_by_imrgra(imrgra,
+                             &gradient_type,
+                             &halo_type);
+
+  /* Handle cases where only the previous values (already synchronized)
+     or current values are provided */
+
+  if (pvar != NULL)
+    cs_sync_scalar_halo(m, tr_dim, pvar);
+  if (pvara == NULL)
+    pvara = (const cs_real_t *restrict)pvar;
+
+  const cs_real_t  *restrict _pvar = (pvar != NULL) ? pvar : pvara;
+
+  /* Limiters */
+
+  if (f_id != -1) {
+    f = cs_field_by_id(f_id);
+    cs_gradient_perio_init_rij(f, &tr_dim, grad);
+
+    int cv_limiter_id =
+      cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
+    if (cv_limiter_id > -1)
+      cv_limiter = cs_field_by_id(cv_limiter_id)->val;
+
+    int df_limiter_id =
+      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    if (df_limiter_id > -1)
+      df_limiter = cs_field_by_id(df_limiter_id)->val;
+
+    snprintf(var_name, 63, "%s", f->name);
+  }
+  else if (isstpp > 1) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isstpp for a work array"));
+  } else {
+    strncpy(var_name, "[scalar convection-diffusion]", 63);
+  }
+  var_name[63] = '\0';
+
+  iupwin = (blencp > 0.) ? 0 : 1;
+
+  if (iconvp > 0 && iupwin == 0) {
+    if (ischcp < 0 || ischcp > 3 || (isstpp == 0 && ischcp > 2))
+      bft_error(__FILE__, __LINE__, 0,
+                _("invalid value of ischcv"));
+    if (ischcp == 3)
+      hybrid_blend = CS_F_(hybrid_blend)->val;
+  }
+
+  /* Compute the gradient of the variable
+     (see cs_convection_diffusion_scalar for the required cases) */
+
+  if (  (idiffp != 0 && ircflp == 1)
+     || (  iconvp != 0 && iupwin == 0
+        && (ischcp == 0 || ircflp == 1 || isstpp == 0 || ischcp == 3))) {
+
+    if (f_id != -1) {
+      /* Get the calculation option from the field */
+      if (f->type & CS_FIELD_VARIABLE && var_cal_opt.iwgrec == 1) {
+        if (var_cal_opt.idiff > 0) {
+          int key_id = cs_field_key_id("gradient_weighting_id");
+          int diff_id = cs_field_get_key_int(f, key_id);
+          if (diff_id > -1) {
+            cs_field_t *weight_f = cs_field_by_id(diff_id);
+            gweight = weight_f->val;
+            w_stride = weight_f->dim;
+            cs_field_synchronize(weight_f, halo_type);
+          }
+        }
+      }
+    }
+
+    cs_gradient_scalar_synced_input(var_name,
+                                    gradient_type,
+                                    halo_type,
+                                    inc,
+                                    recompute_cocg,
+                                    nswrgp,
+                                    tr_dim,
+                                    0, /* hyd_p_flag */
+                                    w_stride,
+                                    iwarnp,
+                                    imligp,
+                                    epsrgp,
+                                    climgp,
+                                    NULL, /* f_ext exterior force */
+                                    coefap,
+                                    coefbp,
+                                    _pvar,
+                                    gweight, /* Weighted gradient */
+                                    NULL, /* internal coupling */
+                                    grad);
+
+  } else {
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+      grad[cell_id][0] = 0.;
+      grad[cell_id][1] = 0.;
+      grad[cell_id][2] = 0.;
+    }
+  }
+
+  /* Compute gradients used in convection schemes */
+
+  if (iconvp > 0 && iupwin == 0) {
+
+    /* Compute cell gradient used in slope test */
+    if (isstpp == 0) {
+
+      BFT_MALLOC(gradst, n_cells_ext, cs_real_3_t);
+
+#     pragma omp parallel for
+      for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+        gradst[cell_id][0] = 0.;
+        gradst[cell_id][1] = 0.;
+        gradst[cell_id][2] = 0.;
+      }
+
+      cs_slope_test_gradient(f_id,
+                             inc,
+                             halo_type,
+                             (const cs_real_3_t *)grad,
+                             gradst,
+                             _pvar,
+                             coefap,
+                             coefbp,
+                             i_massflux);
+
+    }
+
+    /* Pure SOLU scheme */
+    if (ischcp == 2) {
+
+      BFT_MALLOC(gradup, n_cells_ext, cs_real_3_t);
+
+#     pragma omp parallel for
+      for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+        gradup[cell_id][0] = 0.;
+        gradup[cell_id][1] = 0.;
+        gradup[cell_id][2] = 0.;
+      }
+
+      cs_upwind_gradient(f_id,
+                         inc,
+                         halo_type,
+                         coefap,
+                         coefbp,
+                         i_massflux,
+                         b_massflux,
+                         _pvar,
+                         gradup);
+
+    }
+
+  }
+
+  /* Matrix diagonal initialization */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+    da[cell_id] = rovsdt[cell_id];
+
+  if (n_cells_ext > n_cells) {
+#   pragma omp parallel for if(n_cells_ext - n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++) {
+      rhs[cell_id] = 0.;
+      da[cell_id] = 0.;
+    }
+  }
+
+  /* ======================================================================
+    ---> Contribution from interior faces
+    ======================================================================*/
+
+  cs_gnum_t n_upwind = 0;
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for reduction(+:n_upwind)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        const cs_real_t mf = i_massflux[face_id];
+
+        /* Matrix coefficients (see cs_matrix_scalar) */
+
+        cs_real_t flui = 0.5*(mf - fabs(mf));
+        cs_real_t fluj =-0.5*(mf + fabs(mf));
+
+        cs_real_t xaij = thetap*(iconvp*flui - idiffp*i_viscm[face_id]);
+        cs_real_t xaji = thetap*(iconvp*fluj - idiffp*i_viscm[face_id]);
+
+        if (isym == 1)
+          xa[face_id] = xaij;
+        else {
+          xa[2*face_id] = xaij;
+          xa[2*face_id + 1] = xaji;
+        }
+
+        da[ii] -= xaij + iconvp*(1. - thetap)*mf;
+        da[jj] -= xaji - iconvp*(1. - thetap)*mf;
+
+        /* Explicit balance (see cs_convection_diffusion_scalar) */
+
+        cs_real_2_t fluxij = {0.,0.};
+
+        bool upwind_switch = false;
+        cs_real_t pif, pjf;
+        cs_real_t pip, pjp;
+
+        cs_real_t bldfrp = (cs_real_t) ircflp;
+        /* Local limitation of the reconstruction */
+        if (df_limiter != NULL && ircflp > 0)
+          bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
+
+        if (iupwin == 1) {
+
+          upwind_switch = true;
+
+          cs_i_cd_unsteady_upwind(bldfrp,
+                                  diipf[face_id],
+                                  djjpf[face_id],
+                                  grad[ii],
+                                  grad[jj],
+                                  _pvar[ii],
+                                  _pvar[jj],
+                                  &pif,
+                                  &pjf,
+                                  &pip,
+                                  &pjp);
+
+        }
+        else if (isstpp == 1 || isstpp == 2) {
+
+          cs_real_t beta = blencp;
+
+          /* Beta blending coefficient ensuring positivity of the scalar */
+          if (isstpp == 2)
+            beta = CS_MAX(CS_MIN(cv_limiter[ii], cv_limiter[jj]), 0.);
+
+          cs_real_t hybrid_coef_ii = 0., hybrid_coef_jj = 0.;
+          if (ischcp == 3) {
+            hybrid_coef_ii = hybrid_blend[ii];
+            hybrid_coef_jj = hybrid_blend[jj];
+          }
+
+          cs_i_cd_unsteady(bldfrp,
+                           ischcp,
+                           beta,
+                           weight[face_id],
+                           cell_cen[ii],
+                           cell_cen[jj],
+                           i_face_cog[face_id],
+                           hybrid_coef_ii,
+                           hybrid_coef_jj,
+                           diipf[face_id],
+                           djjpf[face_id],
+                           grad[ii],
+                           grad[jj],
+                           gradup[ii],
+                           gradup[jj],
+                           _pvar[ii],
+                           _pvar[jj],
+                           &pif,
+                           &pjf,
+                           &pip,
+                           &pjp);
+
+        }
+        else { /* isstpp = 0 */
+
+          cs_i_cd_unsteady_slope_test(&upwind_switch,
+                                      iconvp,
+                                      bldfrp,
+                                      ischcp,
+                                      blencp,
+                                      blend_st,
+                                      weight[face_id],
+                                      i_dist[face_id],
+                                      i_face_surf[face_id],
+                                      cell_cen[ii],
+                                      cell_cen[jj],
+                                      i_face_normal[face_id],
+                                      i_face_cog[face_id],
+                                      diipf[face_id],
+                                      djjpf[face_id],
+                                      mf,
+                                      grad[ii],
+                                      grad[jj],
+                                      gradup[ii],
+                                      gradup[jj],
+                                      gradst[ii],
+                                      gradst[jj],
+                                      _pvar[ii],
+                                      _pvar[jj],
+                                      &pif,
+                                      &pjf,
+                                      &pip,
+                                      &pjp);
+
+        }
+
+        cs_i_conv_flux(iconvp,
+                       thetap,
+                       imasac,
+                       _pvar[ii],
+                       _pvar[jj],
+                       pif,
+                       pif, /* no relaxation */
+                       pjf,
+                       pjf, /* no relaxation */
+                       mf,
+                       1., /* xcpp */
+                       1., /* xcpp */
+                       fluxij);
+
+        cs_i_diff_flux(idiffp,
+                       thetap,
+                       pip,
+                       pjp,
+                       pip, /* no relaxation */
+                       pjp, /* no relaxation */
+                       i_visc[face_id],
+                       fluxij);
+
+        if (upwind_switch) {
+          /* in parallel, face will be counted by one and only one rank */
+          if (ii < n_cells)
+            n_upwind++;
+
+          if (v_slope_test != NULL && iupwin == 0) {
+            v_slope_test[ii] += fabs(mf) / cell_vol[ii];
+            v_slope_test[jj] += fabs(mf) / cell_vol[jj];
+          }
+        }
+
+        rhs[ii] -= fluxij[0];
+        rhs[jj] += fluxij[1];
+
+      }
+    }
+  }
+
+  if (iwarnp >= 2 && iconvp == 1) {
+
+    /* Sum number of clippings */
+    cs_parall_counter(&n_upwind, 1);
+
+    bft_printf(_(" %s: %llu Faces with upwind on %llu interior faces \n"),
+               var_name, (unsigned long long)n_upwind,
+               (unsigned long long)m->n_g_i_c_faces);
+  }
+
+  /* ======================================================================
+    ---> Contribution from boundary faces
+    ======================================================================*/
+
+  /* Boundary convective fluxes are all computed with an upwind scheme */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+#   pragma omp parallel for if(m->n_b_faces > CS_THR_MIN)
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        /* Matrix diagonal (see cs_matrix_scalar) */
+
+        cs_real_t flui = 0.5*(b_massflux[face_id] - fabs(b_massflux[face_id]));
+
+        da[ii] += iconvp*(  flui*thetap*(coefbp[face_id]-1.)
+                          - (1.-thetap)*b_massflux[face_id])
+                + idiffp*thetap*b_viscm[face_id]*cofbfp[face_id];
+
+        /* Explicit balance */
+
+        cs_real_t fluxi = 0.;
+        cs_real_t pip;
+
+        cs_real_t bldfrp = (cs_real_t) ircflp;
+        /* Local limitation of the reconstruction */
+        if (df_limiter != NULL && ircflp > 0)
+          bldfrp = CS_MAX(df_limiter[ii], 0.);
+
+        cs_b_cd_unsteady(bldfrp,
+                         diipb[face_id],
+                         grad[ii],
+                         _pvar[ii],
+                         &pip);
+
+        cs_b_upwind_flux(iconvp,
+                         thetap,
+                         imasac,
+                         inc,
+                         bc_type[face_id],
+                         _pvar[ii],
+                         _pvar[ii], /* no relaxation */
+                         pip,
+                         coefap[face_id],
+                         coefbp[face_id],
+                         b_massflux[face_id],
+                         1., /* xcpp */
+                         &fluxi);
+
+        cs_b_diff_flux(idiffp,
+                       thetap,
+                       inc,
+                       pip,
+                       cofafp[face_id],
+                       cofbfp[face_id],
+                       b_visc[face_id],
+                       &fluxi);
+
+        rhs[ii] -= fluxi;
+
+      }
+    }
+  }
+
+  /* Free memory */
+  BFT_FREE(grad);
+  BFT_FREE(gradup);
+  BFT_FREE(gradst);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * <a name="cs_face_convection_scalar"></a>
@@ -5401,6 +5401,116 @@ cs_convection_diffusion_scalar(int                       idtvar,
                                const cs_real_t           b_visc[],
                                cs_real_t       *restrict rhs);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the fused convection/diffusion balance and matrix
+ * assembly (\ref cs_convection_diffusion_matrix_scalar) may be used
+ * for a given scalar system.
+ *
+ * The fused kernel handles unsteady computations with isotropic diffusion,
+ * upwind boundary convective fluxes, no internal coupling, no
+ * Cp multiplier, and all interior face schemes except NVD/TVD ones.
+ *
+ * \param[in]     idtvar        indicator of the temporal scheme
+ * \param[in]     imucpp        indicator
+ *                               - 0 do not multiply the convective term by Cp
+ *                               - 1 do multiply the convective term by Cp
+ * \param[in]     icvflb        global indicator of boundary convection flux
+ *                               - 0 upwind scheme at all boundary faces
+ *                               - 1 imposed flux at some boundary faces
+ * \param[in]     var_cal_opt   pointer to variable calculation options
+ *
+ * \return  true if the fused kernel may be used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_convection_diffusion_matrix_fusable(int                      idtvar,
+                                       int                      imucpp,
+                                       int                      icvflb,
+                                       const cs_var_cal_opt_t  *var_cal_opt);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the explicit part of the convection/diffusion terms of a
+ * standard transport equation of a scalar field \f$ \varia \f$, and
+ * build the associated implicit matrix, in a single pass over faces.
+ *
+ * This combines \ref cs_convection_diffusion_scalar (unsteady case) and
+ * \ref cs_matrix_wrapper_scalar (without penalization): face geometry,
+ * mass fluxes and upwind/slope test indicators are evaluated once per face
+ * for both the right hand side and the matrix coefficients.
+ * Cell gradients (and slope test or upwind gradients if required)
+ * still need to be computed beforehand, and are not fused.
+ *
+ * Only configurations for which
+ * \ref cs_convection_diffusion_matrix_fusable returns true
+ * are handled.
+ *
+ * \param[in]     f_id          field id (or -1)
+ * \param[in]     var_cal_opt   variable calculation options
+ * \param[in]     isym          indicator
+ *                               - 1 symmetric matrix
+ *                               - 2 non symmmetric matrix
+ * \param[in]     inc           indicator
+ *                               - 0 when solving an increment
+ *                               - 1 otherwise
+ * \param[in]     iccocg        indicator
+ *                               - 1 re-compute cocg matrix
+ *                                   (for iterative gradients)
+ *                               - 0 otherwise
+ * \param[in]     imasac        take mass accumulation into account?
+ * \param[in]     pvar          solved variable (current time step)
+ * \param[in]     pvara         solved variable (previous time step)
+ * \param[in]     coefap        boundary condition array for the variable
+ *                               (explicit part)
+ * \param[in]     coefbp        boundary condition array for the variable
+ *                               (implicit part)
+ * \param[in]     cofafp        boundary condition array for the diffusion
+ *                               of the variable (explicit part)
+ * \param[in]     cofbfp        boundary condition array for the diffusion
+ *                               of the variable (implicit part)
+ * \param[in]     i_massflux    mass flux at interior faces
+ * \param[in]     b_massflux    mass flux at boundary faces
+ * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the r.h.s.
+ * \param[in]     b_visc        \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the r.h.s.
+ * \param[in]     i_viscm       \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the matrix
+ * \param[in]     b_viscm       \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the matrix
+ * \param[in]     rovsdt        working array
+ * \param[in,out] rhs           right hand side \f$ \vect{Rhs} \f$
+ * \param[out]    da            diagonal part of the matrix
+ * \param[out]    xa            extra interleaved diagonal part of the matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_matrix_scalar(int                       f_id,
+                                      const cs_var_cal_opt_t    var_cal_opt,
+                                      int                       isym,
+                                      int                       inc,
+                                      int                       iccocg,
+                                      int                       imasac,
+                                      cs_real_t       *restrict pvar,
+                                      const cs_real_t *restrict pvara,
+                                      const cs_real_t           coefap[],
+                                      const cs_real_t           coefbp[],
+                                      const cs_real_t           cofafp[],
+                                      const cs_real_t           cofbfp[],
+                                      const cs_real_t           i_massflux[],
+                                      const cs_real_t           b_massflux[],
+                                      const cs_real_t           i_visc[],
+                                      const cs_real_t           b_visc[],
+                                      const cs_real_t           i_viscm[],
+                                      const cs_real_t           b_viscm[],
+                                      const cs_real_t           rovsdt[],
+                                      cs_real_t       *restrict rhs,
+                                      cs_real_t       *restrict da,
+                                      cs_real_t       *restrict xa);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * <a name="cs_face_convection_scalar"></a>
@@ -173,6 +173,11 @@ static int _gradient_stat_id = -1;
 static int                        _n_gradient_quantities = 0;
 static cs_gradient_quantities_t  *_gradient_quantities = NULL;
 
+/* Use cell-based gather rather than face-based scatter for interior face
+   contributions to least-squares gradients */
+
+static bool _lsq_gather = false;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -2527,62 +2532,112 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
     /* Contribution from interior faces */
 
-    for (g_id = 0; g_id < n_i_groups; g_id++) {
+    if (_lsq_gather) {
 
-#     pragma omp parallel for
-      for (t_id = 0; t_id < n_i_threads; t_id++) {
+      /* Cell-based gather (no face group renumbering needed) */
 
-        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             f_id++) {
+      const cs_adjacency_t *c2i = cs_mesh_adjacencies_cell_i_faces();
+      const cs_lnum_t *restrict c2i_idx = c2i->idx;
+      const cs_lnum_t *restrict c2i_ids = c2i->ids;
+      const short int *restrict c2i_sgn = c2i->sgn;
 
-          cs_lnum_t ii = i_face_cells[f_id][0];
-          cs_lnum_t jj = i_face_cells[f_id][1];
+#     pragma omp parallel for if(n_cells > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
 
-          cs_real_t pond = weight[f_id];
+        cs_real_t rhs_ii[3] = {0., 0., 0.};
 
-          cs_real_t pfac, dc[3], fctb[4];
+        for (cs_lnum_t k = c2i_idx[ii]; k < c2i_idx[ii+1]; k++) {
 
+          cs_lnum_t f_id = c2i_ids[k];
+          cs_lnum_t jj = (c2i_sgn[k] > 0) ?
+            i_face_cells[f_id][1] : i_face_cells[f_id][0];
+
+          cs_real_t dc[3];
           for (cs_lnum_t ll = 0; ll < 3; ll++)
             dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
+          /* (P_j - P_i) / ||d||^2 */
+          cs_real_t pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                           / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
           if (c_weight != NULL) {
-            /* (P_j - P_i) / ||d||^2 */
-            pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+            cs_real_t pond = (c2i_sgn[k] > 0) ?
+              weight[f_id] : 1. - weight[f_id];
+            pfac *= c_weight[jj] / (  pond       *c_weight[ii]
+                                    + (1. - pond)*c_weight[jj]);
+          }
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              fctb[ll] = dc[ll] * pfac;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhs_ii[ll] += dc[ll] * pfac;
 
-            cs_real_t denom = 1. / (  pond       *c_weight[ii]
-                                    + (1. - pond)*c_weight[jj]);
+        } /* loop on cell faces */
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhsv[ii][ll] += rhs_ii[ll];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
-          }
-          else {
-            /* (P_j - P_i) / ||d||^2 */
-            pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+      } /* loop on cells */
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              fctb[ll] = dc[ll] * pfac;
+    }
+    else {
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] += fctb[ll];
+      for (g_id = 0; g_id < n_i_groups; g_id++) {
+
+#       pragma omp parallel for
+        for (t_id = 0; t_id < n_i_threads; t_id++) {
+
+          for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+               f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+               f_id++) {
+
+            cs_lnum_t ii = i_face_cells[f_id][0];
+            cs_lnum_t jj = i_face_cells[f_id][1];
+
+            cs_real_t pond = weight[f_id];
+
+            cs_real_t pfac, dc[3], fctb[4];
 
             for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] += fctb[ll];
-          }
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
-        } /* loop on faces */
+            if (c_weight != NULL) {
+              /* (P_j - P_i) / ||d||^2 */
+              pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                     / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-      } /* loop on threads */
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                fctb[ll] = dc[ll] * pfac;
 
-    } /* loop on thread groups */
+              cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                      + (1. - pond)*c_weight[jj]);
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
+            }
+            else {
+              /* (P_j - P_i) / ||d||^2 */
+              pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                     / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                fctb[ll] = dc[ll] * pfac;
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] += fctb[ll];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] += fctb[ll];
+            }
+
+          } /* loop on faces */
+
+        } /* loop on threads */
+
+      } /* loop on thread groups */
+
+    }
 
     /* Contribution from extended neighborhood */
 
@@ -2869,6 +2924,315 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   BFT_FREE(rhsv);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalar fields using least-squares
+ * reconstruction for non-orthogonal meshes (nswrgp > 1).
+ *
+ * This is equivalent to calling _lsq_scalar_gradient for each field
+ * (with no hydrostatic pressure, weighting, internal coupling or
+ * periodicity of rotation), but geometric quantities are loaded only once
+ * per face for all fields, and the cocg matrices are shared. If cocg must
+ * be recomputed, boundary cell matrices (which depend on each field's
+ * boundary conditions) are built separately for each field.
+ *
+ * Field values and gradients are interleaved: value of field k for cell
+ * c_id is pvar[c_id*n_fields + k], and its gradient grad[c_id*n_fields + k].
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   n_fields       <-- number of fields
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      per field
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      per field
+ *   pvar           <-- interleaved variables
+ *   grad           --> interleaved gradients (halo synchronized)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t                *m,
+                           const cs_mesh_quantities_t     *fvq,
+                           cs_halo_type_t                  halo_type,
+                           bool                            recompute_cocg,
+                           cs_real_t                       inc,
+                           int                             n_fields,
+                           const cs_real_t         *const  coefap[],
+                           const cs_real_t         *const  coefbp[],
+                           const cs_real_t                 pvar[],
+                           cs_real_3_t           *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  const cs_lnum_t n_f = n_fields;
+
+  cs_real_33_t   *restrict cocgb = NULL;
+  cs_real_33_t   *restrict cocg = NULL;
+
+  _get_cell_cocg_lsq(m,
+                     halo_type,
+                     fvq,
+                     NULL,
+                     &cocg,
+                     &cocgb);
+
+  /* Recompute cocg at boundary cells for each field, using saved cocgb */
+  /*---------------------------------------------------------------------*/
+
+  cs_lnum_t *cell_b_id = NULL;
+  cs_real_33_t *b_cocg = NULL;
+
+  if (recompute_cocg) {
+
+    BFT_MALLOC(cell_b_id, n_cells, cs_lnum_t);
+    BFT_MALLOC(b_cocg, n_b_cells*n_f, cs_real_33_t);
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      cell_b_id[c_id] = -1;
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      cell_b_id[m->b_cells[ii]] = ii;
+      for (cs_lnum_t k = 0; k < n_f; k++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++) {
+          for (cs_lnum_t mm = 0; mm < 3; mm++)
+            b_cocg[ii*n_f + k][ll][mm] = cocgb[ii][ll][mm];
+        }
+      }
+    }
+
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             f_id++) {
+
+          cs_lnum_t ii = cell_b_id[b_face_cells[f_id]];
+
+          cs_real_t udbfs = 1. / b_face_surf[f_id];
+          cs_real_t unddij = 1. / b_dist[f_id];
+
+          for (cs_lnum_t k = 0; k < n_f; k++) {
+
+            cs_real_t umcbdd = (1. - coefbp[k][f_id]) * unddij;
+
+            cs_real_t dddij[3];
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              dddij[ll] =   udbfs * b_face_normal[f_id][ll]
+                          + umcbdd * diipb[f_id][ll];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++) {
+              for (cs_lnum_t mm = 0; mm < 3; mm++)
+                b_cocg[ii*n_f + k][ll][mm] += dddij[ll]*dddij[mm];
+            }
+
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+    /* Invert; the shared cocg is left as after a single-field call
+       for the last field, for consistency with subsequent calls */
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+      for (cs_lnum_t k = 0; k < n_f; k++)
+        cs_math_33_inv_cramer_sym_in_place(b_cocg[ii*n_f + k]);
+      cs_lnum_t c_id = m->b_cells[ii];
+      for (cs_lnum_t ll = 0; ll < 3; ll++) {
+        for (cs_lnum_t mm = 0; mm < 3; mm++)
+          cocg[c_id][ll][mm] = b_cocg[ii*n_f + n_f-1][ll][mm];
+      }
+    }
+
+  } /* End of recompute_cocg */
+
+  /* Compute Right-Hand Side */
+  /*-------------------------*/
+
+  cs_real_3_t  *restrict rhsv;
+  BFT_MALLOC(rhsv, n_cells_ext*n_f, cs_real_3_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t i = 0; i < n_cells_ext*n_f; i++) {
+    rhsv[i][0] = 0.0;
+    rhsv[i][1] = 0.0;
+    rhsv[i][2] = 0.0;
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (cs_lnum_t k = 0; k < n_f; k++) {
+
+          /* (P_j - P_i) / ||d||^2 */
+          cs_real_t pfac = (pvar[jj*n_f + k] - pvar[ii*n_f + k]) * ddc;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            cs_real_t fctb = dc[ll] * pfac;
+            rhsv[ii*n_f + k][ll] += fctb;
+            rhsv[jj*n_f + k][ll] += fctb;
+          }
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from extended neighborhood */
+
+  if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        cs_lnum_t jj = cell_cells_lst[cidx];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (cs_lnum_t k = 0; k < n_f; k++) {
+          cs_real_t pfac = (pvar[jj*n_f + k] - pvar[ii*n_f + k]) * ddc;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhsv[ii*n_f + k][ll] += dc[ll] * pfac;
+        }
+
+      }
+    }
+
+  } /* End for extended neighborhood */
+
+  /* Contribution from boundary faces */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = b_face_cells[f_id];
+
+        cs_real_t unddij = 1. / b_dist[f_id];
+        cs_real_t udbfs = 1. / b_face_surf[f_id];
+
+        for (cs_lnum_t k = 0; k < n_f; k++) {
+
+          cs_real_t umcbdd = (1. - coefbp[k][f_id]) * unddij;
+
+          cs_real_t pfac =   (coefap[k][f_id]*inc + (coefbp[k][f_id] -1.)
+                           * pvar[ii*n_f + k]) * unddij;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhsv[ii*n_f + k][ll] += (  udbfs * b_face_normal[f_id][ll]
+                                     + umcbdd*diipb[f_id][ll]) * pfac;
+
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Compute gradient */
+  /*------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_lnum_t b_id = (cell_b_id != NULL) ? cell_b_id[c_id] : -1;
+
+    for (cs_lnum_t k = 0; k < n_f; k++) {
+
+      const cs_real_t (*c)[3]
+        = (b_id > -1) ?  b_cocg[b_id*n_f + k] : cocg[c_id];
+      const cs_real_t *r = rhsv[c_id*n_f + k];
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        grad[c_id*n_f + k][ll] =   c[ll][0] * r[0]
+                                 + c[ll][1] * r[1]
+                                 + c[ll][2] * r[2];
+
+    }
+
+  }
+
+  /* Synchronize halos (single exchange for all fields) */
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD,
+                             (cs_real_t *)grad, 3*n_fields);
+
+  BFT_FREE(rhsv);
+  BFT_FREE(b_cocg);
+  BFT_FREE(cell_b_id);
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1) in the anisotropic case.
@@ -8878,6 +9242,42 @@ cs_gradient_free_quantities(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Select interior face loop type for least-squares scalar gradients.
+ *
+ * By default, interior face contributions are scattered to adjacent cells
+ * using the face group (thread) numbering. When gather mode is selected,
+ * each cell gathers contributions from its interior faces using the
+ * cell -> interior faces adjacency (built on demand), which does not require
+ * face renumbering and avoids write conflicts. This applies to the
+ * standard case (no hydrostatic pressure component).
+ *
+ * \param[in]  gather  true to use cell-based gather, false for face-based
+ *                     scatter
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_lsq_gather(bool  gather)
+{
+  _lsq_gather = gather;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query interior face loop type for least-squares scalar gradients.
+ *
+ * \return  true if cell-based gather is used, false for face-based scatter
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_get_lsq_gather(void)
+{
+  return _lsq_gather;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -9003,6 +9403,233 @@ cs_gradient_scalar(const char                    *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields in a single pass.
+ *
+ * Field values and gradients are interleaved, so that the value of field
+ * k for cell c_id is var[c_id*n_fields + k], and its gradient
+ * grad[c_id*n_fields + k].
+ *
+ * Input values are synchronized with a single halo exchange for all fields.
+ * For least-squares gradients, faces are traversed once for all fields,
+ * sharing geometric quantities and cocg matrices, and gradient halos are
+ * also synchronized with a single exchange. Other gradient types, or
+ * meshes with periodicity of rotation, use the single-field algorithms
+ * for each field.
+ *
+ * Hydrostatic pressure, gradient weighting and internal coupling are not
+ * handled here; \ref cs_gradient_scalar should be used for fields
+ * requiring those.
+ *
+ * \param[in]       var_name       name used for logging
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       n_fields       number of fields
+ * \param[in]       bc_coeff_a     boundary condition term a for each field,
+ *                                 or NULL
+ * \param[in]       bc_coeff_b     boundary condition term b for each field,
+ *                                 or NULL
+ * \param[in, out]  var            interleaved gradients' base variables
+ * \param[out]      grad           interleaved gradients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                *var_name,
+                         cs_gradient_type_t         gradient_type,
+                         cs_halo_type_t             halo_type,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         int                        n_r_sweeps,
+                         int                        verbosity,
+                         cs_gradient_limit_t        clip_mode,
+                         double                     epsilon,
+                         double                     clip_coeff,
+                         int                        n_fields,
+                         const cs_real_t    *const  bc_coeff_a[],
+                         const cs_real_t    *const  bc_coeff_b[],
+                         cs_real_t                  var[restrict],
+                         cs_real_t                  grad[restrict][3])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+  cs_gradient_info_t *gradient_info = NULL;
+  cs_timer_t t0, t1;
+
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_f = n_fields;
+
+  bool update_stats = true;
+
+  static int last_fvm_count = 0;
+
+  if (n_fields < 1)
+    return;
+
+  t0 = cs_timer_time();
+
+  if (update_stats == true)
+    gradient_info = _find_or_add_system(var_name, gradient_type);
+
+  /* Synchronize variables (single exchange for all fields) */
+
+  if (mesh->halo != NULL)
+    cs_halo_sync_var_strided(mesh->halo, halo_type, var, n_fields);
+
+  /* Use Neumann BC's as default if not provided */
+
+  const cs_real_t **_bc_coeff_a = NULL, **_bc_coeff_b = NULL;
+  cs_real_t *bc_default = NULL;
+
+  BFT_MALLOC(_bc_coeff_a, n_fields, const cs_real_t *);
+  BFT_MALLOC(_bc_coeff_b, n_fields, const cs_real_t *);
+
+  for (int k = 0; k < n_fields; k++) {
+    _bc_coeff_a[k] = (bc_coeff_a != NULL) ? bc_coeff_a[k] : NULL;
+    _bc_coeff_b[k] = (bc_coeff_b != NULL) ? bc_coeff_b[k] : NULL;
+    if (   (_bc_coeff_a[k] == NULL || _bc_coeff_b[k] == NULL)
+        && bc_default == NULL) {
+      BFT_MALLOC(bc_default, 2*n_b_faces, cs_real_t);
+      for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+        bc_default[i] = 0;
+        bc_default[n_b_faces + i] = 1;
+      }
+    }
+    if (_bc_coeff_a[k] == NULL)
+      _bc_coeff_a[k] = bc_default;
+    if (_bc_coeff_b[k] == NULL)
+      _bc_coeff_b[k] = bc_default + n_b_faces;
+  }
+
+  /* Recompute cocg if mesh quantities changed, whether fields are
+     batched or handled one by one below */
+
+  if (n_r_sweeps > 0) {
+    int prev_fvq_count = last_fvm_count;
+    last_fvm_count = cs_mesh_quantities_compute_count();
+    if (last_fvm_count != prev_fvq_count)
+      recompute_cocg = true;
+  }
+
+  bool batched = (   gradient_type == CS_GRADIENT_LSQ
+                  && mesh->have_rotation_perio == 0) ? true : false;
+
+  if (batched) {
+
+    _lsq_scalar_gradient_multi(mesh,
+                               fvq,
+                               halo_type,
+                               recompute_cocg,
+                               inc,
+                               n_fields,
+                               _bc_coeff_a,
+                               _bc_coeff_b,
+                               var,
+                               (cs_real_3_t *)grad);
+
+  }
+
+  /* Clipping, regularization, and non-batched gradient types
+     are handled field by field */
+
+  if (   batched == false
+      || clip_mode != CS_GRADIENT_LIMIT_NONE
+      || cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION) {
+
+    cs_real_t *_var;
+    cs_real_3_t *_grad;
+    BFT_MALLOC(_var, n_cells_ext, cs_real_t);
+    BFT_MALLOC(_grad, n_cells_ext, cs_real_3_t);
+
+    for (cs_lnum_t k = 0; k < n_f; k++) {
+
+#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+        _var[c_id] = var[c_id*n_f + k];
+
+      if (batched) {
+
+#       pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            _grad[c_id][ll] = grad[c_id*n_f + k][ll];
+        }
+
+        _scalar_gradient_clipping(halo_type,
+                                  clip_mode,
+                                  verbosity,
+                                  0, /* tr_dim */
+                                  clip_coeff,
+                                  var_name,
+                                  _var, _grad);
+
+        if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+          cs_bad_cells_regularisation_vector(_grad, 0);
+
+      }
+      else
+        _gradient_scalar(var_name,
+                         gradient_info,
+                         gradient_type,
+                         halo_type,
+                         inc,
+                         recompute_cocg,
+                         n_r_sweeps,
+                         0, /* tr_dim */
+                         0, /* hyd_p_flag */
+                         1, /* w_stride */
+                         verbosity,
+                         clip_mode,
+                         epsilon,
+                         clip_coeff,
+                         NULL,
+                         _bc_coeff_a[k],
+                         _bc_coeff_b[k],
+                         _var,
+                         NULL,
+                         NULL,
+                         _grad);
+
+#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          grad[c_id*n_f + k][ll] = _grad[c_id][ll];
+      }
+
+    }
+
+    BFT_FREE(_grad);
+    BFT_FREE(_var);
+
+  }
+
+  BFT_FREE(bc_default);
+  BFT_FREE(_bc_coeff_a);
+  BFT_FREE(_bc_coeff_b);
+
+  t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
+  if (update_stats == true) {
+    gradient_info->n_calls += 1;
+    cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+  }
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -154,6 +154,36 @@ cs_gradient_finalize(void);
 void
 cs_gradient_free_quantities(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Select interior face loop type for least-squares scalar gradients.
+ *
+ * By default, interior face contributions are scattered to adjacent cells
+ * using the face group (thread) numbering. When gather mode is selected,
+ * each cell gathers contributions from its interior faces using the
+ * cell -> interior faces adjacency (built on demand), which does not require
+ * face renumbering and avoids write conflicts. This applies to the
+ * standard case (no hydrostatic pressure component).
+ *
+ * \param[in]  gather  true to use cell-based gather, false for face-based
+ *                     scatter
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_lsq_gather(bool  gather);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query interior face loop type for least-squares scalar gradients.
+ *
+ * \return  true if cell-based gather is used, false for face-based scatter
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_get_lsq_gather(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -207,6 +237,63 @@ cs_gradient_scalar(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t                      grad[restrict][3]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields in a single pass.
+ *
+ * Field values and gradients are interleaved, so that the value of field
+ * k for cell c_id is var[c_id*n_fields + k], and its gradient
+ * grad[c_id*n_fields + k].
+ *
+ * Input values are synchronized with a single halo exchange for all fields.
+ * For least-squares gradients, faces are traversed once for all fields,
+ * sharing geometric quantities and cocg matrices, and gradient halos are
+ * also synchronized with a single exchange. Other gradient types, or
+ * meshes with periodicity of rotation, use the single-field algorithms
+ * for each field.
+ *
+ * Hydrostatic pressure, gradient weighting and internal coupling are not
+ * handled here; \ref cs_gradient_scalar should be used for fields
+ * requiring those.
+ *
+ * \param[in]       var_name       name used for logging
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       n_fields       number of fields
+ * \param[in]       bc_coeff_a     boundary condition term a for each field,
+ *                                 or NULL
+ * \param[in]       bc_coeff_b     boundary condition term b for each field,
+ *                                 or NULL
+ * \param[in, out]  var            interleaved gradients' base variables
+ * \param[out]      grad           interleaved gradients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                *var_name,
+                         cs_gradient_type_t         gradient_type,
+                         cs_halo_type_t             halo_type,
+                         int                        inc,
+                         bool                       recompute_cocg,
+                         int                        n_r_sweeps,
+                         int                        verbosity,
+                         cs_gradient_limit_t        clip_mode,
+                         double                     epsilon,
+                         double                     clip_coeff,
+                         int                        n_fields,
+                         const cs_real_t    *const  bc_coeff_a[],
+                         const cs_real_t    *const  bc_coeff_b[],
+                         cs_real_t                  var[restrict],
+                         cs_real_t                  grad[restrict][3]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -4936,6 +4936,253 @@ _build_coarse_matrix_null(cs_grid_t         *c,
                              NULL);
 }
 
+/*----------------------------------------------------------------------------
+ * Build coarse grid matrix coefficients and associated quantities from
+ * a fine grid, once the fine -> coarse aggregation is known.
+ *
+ * This step depends on the fine grid's matrix coefficients, but not on the
+ * aggregation algorithm, so may be repeated with the same coarse grid
+ * when only the fine grid coefficients change.
+ *
+ * parameters:
+ *   f                          <-- Fine grid structure
+ *   c                          <-> Coarse grid structure
+ *   recurse                    <-- > 1 if coarsening is recursive
+ *   verbosity                  <-- Verbosity level
+ *   merge_stride               <-- Associated merge stride
+ *   merge_rows_mean_threshold  <-- mean number of rows under which
+ *                                  merging should be applied
+ *   merge_rows_glob_threshold  <-- global number of rows under which
+ *                                  merging should be applied
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_coarse_matrix(const cs_grid_t  *f,
+                     cs_grid_t        *c,
+                     int               recurse,
+                     int               verbosity,
+                     int               merge_stride,
+                     int               merge_rows_mean_threshold,
+                     cs_gnum_t         merge_rows_glob_threshold)
+{
+  cs_lnum_t isym = 2;
+  bool conv_diff = f->conv_diff;
+
+  /* By default, always use MSR structure, as it usually provides the
+     best performance, and is required for the hybrid Gauss-Seidel-Jacobi
+     smoothers. In multithreaded case, we also prefer to use a matrix
+     structure allowing threading without a specific renumbering, as
+     structures are rebuilt often (so only CSR and MSR can be considered) */
+
+  cs_matrix_type_t fine_matrix_type = cs_matrix_get_type(f->matrix);
+  cs_matrix_type_t coarse_matrix_type = CS_MATRIX_MSR;
+
+  cs_matrix_variant_t *coarse_mv = NULL;
+
+  const cs_lnum_t *db_size = f->db_size;
+
+  if (f->symmetric == true)
+    isym = 1;
+
+  BFT_MALLOC(c->_da, c->n_cols_ext * c->db_size[3], cs_real_t);
+  c->da = c->_da;
+
+  BFT_MALLOC(c->_xa, c->n_faces*isym, cs_real_t);
+  c->xa = c->_xa;
+
+  if (  (fine_matrix_type == CS_MATRIX_NATIVE || f->face_cell != NULL)
+      && c->relaxation > 0) {
+
+    /* Allocate permanent arrays in coarse grid
+       (geometric arrays are kept when updating a coarse grid) */
+
+    bool update_geom = (c->_cell_cen == NULL) ? true : false;
+
+    if (update_geom) {
+      BFT_MALLOC(c->_cell_cen, c->n_cols_ext*3, cs_real_t);
+      c->cell_cen = c->_cell_cen;
+
+      BFT_MALLOC(c->_cell_vol, c->n_cols_ext, cs_real_t);
+      c->cell_vol = c->_cell_vol;
+
+      BFT_MALLOC(c->_face_normal, c->n_faces*3, cs_real_t);
+      c->face_normal = c->_face_normal;
+    }
+
+    if (conv_diff) {
+      BFT_MALLOC(c->_da_conv, c->n_cols_ext * c->db_size[3], cs_real_t);
+      c->da_conv = c->_da_conv;
+      BFT_MALLOC(c->_da_diff, c->n_cols_ext * c->db_size[3], cs_real_t);
+      c->da_diff = c->_da_diff;
+      BFT_MALLOC(c->_xa_conv, c->n_faces*2, cs_real_t);
+      c->xa_conv = c->_xa_conv;
+      BFT_MALLOC(c->_xa_diff, c->n_faces, cs_real_t);
+      c->xa_diff = c->_xa_diff;
+    }
+
+    /* We could have xa0 point to xa if symmetric, but this would require
+       caution in CRSTGR to avoid overwriting. */
+
+    BFT_MALLOC(c->_xa0, c->n_faces*isym, cs_real_t);
+    c->xa0 = c->_xa0;
+
+    if (conv_diff) {
+      BFT_MALLOC(c->_xa0_diff, c->n_faces, cs_real_t);
+      c->xa0_diff = c->_xa0_diff;
+    }
+
+    BFT_MALLOC(c->xa0ij, c->n_faces*3, cs_real_t);
+
+    /* Matrix-related data */
+
+    if (update_geom) {
+
+      _compute_coarse_cell_quantities(f, c);
+
+      /* Synchronize grid's geometric quantities */
+
+      if (c->halo != NULL) {
+
+        cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD, c->_cell_cen, 3);
+        if (c->halo->n_transforms > 0)
+          cs_halo_perio_sync_coords(c->halo, CS_HALO_STANDARD, c->_cell_cen);
+
+        cs_halo_sync_var(c->halo, CS_HALO_STANDARD, c->_cell_vol);
+
+      }
+
+    }
+
+  }
+
+  if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
+
+   _compute_coarse_quantities_msr(f, c);
+
+    /* Merge grids if we are below the threshold */
+#if defined(HAVE_MPI)
+   if (merge_stride > 1 && c->n_ranks > 1 && recurse == 0) {
+      cs_gnum_t  _n_ranks = c->n_ranks;
+      cs_gnum_t  _n_mean_g_rows = c->n_g_rows / _n_ranks;
+      if (   _n_mean_g_rows < (cs_gnum_t)merge_rows_mean_threshold
+          || c->n_g_rows < merge_rows_glob_threshold) {
+        _native_from_msr(c);
+        _merge_grids(c, merge_stride, verbosity);
+        _msr_from_native(c);
+      }
+    }
+#else
+    CS_UNUSED(recurse);
+    CS_UNUSED(merge_stride);
+    CS_UNUSED(merge_rows_mean_threshold);
+    CS_UNUSED(merge_rows_glob_threshold);
+#endif
+
+  }
+
+  else if (f->face_cell != NULL) {
+
+    if (conv_diff)
+      _compute_coarse_quantities_conv_diff(f, c, verbosity);
+    else
+      _compute_coarse_quantities_native(f, c, verbosity);
+
+    /* Synchronize matrix's geometric quantities */
+
+    if (c->halo != NULL)
+      cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD, c->_da, db_size[3]);
+
+    /* Merge grids if we are below the threshold */
+
+#if defined(HAVE_MPI)
+    if (merge_stride > 1 && c->n_ranks > 1 && recurse == 0) {
+      cs_gnum_t  _n_ranks = c->n_ranks;
+      cs_gnum_t  _n_mean_g_rows = c->n_g_rows / _n_ranks;
+      if (   _n_mean_g_rows < (cs_gnum_t)merge_rows_mean_threshold
+          || c->n_g_rows < merge_rows_glob_threshold)
+        _merge_grids(c, merge_stride, verbosity);
+    }
+#endif
+
+    c->matrix_struct = cs_matrix_structure_create(coarse_matrix_type,
+                                                  true,
+                                                  c->n_rows,
+                                                  c->n_cols_ext,
+                                                  c->n_faces,
+                                                  c->face_cell,
+                                                  c->halo,
+                                                  NULL);
+
+    c->_matrix = cs_matrix_create(c->matrix_struct);
+
+    cs_matrix_set_coefficients(c->_matrix,
+                               c->symmetric,
+                               c->db_size,
+                               c->eb_size,
+                               c->n_faces,
+                               c->face_cell,
+                               c->da,
+                               c->xa);
+
+    c->matrix = c->_matrix;
+
+    /* Apply tuning if needed */
+
+    if (_grid_tune_max_level > 0) {
+
+      cs_matrix_fill_type_t mft
+        = cs_matrix_get_fill_type(f->symmetric,
+                                  f->db_size,
+                                  f->eb_size);
+
+      if (_grid_tune_max_level > f->level) {
+        int k = CS_MATRIX_N_FILL_TYPES*(f->level) + mft;
+        coarse_mv = _grid_tune_variant[k];
+
+        /* Create tuned variant upon first pass for this level and
+           fill type */
+
+        if  (   coarse_mv == NULL
+             && _grid_tune_max_fill_level[mft] > f->level) {
+
+          cs_log_printf(CS_LOG_PERFORMANCE,
+                        _("\n"
+                          "Tuning for coarse matrices of level %d and type: %s\n"
+                          "==========================\n"),
+                        f->level + 1, cs_matrix_fill_type_name[mft]);
+
+          int n_min_products;
+          double t_measure;
+
+          cs_matrix_get_tuning_runs(&n_min_products, &t_measure);
+
+          coarse_mv = cs_matrix_variant_tuned(c->matrix,
+                                              1,
+                                              n_min_products,
+                                              t_measure);
+
+          _grid_tune_variant[k] = coarse_mv;
+
+          if  (_grid_tune_max_fill_level[mft] == f->level + 1) {
+            cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+            cs_log_separator(CS_LOG_PERFORMANCE);
+          }
+        }
+
+      }
+
+    }
+
+    if (coarse_mv != NULL)
+      cs_matrix_variant_apply(c->_matrix, coarse_mv);
+  }
+
+  if (c->matrix == NULL) {
+    assert(c->n_rows == 0);
+    _build_coarse_matrix_null(c, coarse_matrix_type);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute fine row integer values from coarse row values
  *
@@ -5290,6 +5537,24 @@ cs_grid_free_quantities(cs_grid_t  *g)
   BFT_FREE(g->_cell_vol);
   BFT_FREE(g->_face_normal);
 
+  cs_grid_free_coeff_quantities(g);
+}
+
+/*----------------------------------------------------------------------------
+ * Free a grid structure's quantities depending on matrix coefficients.
+ *
+ * The connectivity and geometric quantities required to update a coarser
+ * grid with cs_grid_coarsen_update are kept.
+ *
+ * parameters:
+ *   g <-> Pointer to grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_free_coeff_quantities(cs_grid_t  *g)
+{
+  assert(g != NULL);
+
   BFT_FREE(g->_da_conv);
   BFT_FREE(g->_da_diff);
   BFT_FREE(g->_xa_conv);
@@ -5473,6 +5738,48 @@ cs_grid_get_matrix(const cs_grid_t  *g)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Use single-precision extra-diagonal coefficients for a coarse grid's
+ * matrix-vector products and smoothers.
+ *
+ * The double-precision coefficients are kept, so this only adds a
+ * reduced-precision copy (see cs_grid_free_matrix_x_val); it has no effect
+ * on grids which do not own their matrix, or whose matrix is not scalar
+ * MSR.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_x_val_f(cs_grid_t  *g)
+{
+  assert(g != NULL);
+
+  if (g->_matrix != NULL)
+    cs_matrix_set_msr_x_val_f(g->_matrix);
+}
+
+/*----------------------------------------------------------------------------
+ * Free double-precision extra-diagonal coefficients of a coarse grid's
+ * matrix once single-precision coefficients are used.
+ *
+ * The grid may not be used to build or update a coarser grid afterwards,
+ * nor with solvers requiring double-precision coefficients.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_free_matrix_x_val(cs_grid_t  *g)
+{
+  assert(g != NULL);
+
+  if (g->_matrix != NULL)
+    cs_matrix_free_msr_x_val(g->_matrix);
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -5556,33 +5863,16 @@ cs_grid_coarsen(const cs_grid_t  *f,
 {
   int recurse = 0;
 
-  cs_lnum_t isym = 2;
-  bool conv_diff = f->conv_diff;
-
-  /* By default, always use MSR structure, as it usually provides the
-     best performance, and is required for the hybrid Gauss-Seidel-Jacobi
-     smoothers. In multithreaded case, we also prefer to use a matrix
-     structure allowing threading without a specific renumbering, as
-     structures are rebuilt often (so only CSR and MSR can be considered) */
-
   cs_matrix_type_t fine_matrix_type = cs_matrix_get_type(f->matrix);
-  cs_matrix_type_t coarse_matrix_type = CS_MATRIX_MSR;
-
-  cs_matrix_variant_t *coarse_mv = NULL;
 
   cs_grid_t *c = NULL;
 
-  const cs_lnum_t *db_size = f->db_size;
-
   assert(f != NULL);
 
   /* Initialization */
 
   c = _coarse_init(f);
 
-  if (f->symmetric == true)
-    isym = 1;
-
   c->relaxation = relaxation_parameter;
   if (f->face_cell == NULL && c->relaxation > 0)
     c->relaxation = 0;
@@ -5668,189 +5958,12 @@ cs_grid_coarsen(const cs_grid_t  *f,
   if (verbosity > 3)
     _aggregation_stats_log(f, c, verbosity);
 
-  BFT_MALLOC(c->_da, c->n_cols_ext * c->db_size[3], cs_real_t);
-  c->da = c->_da;
-
-  BFT_MALLOC(c->_xa, c->n_faces*isym, cs_real_t);
-  c->xa = c->_xa;
-
-  if (  (fine_matrix_type == CS_MATRIX_NATIVE || f->face_cell != NULL)
-      && c->relaxation > 0) {
-
-    /* Allocate permanent arrays in coarse grid */
-
-    BFT_MALLOC(c->_cell_cen, c->n_cols_ext*3, cs_real_t);
-    c->cell_cen = c->_cell_cen;
-
-    BFT_MALLOC(c->_cell_vol, c->n_cols_ext, cs_real_t);
-    c->cell_vol = c->_cell_vol;
-
-    BFT_MALLOC(c->_face_normal, c->n_faces*3, cs_real_t);
-    c->face_normal = c->_face_normal;
-
-    if (conv_diff) {
-      BFT_MALLOC(c->_da_conv, c->n_cols_ext * c->db_size[3], cs_real_t);
-      c->da_conv = c->_da_conv;
-      BFT_MALLOC(c->_da_diff, c->n_cols_ext * c->db_size[3], cs_real_t);
-      c->da_diff = c->_da_diff;
-      BFT_MALLOC(c->_xa_conv, c->n_faces*2, cs_real_t);
-      c->xa_conv = c->_xa_conv;
-      BFT_MALLOC(c->_xa_diff, c->n_faces, cs_real_t);
-      c->xa_diff = c->_xa_diff;
-    }
-
-    /* We could have xa0 point to xa if symmetric, but this would require
-       caution in CRSTGR to avoid overwriting. */
-
-    BFT_MALLOC(c->_xa0, c->n_faces*isym, cs_real_t);
-    c->xa0 = c->_xa0;
-
-    if (conv_diff) {
-      BFT_MALLOC(c->_xa0_diff, c->n_faces, cs_real_t);
-      c->xa0_diff = c->_xa0_diff;
-    }
-
-    BFT_MALLOC(c->xa0ij, c->n_faces*3, cs_real_t);
-
-    /* Matrix-related data */
-
-    _compute_coarse_cell_quantities(f, c);
-
-    /* Synchronize grid's geometric quantities */
-
-    if (c->halo != NULL) {
-
-      cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD, c->_cell_cen, 3);
-      if (c->halo->n_transforms > 0)
-        cs_halo_perio_sync_coords(c->halo, CS_HALO_STANDARD, c->_cell_cen);
-
-      cs_halo_sync_var(c->halo, CS_HALO_STANDARD, c->_cell_vol);
-
-    }
-
-  }
-
-  if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
-
-   _compute_coarse_quantities_msr(f, c);
-
-    /* Merge grids if we are below the threshold */
-#if defined(HAVE_MPI)
-   if (merge_stride > 1 && c->n_ranks > 1 && recurse == 0) {
-      cs_gnum_t  _n_ranks = c->n_ranks;
-      cs_gnum_t  _n_mean_g_rows = c->n_g_rows / _n_ranks;
-      if (   _n_mean_g_rows < (cs_gnum_t)merge_rows_mean_threshold
-          || c->n_g_rows < merge_rows_glob_threshold) {
-        _native_from_msr(c);
-        _merge_grids(c, merge_stride, verbosity);
-        _msr_from_native(c);
-      }
-    }
-#endif
-
-  }
-
-  else if (f->face_cell != NULL) {
-
-    if (conv_diff)
-      _compute_coarse_quantities_conv_diff(f, c, verbosity);
-    else
-      _compute_coarse_quantities_native(f, c, verbosity);
-
-    /* Synchronize matrix's geometric quantities */
-
-    if (c->halo != NULL)
-      cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD, c->_da, db_size[3]);
-
-    /* Merge grids if we are below the threshold */
-
-#if defined(HAVE_MPI)
-    if (merge_stride > 1 && c->n_ranks > 1 && recurse == 0) {
-      cs_gnum_t  _n_ranks = c->n_ranks;
-      cs_gnum_t  _n_mean_g_rows = c->n_g_rows / _n_ranks;
-      if (   _n_mean_g_rows < (cs_gnum_t)merge_rows_mean_threshold
-          || c->n_g_rows < merge_rows_glob_threshold)
-        _merge_grids(c, merge_stride, verbosity);
-    }
-#endif
-
-    c->matrix_struct = cs_matrix_structure_create(coarse_matrix_type,
-                                                  true,
-                                                  c->n_rows,
-                                                  c->n_cols_ext,
-                                                  c->n_faces,
-                                                  c->face_cell,
-                                                  c->halo,
-                                                  NULL);
-
-    c->_matrix = cs_matrix_create(c->matrix_struct);
-
-    cs_matrix_set_coefficients(c->_matrix,
-                               c->symmetric,
-                               c->db_size,
-                               c->eb_size,
-                               c->n_faces,
-                               c->face_cell,
-                               c->da,
-                               c->xa);
-
-    c->matrix = c->_matrix;
-
-    /* Apply tuning if needed */
-
-    if (_grid_tune_max_level > 0) {
-
-      cs_matrix_fill_type_t mft
-        = cs_matrix_get_fill_type(f->symmetric,
-                                  f->db_size,
-                                  f->eb_size);
-
-      if (_grid_tune_max_level > f->level) {
-        int k = CS_MATRIX_N_FILL_TYPES*(f->level) + mft;
-        coarse_mv = _grid_tune_variant[k];
-
-        /* Create tuned variant upon first pass for this level and
-           fill type */
-
-        if  (   coarse_mv == NULL
-             && _grid_tune_max_fill_level[mft] > f->level) {
-
-          cs_log_printf(CS_LOG_PERFORMANCE,
-                        _("\n"
-                          "Tuning for coarse matrices of level %d and type: %s\n"
-                          "==========================\n"),
-                        f->level + 1, cs_matrix_fill_type_name[mft]);
-
-          int n_min_products;
-          double t_measure;
-
-          cs_matrix_get_tuning_runs(&n_min_products, &t_measure);
-
-          coarse_mv = cs_matrix_variant_tuned(c->matrix,
-                                              1,
-                                              n_min_products,
-                                              t_measure);
-
-          _grid_tune_variant[k] = coarse_mv;
-
-          if  (_grid_tune_max_fill_level[mft] == f->level + 1) {
-            cs_log_printf(CS_LOG_PERFORMANCE, "\n");
-            cs_log_separator(CS_LOG_PERFORMANCE);
-          }
-        }
-
-      }
-
-    }
-
-    if (coarse_mv != NULL)
-      cs_matrix_variant_apply(c->_matrix, coarse_mv);
-  }
-
-  if (c->matrix == NULL) {
-    assert(c->n_rows == 0);
-    _build_coarse_matrix_null(c, coarse_matrix_type);
-  }
+  _build_coarse_matrix(f, c,
+                       recurse,
+                       verbosity,
+                       merge_stride,
+                       merge_rows_mean_threshold,
+                       merge_rows_glob_threshold);
 
   /* Recurse if necessary */
 
@@ -5909,6 +6022,79 @@ cs_grid_coarsen(const cs_grid_t  *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Update a coarse grid's matrix coefficients from its fine grid, reusing
+ * the existing fine -> coarse aggregation, connectivity and halo.
+ *
+ * The fine grid must have the same structure as the one from which the
+ * coarse grid was initially built (only its coefficients may differ), and
+ * the coarse grid's quantities may only have been freed using
+ * cs_grid_free_coeff_quantities.
+ * Grids resulting from rank merging are not updated, as their coefficients
+ * were redistributed; they must be rebuilt using cs_grid_coarsen.
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   c         <-> Coarse grid structure (parent is reset to f)
+ *   verbosity <-- Verbosity level
+ *
+ * returns:
+ *   true if the coarse grid was updated, false if it must be rebuilt
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_coarsen_update(const cs_grid_t  *f,
+                       cs_grid_t        *c,
+                       int               verbosity)
+{
+  assert(f != NULL && c != NULL);
+
+  if (   c->level != f->level + 1
+      || c->symmetric != f->symmetric
+      || c->conv_diff != f->conv_diff
+      || c->db_size[3] != f->db_size[3]
+      || c->eb_size[3] != f->eb_size[3])
+    return false;
+
+#if defined(HAVE_MPI)
+  if (c->next_merge_stride > 1)
+    return false;
+#endif
+
+  /* Free coefficient-dependent data */
+
+  cs_matrix_destroy(&(c->_matrix));
+  c->matrix = NULL;
+  cs_matrix_structure_destroy(&(c->matrix_struct));
+
+  BFT_FREE(c->_da);
+  BFT_FREE(c->_xa);
+  c->da = NULL;
+  c->xa = NULL;
+
+  cs_grid_free_coeff_quantities(c);
+
+  /* Coarse cell centers and volumes only depend on the aggregation,
+     so are kept */
+
+  /* Rebuild coefficients from the new fine grid, without merging
+     (this grid was not merged when initially built) */
+
+  c->parent = f;
+
+  _build_coarse_matrix(f, c,
+                       0,          /* recurse */
+                       verbosity,
+                       1,          /* merge_stride */
+                       0,          /* merge_rows_mean_threshold */
+                       0);         /* merge_rows_glob_threshold */
+
+  if (verbosity > 3)
+    _verify_matrix(c);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Create coarse grid with only one row per rank from fine grid.
  *
@@ -5970,6 +6156,8 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
       _merge_grids(c, merge_stride, verbosity);
       _msr_from_native(c);
     }
+#else
+    CS_UNUSED(merge_stride);
 #endif
   }
 
@@ -159,6 +159,19 @@ cs_grid_destroy(cs_grid_t  **grid);
 void
 cs_grid_free_quantities(cs_grid_t *g);
 
+/*----------------------------------------------------------------------------
+ * Free a grid structure's quantities depending on matrix coefficients.
+ *
+ * The connectivity and geometric quantities required to update a coarser
+ * grid with cs_grid_coarsen_update are kept.
+ *
+ * parameters:
+ *   g <-> Pointer to grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_free_coeff_quantities(cs_grid_t *g);
+
 /*----------------------------------------------------------------------------
  * Get grid information.
  *
@@ -254,6 +267,36 @@ cs_grid_get_n_g_rows(const cs_grid_t  *g);
 const cs_matrix_t *
 cs_grid_get_matrix(const cs_grid_t  *g);
 
+/*----------------------------------------------------------------------------
+ * Use single-precision extra-diagonal coefficients for a coarse grid's
+ * matrix-vector products and smoothers.
+ *
+ * The double-precision coefficients are kept, so this only adds a
+ * reduced-precision copy (see cs_grid_free_matrix_x_val); it has no effect
+ * on grids which do not own their matrix, or whose matrix is not scalar
+ * MSR.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_x_val_f(cs_grid_t  *g);
+
+/*----------------------------------------------------------------------------
+ * Free double-precision extra-diagonal coefficients of a coarse grid's
+ * matrix once single-precision coefficients are used.
+ *
+ * The grid may not be used to build or update a coarser grid afterwards,
+ * nor with solvers requiring double-precision coefficients.
+ *
+ * parameters:
+ *   g <-> Grid structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_free_matrix_x_val(cs_grid_t  *g);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -315,6 +358,31 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 cs_gnum_t         merge_rows_glob_threshold,
                 double            relaxation_parameter);
 
+/*----------------------------------------------------------------------------
+ * Update a coarse grid's matrix coefficients from its fine grid, reusing
+ * the existing fine -> coarse aggregation, connectivity and halo.
+ *
+ * The fine grid must have the same structure as the one from which the
+ * coarse grid was initially built (only its coefficients may differ), and
+ * the coarse grid's quantities may only have been freed using
+ * cs_grid_free_coeff_quantities.
+ * Grids resulting from rank merging are not updated, as their coefficients
+ * were redistributed; they must be rebuilt using cs_grid_coarsen.
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   c         <-> Coarse grid structure (parent is reset to f)
+ *   verbosity <-- Verbosity level
+ *
+ * returns:
+ *   true if the coarse grid was updated, false if it must be rebuilt
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_coarsen_update(const cs_grid_t  *f,
+                       cs_grid_t        *c,
+                       int               verbosity);
+
 /*----------------------------------------------------------------------------
  * Create coarse grid with only one row per rank from fine grid.
  *
@@ -69,6 +69,10 @@
 #include <mkl_spblas.h>
 #endif
 
+#if (defined(__AVX2__) || defined(__AVX512F__)) && !defined(HAVE_LONG_LNUM)
+#include <immintrin.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -119,6 +123,36 @@ BEGIN_C_DECLS
 
 #define CS_CL  (CS_CL_SIZE/8)
 
+/* SELL-C-sigma slice height (rows per slice) and row sorting window;
+   the slice height matches the number of doubles in an AVX-512 register,
+   or twice that of an AVX2 register */
+
+#define CS_MATRIX_SELL_C      8
+#define CS_MATRIX_SELL_SIGMA  256
+
+/* Maximum number of vectors handled together by multiple-vector
+   matrix.vector products (larger counts are processed in groups) */
+
+#define CS_MATRIX_MULTI_BLOCK  4
+
+/* SIMD variants of SELL-C-sigma kernels (gathers use 32-bit indexes) */
+
+#if !defined(HAVE_LONG_LNUM)
+#  if defined(__AVX2__)
+#    define CS_MATRIX_SELL_AVX2
+#  endif
+#  if defined(__AVX512F__)
+#    define CS_MATRIX_SELL_AVX512
+#  endif
+#endif
+
+#if defined(__FMA__)
+#  define CS_MATRIX_SELL_FMADD_256(a, b, c)  _mm256_fmadd_pd(a, b, c)
+#else
+#  define CS_MATRIX_SELL_FMADD_256(a, b, c) \
+  _mm256_add_pd(_mm256_mul_pd(a, b), c)
+#endif
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -135,7 +169,9 @@ BEGIN_C_DECLS
 const char  *cs_matrix_type_name[] = {N_("native"),
                                       N_("CSR"),
                                       N_("symmetric CSR"),
-                                      N_("MSR")};
+                                      N_("MSR"),
+                                      N_("SELL"),
+                                      N_("matrix-free conv-diff")};
 
 /* Full names for matrix types */
 
@@ -143,7 +179,9 @@ const char
 *cs_matrix_type_fullname[] = {N_("diagonal + faces"),
                               N_("Compressed Sparse Row"),
                               N_("symmetric Compressed Sparse Row"),
-                              N_("Modified Compressed Sparse Row")};
+                              N_("Modified Compressed Sparse Row"),
+                              N_("Sliced ELLPACK (SELL-C-sigma)"),
+                              N_("matrix-free convection-diffusion")};
 
 /* Fill type names for matrices */
 
@@ -709,6 +747,10 @@ _create_coeff_native(void)
   mc->_da = NULL;
   mc->_xa = NULL;
 
+  mc->row_index = NULL;
+  mc->row_col_id = NULL;
+  mc->row_xa_id = NULL;
+
   return mc;
 }
 
@@ -732,6 +774,8 @@ _destroy_coeff_native(cs_matrix_coeff_native_t **coeff)
     if (mc->_da != NULL)
       BFT_FREE(mc->_da);
 
+    cs_matrix_free_coeff_native_rows(mc);
+
     BFT_FREE(*coeff);
 
   }
@@ -843,10 +887,15 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
     const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
     _da = mc->da;
   }
-  else if (matrix->type == CS_MATRIX_MSR) {
+  else if (   matrix->type == CS_MATRIX_MSR
+           || matrix->type == CS_MATRIX_SELL) {
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
     _da = mc->d_val;
   }
+  else if (matrix->type == CS_MATRIX_CONV_DIFF) {
+    const cs_matrix_coeff_conv_diff_t  *mc = matrix->coeffs;
+    _da = mc->da;
+  }
   const cs_lnum_t  n_rows = matrix->n_rows;
 
   /* Unblocked version */
@@ -1574,6 +1623,165 @@ _b_mat_vec_p_l_native_omp_atomic(bool                exclude_diag,
 
 #endif /* defined(HAVE_OPENMP) */
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector products Y = A.X with native matrix, for multiple
+ * vectors, so that matrix coefficients are loaded only once.
+ *
+ * Vectors are stored one after the other, with n_cols_ext values each.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   n_vecs       <-- number of vectors
+ *   x            <-- multipliying vectors values
+ *   y            --> resulting vectors
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_native_multi(const cs_matrix_t  *matrix,
+                          int                 n_vecs,
+                          const cs_real_t     x[restrict],
+                          cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  stride = ms->n_cols_ext;
+  const cs_real_t  *restrict xa = mc->xa;
+
+  /* Diagonal part of matrix.vector product */
+
+  for (int k = 0; k < n_vecs; k++) {
+    _diag_vec_p_l(mc->da, x + k*stride, y + k*stride, ms->n_rows);
+    _zero_range(y + k*stride, ms->n_rows, ms->n_cols_ext);
+  }
+
+  if (mc->xa == NULL)
+    return;
+
+  /* non-diagonal terms; with threads, use face groups (as the
+     "omp" variant) so that a given row is updated by a single thread */
+
+  const int xa_stride = (mc->symmetric) ? 1 : 2;
+  const int xa_shift = (mc->symmetric) ? 0 : 1;
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+  int n_threads = 1, n_groups = 1;
+  const cs_lnum_t *group_index = NULL;
+  cs_lnum_t _group_index[2] = {0, ms->n_edges};
+
+#if defined(HAVE_OPENMP)
+  if (matrix->numbering != NULL) {
+    if (matrix->numbering->type == CS_NUMBERING_THREADS) {
+      n_threads = matrix->numbering->n_threads;
+      n_groups = matrix->numbering->n_groups;
+      group_index = matrix->numbering->group_index;
+    }
+  }
+#endif
+
+  if (group_index == NULL)
+    group_index = _group_index;
+
+  for (int g_id = 0; g_id < n_groups; g_id++) {
+
+#   pragma omp parallel for if(n_threads > 1)
+    for (int t_id = 0; t_id < n_threads; t_id++) {
+
+      for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+           face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+           face_id++) {
+        cs_lnum_t ii = face_cel_p[face_id][0];
+        cs_lnum_t jj = face_cel_p[face_id][1];
+        const cs_real_t xa_ij = xa[xa_stride*face_id];
+        const cs_real_t xa_ji = xa[xa_stride*face_id + xa_shift];
+        for (int k = 0; k < n_vecs; k++) {
+          y[k*stride + ii] += xa_ij * x[k*stride + jj];
+          y[k*stride + jj] += xa_ji * x[k*stride + ii];
+        }
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix, using a
+ * row-based gather instead of an edge-based scatter.
+ *
+ * The row -> edges adjacency is kept with the matrix coefficients; it is
+ * built by cs_matrix_variant_apply when this product is selected.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_native_gather(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t     x[restrict],
+                           cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+  const cs_real_t  *restrict da = mc->da;
+  const cs_real_t  *restrict xa = mc->xa;
+
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag && da != NULL) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      y[ii] = da[ii] * x[ii];
+  }
+  else
+    _zero_range(y, 0, n_rows);
+
+  _zero_range(y, n_rows, ms->n_cols_ext);
+
+  /* non-diagonal terms */
+
+  if (xa == NULL)
+    return;
+
+  /* Adjacency built when this product was applied (or tuned) */
+
+  assert(mc->row_index != NULL);
+
+  const cs_lnum_t *restrict row_index = mc->row_index;
+  const cs_lnum_t *restrict row_col_id = mc->row_col_id;
+  const cs_lnum_t *restrict row_xa_id = mc->row_xa_id;
+
+  if (mc->symmetric) {
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_real_t sii = 0.;
+      for (cs_lnum_t k = row_index[ii]; k < row_index[ii+1]; k++)
+        sii += xa[row_xa_id[k] >> 1] * x[row_col_id[k]];
+      y[ii] += sii;
+    }
+
+  }
+  else {
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_real_t sii = 0.;
+      for (cs_lnum_t k = row_index[ii]; k < row_index[ii+1]; k++)
+        sii += xa[row_xa_id[k]] * x[row_col_id[k]];
+      y[ii] += sii;
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with native matrix.
  *
@@ -1653,125 +1861,374 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
 }
 
 /*----------------------------------------------------------------------------
- * Destroy a CSR matrix structure.
+ * Create matrix-free convection-diffusion operator coefficients.
  *
- * parameters:
- *   matrix  <->  pointer to CSR matrix structure pointer
+ * returns:
+ *   pointer to allocated coefficients structure.
  *----------------------------------------------------------------------------*/
 
-static void
-_destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
+static cs_matrix_coeff_conv_diff_t *
+_create_coeff_conv_diff(void)
 {
-  if (matrix != NULL && *matrix !=NULL) {
+  cs_matrix_coeff_conv_diff_t  *mc;
 
-    cs_matrix_struct_csr_t  *ms = *matrix;
+  /* Allocate */
 
-    BFT_FREE(ms->_row_index);
+  BFT_MALLOC(mc, 1, cs_matrix_coeff_conv_diff_t);
 
-    BFT_FREE(ms->_col_id);
+  /* Initialize */
 
-    BFT_FREE(ms);
+  mc->symmetric = false;
 
-    *matrix = NULL;
+  mc->iconvp = 0;
+  mc->idiffp = 0;
+  mc->thetap = 1.;
 
-  }
+  mc->da = NULL;
+  mc->i_massflux = NULL;
+  mc->i_visc = NULL;
+  mc->xcpp = NULL;
+
+  mc->_da = NULL;
+
+  return mc;
 }
 
 /*----------------------------------------------------------------------------
- * Create a CSR matrix structure from a native matrix stucture.
- *
- * Note that the structure created maps global cell numbers to the given
- * existing face -> cell connectivity array, so it must be destroyed before
- * this array (usually the code's global cell numbering) is freed.
+ * Destroy matrix-free convection-diffusion operator coefficients.
  *
  * parameters:
- *   have_diag   <-- indicates if the diagonal is nonzero
- *   n_rows      <-- number of local rows
- *   n_cols_ext  <-- number of local + ghost columns
- *   n_edges     <-- local number of graph edges
- *   edges       <-- edges (symmetric row <-> column) connectivity
- *
- * returns:
- *   pointer to allocated CSR matrix structure.
+ *   coeff  <->  pointer to coefficients structure pointer
  *----------------------------------------------------------------------------*/
 
-static cs_matrix_struct_csr_t *
-_create_struct_csr(bool                have_diag,
-                   cs_lnum_t           n_rows,
-                   cs_lnum_t           n_cols_ext,
-                   cs_lnum_t           n_edges,
-                   const cs_lnum_2_t  *edges)
+static void
+_destroy_coeff_conv_diff(cs_matrix_coeff_conv_diff_t **coeff)
 {
-  cs_lnum_t ii, jj, face_id;
-  const cs_lnum_t *restrict face_cel_p;
-
-  cs_lnum_t  diag_elts = 1;
-  cs_lnum_t  *ccount = NULL;
-
-  cs_matrix_struct_csr_t  *ms;
+  if (coeff != NULL && *coeff !=NULL) {
 
-  /* Allocate and map */
+    cs_matrix_coeff_conv_diff_t  *mc = *coeff;
 
-  BFT_MALLOC(ms, 1, cs_matrix_struct_csr_t);
+    if (mc->_da != NULL)
+      BFT_FREE(mc->_da);
 
-  ms->n_rows = n_rows;
-  ms->n_cols_ext = n_cols_ext;
+    BFT_FREE(*coeff);
 
-  ms->direct_assembly = true;
-  ms->have_diag = have_diag;
+  }
+}
 
-  BFT_MALLOC(ms->_row_index, ms->n_rows + 1, cs_lnum_t);
-  ms->row_index = NULL;
+/*----------------------------------------------------------------------------
+ * Set matrix-free convection-diffusion operator coefficients from
+ * native coefficients.
+ *
+ * Only the diagonal may be assigned this way; face fluxes and viscosities
+ * must be set using cs_matrix_set_conv_diff_coefficients().
+ *
+ * parameters:
+ *   matrix    <-- pointer to matrix structure
+ *   symmetric <-- indicates if extradiagonal values are symmetric
+ *   copy      <-- indicates if coefficients should be copied
+ *   n_edges   <-- local number of graph edges
+ *   edges     <-- edges (symmetric row <-> column) connectivity
+ *   da        <-- diagonal values
+ *   xa        <-- extradiagonal values (must be NULL)
+ *----------------------------------------------------------------------------*/
 
-  /* Count number of nonzero elements per row */
+static void
+_set_coeffs_conv_diff(cs_matrix_t        *matrix,
+                      bool                symmetric,
+                      bool                copy,
+                      cs_lnum_t           n_edges,
+                      const cs_lnum_t     edges[restrict][2],
+                      const cs_real_t     da[restrict],
+                      const cs_real_t     xa[restrict])
+{
+  CS_UNUSED(n_edges);
+  CS_UNUSED(edges);
 
-  BFT_MALLOC(ccount, ms->n_rows, cs_lnum_t);
+  cs_matrix_coeff_conv_diff_t  *mc = matrix->coeffs;
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
 
-  if (have_diag == false)
-    diag_elts = 0;
+  if (xa != NULL)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Matrix format %s does not handle assignment of\n"
+         "extra-diagonal coefficients; face fluxes and viscosities\n"
+         "must be set with cs_matrix_set_conv_diff_coefficients."),
+       cs_matrix_type_name[matrix->type]);
 
-  for (ii = 0; ii < ms->n_rows; ii++)  /* count starting with diagonal terms */
-    ccount[ii] = diag_elts;
+  mc->symmetric = symmetric;
 
-  if (edges != NULL) {
+  /* Map or copy values */
 
-    face_cel_p = (const cs_lnum_t *restrict)edges;
+  if (da != NULL) {
 
-    for (face_id = 0; face_id < n_edges; face_id++) {
-      ii = *face_cel_p++;
-      jj = *face_cel_p++;
-      if (ii < ms->n_rows)
-        ccount[ii] += 1;
-      if (jj < ms->n_rows)
-        ccount[jj] += 1;
+    if (copy) {
+      if (mc->_da == NULL)
+        BFT_MALLOC(mc->_da, ms->n_rows, cs_real_t);
+      memcpy(mc->_da, da, sizeof(cs_real_t) * ms->n_rows);
+      mc->da = mc->_da;
     }
+    else
+      mc->da = da;
 
-  } /* if (edges != NULL) */
-
-  ms->_row_index[0] = 0;
-  for (ii = 0; ii < ms->n_rows; ii++) {
-    ms->_row_index[ii+1] = ms->_row_index[ii] + ccount[ii];
-    ccount[ii] = diag_elts; /* pre-count for diagonal terms */
   }
+  else {
+    mc->da = NULL;
+  }
+}
 
-  /* Build structure */
-
-  BFT_MALLOC(ms->_col_id, (ms->_row_index[ms->n_rows]), cs_lnum_t);
-  ms->col_id = NULL;
+/*----------------------------------------------------------------------------
+ * Release shared matrix-free convection-diffusion operator coefficients.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
 
-  if (have_diag == true) {
-    for (ii = 0; ii < ms->n_rows; ii++) {    /* diagonal terms */
-      ms->_col_id[ms->_row_index[ii]] = ii;
-    }
+static void
+_release_coeffs_conv_diff(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_conv_diff_t  *mc = matrix->coeffs;
+  if (mc != NULL) {
+    mc->da = NULL;
+    mc->i_massflux = NULL;
+    mc->i_visc = NULL;
+    mc->xcpp = NULL;
   }
+}
 
-  if (edges != NULL) {                   /* non-diagonal terms */
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with matrix-free convection-diffusion
+ * operator.
+ *
+ * Extra-diagonal terms are computed on the fly from the face mass fluxes
+ * and viscosities, using the same upwind expressions as
+ * cs_matrix_scalar() (or cs_sym_matrix_scalar() with no convection):
+ *   X_ij = theta (iconv (m_ij)^- Cp_i - idiff mu_ij)
+ *   X_ji = theta (-iconv (m_ij)^+ Cp_j - idiff mu_ij)
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
 
-    face_cel_p = (const cs_lnum_t *restrict)edges;
+static void
+_mat_vec_p_l_conv_diff(bool                exclude_diag,
+                       const cs_matrix_t  *matrix,
+                       const cs_real_t     x[restrict],
+                       cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_conv_diff_t  *mc = matrix->coeffs;
 
-    for (face_id = 0; face_id < n_edges; face_id++) {
-      ii = *face_cel_p++;
-      jj = *face_cel_p++;
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _diag_vec_p_l(mc->da, x, y, ms->n_rows);
+    _zero_range(y, ms->n_rows, ms->n_cols_ext);
+  }
+  else
+    _zero_range(y, 0, ms->n_cols_ext);
+
+  /* non-diagonal terms */
+
+  const cs_real_t *restrict i_massflux = mc->i_massflux;
+  const cs_real_t *restrict i_visc = mc->i_visc;
+  const cs_real_t *restrict xcpp = mc->xcpp;
+
+  const bool conv = (! mc->symmetric && mc->iconvp != 0 && i_massflux != NULL);
+  const bool diff = (mc->idiffp != 0 && i_visc != NULL);
+
+  if (! conv && ! diff)
+    return;
+
+  const double c_conv = mc->thetap*mc->iconvp;
+  const double c_diff = mc->thetap*mc->idiffp;
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+  /* With threads, use face groups (as the native "omp" variant)
+     so that a given row is updated by a single thread */
+
+  int n_threads = 1, n_groups = 1;
+  const cs_lnum_t *group_index = NULL;
+  cs_lnum_t _group_index[2] = {0, ms->n_edges};
+
+#if defined(HAVE_OPENMP)
+  if (matrix->numbering != NULL) {
+    if (matrix->numbering->type == CS_NUMBERING_THREADS) {
+      n_threads = matrix->numbering->n_threads;
+      n_groups = matrix->numbering->n_groups;
+      group_index = matrix->numbering->group_index;
+    }
+  }
+#endif
+
+  if (group_index == NULL)
+    group_index = _group_index;
+
+  for (int g_id = 0; g_id < n_groups; g_id++) {
+
+#   pragma omp parallel for if(n_threads > 1)
+    for (int t_id = 0; t_id < n_threads; t_id++) {
+
+      for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+           face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = face_cel_p[face_id][0];
+        cs_lnum_t jj = face_cel_p[face_id][1];
+
+        double x_ij = 0., x_ji = 0.;
+
+        if (diff) {
+          x_ij = -c_diff*i_visc[face_id];
+          x_ji = x_ij;
+        }
+
+        if (conv) {
+          const cs_real_t m_ij = i_massflux[face_id];
+          double flui =  0.5*(m_ij - fabs(m_ij));
+          double fluj = -0.5*(m_ij + fabs(m_ij));
+          if (xcpp != NULL) {
+            flui *= xcpp[ii];
+            fluj *= xcpp[jj];
+          }
+          x_ij += c_conv*flui;
+          x_ji += c_conv*fluj;
+        }
+
+        y[ii] += x_ij * x[jj];
+        y[jj] += x_ji * x[ii];
+
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a CSR matrix structure.
+ *
+ * parameters:
+ *   matrix  <->  pointer to CSR matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
+{
+  if (matrix != NULL && *matrix !=NULL) {
+
+    cs_matrix_struct_csr_t  *ms = *matrix;
+
+    BFT_FREE(ms->_row_index);
+
+    BFT_FREE(ms->_col_id);
+
+    BFT_FREE(ms);
+
+    *matrix = NULL;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create a CSR matrix structure from a native matrix stucture.
+ *
+ * Note that the structure created maps global cell numbers to the given
+ * existing face -> cell connectivity array, so it must be destroyed before
+ * this array (usually the code's global cell numbering) is freed.
+ *
+ * parameters:
+ *   have_diag   <-- indicates if the diagonal is nonzero
+ *   n_rows      <-- number of local rows
+ *   n_cols_ext  <-- number of local + ghost columns
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *
+ * returns:
+ *   pointer to allocated CSR matrix structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_csr_t *
+_create_struct_csr(bool                have_diag,
+                   cs_lnum_t           n_rows,
+                   cs_lnum_t           n_cols_ext,
+                   cs_lnum_t           n_edges,
+                   const cs_lnum_2_t  *edges)
+{
+  cs_lnum_t ii, jj, face_id;
+  const cs_lnum_t *restrict face_cel_p;
+
+  cs_lnum_t  diag_elts = 1;
+  cs_lnum_t  *ccount = NULL;
+
+  cs_matrix_struct_csr_t  *ms;
+
+  /* Allocate and map */
+
+  BFT_MALLOC(ms, 1, cs_matrix_struct_csr_t);
+
+  ms->n_rows = n_rows;
+  ms->n_cols_ext = n_cols_ext;
+
+  ms->direct_assembly = true;
+  ms->have_diag = have_diag;
+
+  BFT_MALLOC(ms->_row_index, ms->n_rows + 1, cs_lnum_t);
+  ms->row_index = NULL;
+
+  /* Count number of nonzero elements per row */
+
+  BFT_MALLOC(ccount, ms->n_rows, cs_lnum_t);
+
+  if (have_diag == false)
+    diag_elts = 0;
+
+  for (ii = 0; ii < ms->n_rows; ii++)  /* count starting with diagonal terms */
+    ccount[ii] = diag_elts;
+
+  if (edges != NULL) {
+
+    face_cel_p = (const cs_lnum_t *restrict)edges;
+
+    for (face_id = 0; face_id < n_edges; face_id++) {
+      ii = *face_cel_p++;
+      jj = *face_cel_p++;
+      if (ii < ms->n_rows)
+        ccount[ii] += 1;
+      if (jj < ms->n_rows)
+        ccount[jj] += 1;
+    }
+
+  } /* if (edges != NULL) */
+
+  ms->_row_index[0] = 0;
+  for (ii = 0; ii < ms->n_rows; ii++) {
+    ms->_row_index[ii+1] = ms->_row_index[ii] + ccount[ii];
+    ccount[ii] = diag_elts; /* pre-count for diagonal terms */
+  }
+
+  /* Build structure */
+
+  BFT_MALLOC(ms->_col_id, (ms->_row_index[ms->n_rows]), cs_lnum_t);
+  ms->col_id = NULL;
+
+  if (have_diag == true) {
+    for (ii = 0; ii < ms->n_rows; ii++) {    /* diagonal terms */
+      ms->_col_id[ms->_row_index[ii]] = ii;
+    }
+  }
+
+  if (edges != NULL) {                   /* non-diagonal terms */
+
+    face_cel_p = (const cs_lnum_t *restrict)edges;
+
+    for (face_id = 0; face_id < n_edges; face_id++) {
+      ii = *face_cel_p++;
+      jj = *face_cel_p++;
       if (ii < ms->n_rows) {
         ms->_col_id[ms->_row_index[ii] + ccount[ii]] = jj;
         ccount[ii] += 1;
@@ -3246,6 +3703,8 @@ _create_coeff_msr(void)
   mc->_d_val = NULL;
   mc->_x_val = NULL;
 
+  mc->_x_val_f = NULL;
+
   return mc;
 }
 
@@ -3263,6 +3722,8 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
 
     cs_matrix_coeff_msr_t  *mc = *coeff;
 
+    BFT_FREE(mc->_x_val_f);
+
     BFT_FREE(mc->_x_val);
 
     BFT_FREE(mc->_d_val);
@@ -3585,6 +4046,39 @@ _map_or_copy_xa_coeffs_msr(cs_matrix_t      *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update single-precision copy of MSR matrix extra-diagonal coefficients.
+ *
+ * The copy is only handled for scalar extra-diagonal coefficients; it is
+ * freed otherwise.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_x_val_f_msr(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  if (matrix->eb_size[3] != 1 || mc->x_val == NULL) {
+    BFT_FREE(mc->_x_val_f);
+    return;
+  }
+
+  if (mc->_x_val_f == NULL)
+    BFT_MALLOC(mc->_x_val_f, ms->row_index[n_rows], float);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++)
+      mc->_x_val_f[jj] = mc->x_val[jj];
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Set MSR matrix coefficients.
  *
@@ -3633,6 +4127,11 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
     if (xa != NULL)
       _set_xa_coeffs_msr_increment(matrix, symmetric, n_edges, edges, xa);
   }
+
+  /* Update single-precision copy if present */
+
+  if (mc->_x_val_f != NULL)
+    _update_x_val_f_msr(matrix);
 }
 
 /*----------------------------------------------------------------------------
@@ -3711,6 +4210,11 @@ _set_coeffs_msr_from_msr(cs_matrix_t       *matrix,
     BFT_FREE(*d_vals_transfer);
   if (x_vals_transfer != NULL)
     BFT_FREE(*x_vals_transfer);
+
+  /* Update single-precision copy if present */
+
+  if (mc->_x_val_f != NULL)
+    _update_x_val_f_msr(matrix);
 }
 
 /*----------------------------------------------------------------------------
@@ -3794,6 +4298,65 @@ _mat_vec_p_l_msr(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector products Y = A.X with MSR matrix, for multiple
+ * vectors, so that matrix coefficients are loaded only once per group of
+ * CS_MATRIX_MULTI_BLOCK vectors.
+ *
+ * Vectors are stored one after the other, with n_cols_ext values each.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   n_vecs       <-- number of vectors
+ *   x            <-- multipliying vectors values
+ *   y            --> resulting vectors
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_multi(const cs_matrix_t  *matrix,
+                       int                 n_vecs,
+                       const cs_real_t    *restrict x,
+                       cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  stride = ms->n_cols_ext;
+
+  const cs_real_t *restrict d_val = mc->d_val;
+
+  for (int s_id = 0; s_id < n_vecs; s_id += CS_MATRIX_MULTI_BLOCK) {
+
+    const int n_b = CS_MIN(CS_MATRIX_MULTI_BLOCK, n_vecs - s_id);
+    const cs_real_t *restrict _x = x + s_id*stride;
+    cs_real_t *restrict _y = y + s_id*stride;
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii[CS_MATRIX_MULTI_BLOCK];
+
+      for (int k = 0; k < n_b; k++)
+        sii[k] = (d_val != NULL) ? d_val[ii]*_x[k*stride + ii] : 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t m_ij = m_row[jj];
+        const cs_lnum_t c_id = col_id[jj];
+        for (int k = 0; k < n_b; k++)
+          sii[k] += m_ij*_x[k*stride + c_id];
+      }
+
+      for (int k = 0; k < n_b; k++)
+        _y[k*stride + ii] = sii[k];
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix.
  *
@@ -4142,7 +4705,8 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix, using MKL
+ * Local matrix.vector product y = A.x with MSR matrix, using the
+ * single-precision copy of extra-diagonal coefficients.
  *
  * parameters:
  *   exclude_diag <-- exclude diagonal if true
@@ -4151,40 +4715,838 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
  *   y            --> resulting vector
  *----------------------------------------------------------------------------*/
 
-#if defined (HAVE_MKL)
-
 static void
-_mat_vec_p_l_msr_mkl(bool                exclude_diag,
-                     const cs_matrix_t  *matrix,
-                     const cs_real_t     x[restrict],
-                     cs_real_t           y[restrict])
+_mat_vec_p_l_msr_f(bool                exclude_diag,
+                   const cs_matrix_t  *matrix,
+                   const cs_real_t    *restrict x,
+                   cs_real_t          *restrict y)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
   const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
 
-  int n_rows = ms->n_rows;
-  char transa[] = "n";
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
 
-  mkl_cspblas_dcsrgemv(transa,
-                       &n_rows,
-                       mc->x_val,
-                       ms->row_index,
-                       ms->col_id,
-                       (double *)x,
-                       y);
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
-  /* Add diagonal contribution */
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->_x_val_f + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t sii = 0.0;
 
-  if (!exclude_diag && mc->d_val != NULL) {
-    cs_lnum_t ii;
-    const double *restrict da = mc->d_val;
-#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++)
-      y[ii] += da[ii] * x[ii];
-  }
-}
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += (m_row[jj]*x[col_id[jj]]);
+
+    if (d_val != NULL)
+      sii += d_val[ii]*x[ii];
+
+    y[ii] = sii;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version,
+ * using the single-precision copy of extra-diagonal coefficients.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_f(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t     x[restrict],
+                     cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const float *restrict m_row = mc->_x_val_f + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (d_val != NULL)
+      _dense_b_ax(ii, db_size, d_val, x, y);
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+        y[ii*db_size[1] + kk]
+          += (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using MKL
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+#if defined (HAVE_MKL)
+
+static void
+_mat_vec_p_l_msr_mkl(bool                exclude_diag,
+                     const cs_matrix_t  *matrix,
+                     const cs_real_t     x[restrict],
+                     cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  int n_rows = ms->n_rows;
+  char transa[] = "n";
+
+  mkl_cspblas_dcsrgemv(transa,
+                       &n_rows,
+                       mc->x_val,
+                       ms->row_index,
+                       ms->col_id,
+                       (double *)x,
+                       y);
+
+  /* Add diagonal contribution */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+    cs_lnum_t ii;
+    const double *restrict da = mc->d_val;
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (ii = 0; ii < n_rows; ii++)
+      y[ii] += da[ii] * x[ii];
+  }
+}
+
+#endif /* defined (HAVE_MKL) */
+
+/*----------------------------------------------------------------------------
+ * Create SELL-C-sigma matrix coefficients.
+ *
+ * returns:
+ *   pointer to allocated SELL coefficients structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_coeff_sell_t *
+_create_coeff_sell(void)
+{
+  cs_matrix_coeff_sell_t  *mc;
+
+  /* Allocate */
+
+  BFT_MALLOC(mc, 1, cs_matrix_coeff_sell_t);
+
+  /* Initialize */
+
+  mc->msr.max_db_size = 0;
+  mc->msr.max_eb_size = 0;
+
+  mc->msr.d_val = NULL;
+  mc->msr.x_val = NULL;
+
+  mc->msr._d_val = NULL;
+  mc->msr._x_val = NULL;
+
+  mc->msr._x_val_f = NULL;
+
+  mc->n_slices = 0;
+
+  mc->slice_index = NULL;
+  mc->row_id = NULL;
+  mc->col_id = NULL;
+  mc->x_val = NULL;
+
+  return mc;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy SELL-C-sigma matrix coefficients.
+ *
+ * parameters:
+ *   coeff  <->  pointer to SELL matrix coefficients pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_coeff_sell(cs_matrix_coeff_sell_t  **coeff)
+{
+  if (coeff != NULL && *coeff !=NULL) {
+
+    cs_matrix_coeff_sell_t  *mc = *coeff;
+
+    BFT_FREE(mc->x_val);
+    BFT_FREE(mc->col_id);
+    BFT_FREE(mc->row_id);
+    BFT_FREE(mc->slice_index);
+
+    BFT_FREE(mc->msr._x_val_f);
+    BFT_FREE(mc->msr._x_val);
+    BFT_FREE(mc->msr._d_val);
+
+    BFT_FREE(*coeff);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build the SELL-C-sigma slice layout matching an MSR structure.
+ *
+ * Rows are sorted by decreasing length inside windows of
+ * CS_MATRIX_SELL_SIGMA rows, and grouped in slices of CS_MATRIX_SELL_C
+ * rows, padded to the length of their longest row. Padding entries
+ * reference the lane's own row (or row 0 for padding lanes), and will
+ * be associated with zero coefficients.
+ *
+ * parameters:
+ *   ms <-- pointer to MSR matrix structure
+ *   mc <-> pointer to SELL matrix coefficients
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_layout_sell(const cs_matrix_struct_csr_t  *ms,
+                   cs_matrix_coeff_sell_t        *mc)
+{
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  c_size = CS_MATRIX_SELL_C;
+
+  const cs_lnum_t  n_slices = (n_rows + c_size - 1) / c_size;
+
+  cs_lnum_t  *order, *key;
+  BFT_MALLOC(order, n_rows, cs_lnum_t);
+  BFT_MALLOC(key, n_rows, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    order[ii] = ii;
+    key[ii] = ms->row_index[ii] - ms->row_index[ii+1];
+  }
+
+  /* Sort rows by decreasing length inside each sorting window */
+
+  for (cs_lnum_t s_id = 0; s_id < n_rows; s_id += CS_MATRIX_SELL_SIGMA) {
+    cs_lnum_t e_id = CS_MIN(s_id + CS_MATRIX_SELL_SIGMA, n_rows);
+    cs_sort_coupled_shell(s_id, e_id, key, order);
+  }
+
+  BFT_FREE(key);
+
+  /* Slice lanes to rows and slice widths */
+
+  BFT_REALLOC(mc->row_id, n_slices*c_size, cs_lnum_t);
+  BFT_REALLOC(mc->slice_index, n_slices + 1, cs_lnum_t);
+
+  mc->slice_index[0] = 0;
+
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+    cs_lnum_t s_width = 0;
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      cs_lnum_t ii = s_id*c_size + kk;
+      if (ii < n_rows) {
+        cs_lnum_t r_id = order[ii];
+        cs_lnum_t n_cols = ms->row_index[r_id+1] - ms->row_index[r_id];
+        mc->row_id[ii] = r_id;
+        s_width = CS_MAX(s_width, n_cols);
+      }
+      else
+        mc->row_id[ii] = -1;
+    }
+    mc->slice_index[s_id+1] = mc->slice_index[s_id] + s_width*c_size;
+  }
+
+  BFT_FREE(order);
+
+  /* Padded column ids (column-major inside each slice) */
+
+  BFT_REALLOC(mc->col_id, mc->slice_index[n_slices], cs_lnum_t);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+    const cs_lnum_t s_start = mc->slice_index[s_id];
+    const cs_lnum_t s_width = (mc->slice_index[s_id+1] - s_start) / c_size;
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      const cs_lnum_t r_id = mc->row_id[s_id*c_size + kk];
+      cs_lnum_t n_cols = 0, c_pad = 0;
+      const cs_lnum_t *restrict col_id = NULL;
+      if (r_id > -1) {
+        n_cols = ms->row_index[r_id+1] - ms->row_index[r_id];
+        col_id = ms->col_id + ms->row_index[r_id];
+        c_pad = r_id;
+      }
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        mc->col_id[s_start + jj*c_size + kk] = col_id[jj];
+      for (cs_lnum_t jj = n_cols; jj < s_width; jj++)
+        mc->col_id[s_start + jj*c_size + kk] = c_pad;
+    }
+  }
+
+  mc->n_slices = n_slices;
+}
+
+/*----------------------------------------------------------------------------
+ * Update sliced SELL-C-sigma extra-diagonal coefficients from the
+ * matching (row-ordered) MSR coefficients.
+ *
+ * Only scalar extra-diagonal coefficients are sliced; with extra-diagonal
+ * blocks, the MSR coefficients are used directly.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack_coeffs_sell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t  c_size = CS_MATRIX_SELL_C;
+
+  if (matrix->eb_size[3] != 1) {
+    BFT_FREE(mc->x_val);
+    return;
+  }
+
+  /* The layout only depends on the structure, so it is built once */
+
+  if (mc->slice_index == NULL)
+    _build_layout_sell(ms, mc);
+
+  const cs_lnum_t  n_slices = mc->n_slices;
+  const cs_real_t  *restrict x_val = mc->msr.x_val;
+
+  if (mc->x_val == NULL)
+    BFT_MALLOC(mc->x_val, mc->slice_index[n_slices], cs_real_t);
+
+# pragma omp parallel for  if(ms->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+    const cs_lnum_t s_start = mc->slice_index[s_id];
+    const cs_lnum_t s_width = (mc->slice_index[s_id+1] - s_start) / c_size;
+    for (cs_lnum_t kk = 0; kk < c_size; kk++) {
+      const cs_lnum_t r_id = mc->row_id[s_id*c_size + kk];
+      cs_lnum_t n_cols = 0;
+      if (r_id > -1 && x_val != NULL) {
+        n_cols = ms->row_index[r_id+1] - ms->row_index[r_id];
+        const cs_real_t *restrict m_row = x_val + ms->row_index[r_id];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          mc->x_val[s_start + jj*c_size + kk] = m_row[jj];
+      }
+      for (cs_lnum_t jj = n_cols; jj < s_width; jj++)
+        mc->x_val[s_start + jj*c_size + kk] = 0.;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL-C-sigma matrix coefficients.
+ *
+ * Coefficients are first set in the leading MSR part, then sliced.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  _set_coeffs_msr(matrix, symmetric, copy, n_edges, edges, da, xa);
+
+  _pack_coeffs_sell(matrix);
+}
+
+/*----------------------------------------------------------------------------
+ * Store the row sums of a SELL-C-sigma slice, adding the diagonal
+ * contribution if present.
+ *
+ * parameters:
+ *   row_id <-- row id for each slice lane (-1 for padding)
+ *   d_val  <-- diagonal values, or NULL
+ *   s      <-- extra-diagonal row sums for each lane
+ *   x      <-- multipliying vector values
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_sell_slice_store(const cs_lnum_t   row_id[restrict],
+                  const cs_real_t   d_val[restrict],
+                  const cs_real_t   s[restrict],
+                  const cs_real_t   x[restrict],
+                  cs_real_t         y[restrict])
+{
+  if (d_val != NULL) {
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      const cs_lnum_t r_id = row_id[kk];
+      if (r_id > -1)
+        y[r_id] = s[kk] + d_val[r_id]*x[r_id];
+    }
+  }
+  else {
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      const cs_lnum_t r_id = row_id[kk];
+      if (r_id > -1)
+        y[r_id] = s[kk];
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Store the row sums of a SELL-C-sigma slice with 3x3 diagonal blocks,
+ * adding the diagonal contribution if present.
+ *
+ * parameters:
+ *   row_id <-- row id for each slice lane (-1 for padding)
+ *   d_val  <-- diagonal values, or NULL
+ *   s      <-- extra-diagonal row sums for each component and lane
+ *   x      <-- multipliying vector values
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_sell_3_3_slice_store(const cs_lnum_t   row_id[restrict],
+                      const cs_real_t   d_val[restrict],
+                      const cs_real_t   s[3][CS_MATRIX_SELL_C],
+                      const cs_real_t   x[restrict],
+                      cs_real_t         y[restrict])
+{
+  for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+    const cs_lnum_t r_id = row_id[kk];
+    if (r_id < 0)
+      continue;
+    if (d_val != NULL)
+      _dense_3_3_ax(r_id, d_val, x, y);
+    else {
+      y[r_id*3] = 0.;
+      y[r_id*3 + 1] = 0.;
+      y[r_id*3 + 2] = 0.;
+    }
+    y[r_id*3]     += s[0][kk];
+    y[r_id*3 + 1] += s[1][kk];
+    y[r_id*3 + 2] += s[2][kk];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell(bool                exclude_diag,
+                  const cs_matrix_t  *matrix,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_slices = mc->n_slices;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
+
+# pragma omp parallel for  if(matrix->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t s_start = mc->slice_index[s_id];
+    const cs_lnum_t s_end = mc->slice_index[s_id+1];
+    const cs_lnum_t *restrict col_id = mc->col_id;
+    const cs_real_t *restrict m_val = mc->x_val;
+
+    cs_real_t s[CS_MATRIX_SELL_C];
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++)
+      s[kk] = 0.;
+
+    for (cs_lnum_t jj = s_start; jj < s_end; jj += CS_MATRIX_SELL_C) {
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++)
+        s[kk] += m_val[jj + kk] * x[col_id[jj + kk]];
+    }
+
+    _sell_slice_store(mc->row_id + s_id*CS_MATRIX_SELL_C, d_val, s, x, y);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * 3x3 blocked diagonal version.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_mat_vec_p_l_sell(bool                exclude_diag,
+                      const cs_matrix_t  *matrix,
+                      const cs_real_t    *restrict x,
+                      cs_real_t          *restrict y)
+{
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_slices = mc->n_slices;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
+
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+
+# pragma omp parallel for  if(matrix->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t s_start = mc->slice_index[s_id];
+    const cs_lnum_t s_end = mc->slice_index[s_id+1];
+    const cs_lnum_t *restrict col_id = mc->col_id;
+    const cs_real_t *restrict m_val = mc->x_val;
+
+    cs_real_t s[3][CS_MATRIX_SELL_C];
+    for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+      s[0][kk] = 0.;
+      s[1][kk] = 0.;
+      s[2][kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = s_start; jj < s_end; jj += CS_MATRIX_SELL_C) {
+      for (cs_lnum_t kk = 0; kk < CS_MATRIX_SELL_C; kk++) {
+        const cs_real_t  v = m_val[jj + kk];
+        const cs_lnum_t  c_id = col_id[jj + kk];
+        s[0][kk] += v * x[c_id*3];
+        s[1][kk] += v * x[c_id*3 + 1];
+        s[2][kk] += v * x[c_id*3 + 2];
+      }
+    }
+
+    _sell_3_3_slice_store(mc->row_id + s_id*CS_MATRIX_SELL_C,
+                          d_val, (const cs_real_t (*)[CS_MATRIX_SELL_C])s,
+                          x, y);
+
+  }
+}
+
+#if defined(CS_MATRIX_SELL_AVX2)
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * using AVX2 gathers (2 registers per slice).
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell_avx2(bool                exclude_diag,
+                       const cs_matrix_t  *matrix,
+                       const cs_real_t    *restrict x,
+                       cs_real_t          *restrict y)
+{
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_slices = mc->n_slices;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
+
+# pragma omp parallel for  if(matrix->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t s_start = mc->slice_index[s_id];
+    const cs_lnum_t s_end = mc->slice_index[s_id+1];
+
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+
+    for (cs_lnum_t jj = s_start; jj < s_end; jj += CS_MATRIX_SELL_C) {
+      const __m128i c0 = _mm_loadu_si128((const __m128i *)(mc->col_id + jj));
+      const __m128i c1
+        = _mm_loadu_si128((const __m128i *)(mc->col_id + jj + 4));
+      const __m256d x0 = _mm256_i32gather_pd(x, c0, 8);
+      const __m256d x1 = _mm256_i32gather_pd(x, c1, 8);
+      s0 = CS_MATRIX_SELL_FMADD_256(_mm256_loadu_pd(mc->x_val + jj), x0, s0);
+      s1 = CS_MATRIX_SELL_FMADD_256(_mm256_loadu_pd(mc->x_val + jj + 4),
+                                    x1, s1);
+    }
+
+    cs_real_t s[CS_MATRIX_SELL_C];
+    _mm256_storeu_pd(s, s0);
+    _mm256_storeu_pd(s + 4, s1);
+
+    _sell_slice_store(mc->row_id + s_id*CS_MATRIX_SELL_C, d_val, s, x, y);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * 3x3 blocked diagonal version, using AVX2 gathers.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_mat_vec_p_l_sell_avx2(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t    *restrict x,
+                           cs_real_t          *restrict y)
+{
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_slices = mc->n_slices;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
 
-#endif /* defined (HAVE_MKL) */
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+
+# pragma omp parallel for  if(matrix->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t s_start = mc->slice_index[s_id];
+    const cs_lnum_t s_end = mc->slice_index[s_id+1];
+
+    __m256d s_v[3][2];
+    for (int ll = 0; ll < 3; ll++) {
+      s_v[ll][0] = _mm256_setzero_pd();
+      s_v[ll][1] = _mm256_setzero_pd();
+    }
+
+    for (cs_lnum_t jj = s_start; jj < s_end; jj += CS_MATRIX_SELL_C) {
+      for (int hh = 0; hh < 2; hh++) {
+        const __m128i c
+          = _mm_loadu_si128((const __m128i *)(mc->col_id + jj + hh*4));
+        const __m128i c3 = _mm_add_epi32(c, _mm_add_epi32(c, c));
+        const __m256d v = _mm256_loadu_pd(mc->x_val + jj + hh*4);
+        for (int ll = 0; ll < 3; ll++) {
+          const __m256d xl = _mm256_i32gather_pd(x + ll, c3, 8);
+          s_v[ll][hh] = CS_MATRIX_SELL_FMADD_256(v, xl, s_v[ll][hh]);
+        }
+      }
+    }
+
+    cs_real_t s[3][CS_MATRIX_SELL_C];
+    for (int ll = 0; ll < 3; ll++) {
+      _mm256_storeu_pd(s[ll], s_v[ll][0]);
+      _mm256_storeu_pd(s[ll] + 4, s_v[ll][1]);
+    }
+
+    _sell_3_3_slice_store(mc->row_id + s_id*CS_MATRIX_SELL_C,
+                          d_val, (const cs_real_t (*)[CS_MATRIX_SELL_C])s,
+                          x, y);
+
+  }
+}
+
+#endif /* defined(CS_MATRIX_SELL_AVX2) */
+
+#if defined(CS_MATRIX_SELL_AVX512)
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * using AVX-512 gathers (1 register per slice).
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell_avx512(bool                exclude_diag,
+                         const cs_matrix_t  *matrix,
+                         const cs_real_t    *restrict x,
+                         cs_real_t          *restrict y)
+{
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_slices = mc->n_slices;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
+
+# pragma omp parallel for  if(matrix->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t s_start = mc->slice_index[s_id];
+    const cs_lnum_t s_end = mc->slice_index[s_id+1];
+
+    __m512d s_v = _mm512_setzero_pd();
+
+    for (cs_lnum_t jj = s_start; jj < s_end; jj += CS_MATRIX_SELL_C) {
+      const __m256i c
+        = _mm256_loadu_si256((const __m256i *)(mc->col_id + jj));
+      const __m512d xg = _mm512_i32gather_pd(c, x, 8);
+      s_v = _mm512_fmadd_pd(_mm512_loadu_pd(mc->x_val + jj), xg, s_v);
+    }
+
+    cs_real_t s[CS_MATRIX_SELL_C];
+    _mm512_storeu_pd(s, s_v);
+
+    _sell_slice_store(mc->row_id + s_id*CS_MATRIX_SELL_C, d_val, s, x, y);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * 3x3 blocked diagonal version, using AVX-512 gathers.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_mat_vec_p_l_sell_avx512(bool                exclude_diag,
+                             const cs_matrix_t  *matrix,
+                             const cs_real_t    *restrict x,
+                             cs_real_t          *restrict y)
+{
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_slices = mc->n_slices;
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->msr.d_val;
+
+  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+
+# pragma omp parallel for  if(matrix->n_rows > CS_THR_MIN)
+  for (cs_lnum_t s_id = 0; s_id < n_slices; s_id++) {
+
+    const cs_lnum_t s_start = mc->slice_index[s_id];
+    const cs_lnum_t s_end = mc->slice_index[s_id+1];
+
+    __m512d s0 = _mm512_setzero_pd();
+    __m512d s1 = _mm512_setzero_pd();
+    __m512d s2 = _mm512_setzero_pd();
+
+    for (cs_lnum_t jj = s_start; jj < s_end; jj += CS_MATRIX_SELL_C) {
+      const __m256i c
+        = _mm256_loadu_si256((const __m256i *)(mc->col_id + jj));
+      const __m256i c3 = _mm256_add_epi32(c, _mm256_add_epi32(c, c));
+      const __m512d v = _mm512_loadu_pd(mc->x_val + jj);
+      s0 = _mm512_fmadd_pd(v, _mm512_i32gather_pd(c3, x, 8), s0);
+      s1 = _mm512_fmadd_pd(v, _mm512_i32gather_pd(c3, x + 1, 8), s1);
+      s2 = _mm512_fmadd_pd(v, _mm512_i32gather_pd(c3, x + 2, 8), s2);
+    }
+
+    cs_real_t s[3][CS_MATRIX_SELL_C];
+    _mm512_storeu_pd(s[0], s0);
+    _mm512_storeu_pd(s[1], s1);
+    _mm512_storeu_pd(s[2], s2);
+
+    _sell_3_3_slice_store(mc->row_id + s_id*CS_MATRIX_SELL_C,
+                          d_val, (const cs_real_t (*)[CS_MATRIX_SELL_C])s,
+                          x, y);
+
+  }
+}
+
+#endif /* defined(CS_MATRIX_SELL_AVX512) */
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * blocked diagonal version.
+ *
+ * Slices are used for 3x3 diagonal blocks; for other block sizes,
+ * the MSR kernels are used on the row-ordered coefficients.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t     x[restrict],
+                    cs_real_t           y[restrict])
+{
+  if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
+    _3_3_mat_vec_p_l_sell(exclude_diag, matrix, x, y);
+  else
+    _b_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+}
+
+#if defined(CS_MATRIX_SELL_AVX2)
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * blocked diagonal version, using AVX2 for 3x3 blocks.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell_avx2(bool                exclude_diag,
+                         const cs_matrix_t  *matrix,
+                         const cs_real_t     x[restrict],
+                         cs_real_t           y[restrict])
+{
+  if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
+    _3_3_mat_vec_p_l_sell_avx2(exclude_diag, matrix, x, y);
+  else
+    _b_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+}
+
+#endif /* defined(CS_MATRIX_SELL_AVX2) */
+
+#if defined(CS_MATRIX_SELL_AVX512)
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * blocked diagonal version, using AVX-512 for 3x3 blocks.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell_avx512(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t     x[restrict],
+                           cs_real_t           y[restrict])
+{
+  if (matrix->db_size[0] == 3 && matrix->db_size[3] == 9)
+    _3_3_mat_vec_p_l_sell_avx512(exclude_diag, matrix, x, y);
+  else
+    _b_mat_vec_p_l_msr(exclude_diag, matrix, x, y);
+}
+
+#endif /* defined(CS_MATRIX_SELL_AVX512) */
 
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
@@ -4379,6 +5741,12 @@ _variant_add(const char                        *name,
  *     omp_sched       (Improved scheduling for OpenMP)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL    (scalar and diagonal block fill types)
+ *     default         (widest SIMD variant available)
+ *     standard        (portable C)
+ *     avx2            (with AVX2)
+ *     avx512          (with AVX-512)
+ *
  * parameters:
  *   m_type          <-- Matrix type
  *   numbering       <-- mesh numbering type, or NULL
@@ -4535,6 +5903,18 @@ _set_spmv_func(cs_matrix_type_t             m_type,
       }
     }
 
+    else if (!strcmp(func_name, "gather")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_native_gather;
+        spmv[1] = _mat_vec_p_l_native_gather;
+        break;
+      default:
+        break;
+      }
+    }
+
     break;
 
   case CS_MATRIX_CSR:
@@ -4633,6 +6013,116 @@ _set_spmv_func(cs_matrix_type_t             m_type,
 
     break;
 
+  case CS_MATRIX_SELL:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_sell;
+        spmv[1] = _mat_vec_p_l_sell;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell;
+        spmv[1] = _b_mat_vec_p_l_sell;
+        break;
+      default:
+        break;
+      }
+    }
+
+    if (standard > 1) { /* default: widest available SIMD variant */
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+#if defined(CS_MATRIX_SELL_AVX512)
+        spmv[0] = _mat_vec_p_l_sell_avx512;
+        spmv[1] = _mat_vec_p_l_sell_avx512;
+#elif defined(CS_MATRIX_SELL_AVX2)
+        spmv[0] = _mat_vec_p_l_sell_avx2;
+        spmv[1] = _mat_vec_p_l_sell_avx2;
+#endif
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+#if defined(CS_MATRIX_SELL_AVX512)
+        spmv[0] = _b_mat_vec_p_l_sell_avx512;
+        spmv[1] = _b_mat_vec_p_l_sell_avx512;
+#elif defined(CS_MATRIX_SELL_AVX2)
+        spmv[0] = _b_mat_vec_p_l_sell_avx2;
+        spmv[1] = _b_mat_vec_p_l_sell_avx2;
+#endif
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "avx2")) {
+#if defined(CS_MATRIX_SELL_AVX2)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_sell_avx2;
+        spmv[1] = _mat_vec_p_l_sell_avx2;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell_avx2;
+        spmv[1] = _b_mat_vec_p_l_sell_avx2;
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
+    else if (!strcmp(func_name, "avx512")) {
+#if defined(CS_MATRIX_SELL_AVX512)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_sell_avx512;
+        spmv[1] = _mat_vec_p_l_sell_avx512;
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        spmv[0] = _b_mat_vec_p_l_sell_avx512;
+        spmv[1] = _b_mat_vec_p_l_sell_avx512;
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
+    break;
+
+  case CS_MATRIX_CONV_DIFF:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_conv_diff;
+        spmv[1] = _mat_vec_p_l_conv_diff;
+        break;
+      default:
+        break;
+      }
+    }
+
+    break;
+
   default:
     break;
   }
@@ -4777,6 +6267,7 @@ _structure_destroy(cs_matrix_type_t   type,
 {
   switch(type) {
   case CS_MATRIX_NATIVE:
+  case CS_MATRIX_CONV_DIFF:
     {
       cs_matrix_struct_native_t *_structure = *structure;
       _destroy_struct_native(&_structure);
@@ -4798,6 +6289,7 @@ _structure_destroy(cs_matrix_type_t   type,
     }
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       cs_matrix_struct_csr_t *_structure = *structure;
       _destroy_struct_csr(&_structure);
@@ -4874,6 +6366,12 @@ _matrix_create(cs_matrix_type_t  type)
   case CS_MATRIX_MSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_sell();
+    break;
+  case CS_MATRIX_CONV_DIFF:
+    m->coeffs = _create_coeff_conv_diff();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4924,18 +6422,116 @@ _matrix_create(cs_matrix_type_t  type)
     m->copy_diagonal = _copy_diagonal_separate;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_msr;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
+  case CS_MATRIX_CONV_DIFF:
+    m->set_coefficients = _set_coeffs_conv_diff;
+    m->release_coefficients = _release_coeffs_conv_diff;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
   default:
     assert(0);
     break;
 
   }
 
-  for (i = 0; i < CS_MATRIX_N_FILL_TYPES; i++) {
-    if (m->vector_multiply[i][1] == NULL)
-      m->vector_multiply[i][1] = m->vector_multiply[i][0];
-  }
+  for (i = 0; i < CS_MATRIX_N_FILL_TYPES; i++) {
+    if (m->vector_multiply[i][1] == NULL)
+      m->vector_multiply[i][1] = m->vector_multiply[i][0];
+  }
+
+  return m;
+}
+
+/*============================================================================
+ * Semi-private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build row -> edges adjacency of native matrix coefficients, for
+ * gather-based matrix.vector products.
+ *
+ * This allows row by row products, which are thread-safe without
+ * requiring a specific edge numbering. As it costs about 4 extra integers
+ * per edge, it is only built for matrices to which the gather-based
+ * product is applied (or for the copy used to time it when tuning),
+ * never from the product kernel itself.
+ *
+ * parameters:
+ *   ms  <-- pointer to native matrix structure
+ *   mc  <-> pointer to native matrix coefficients
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_build_coeff_native_rows(const cs_matrix_struct_native_t  *ms,
+                                  cs_matrix_coeff_native_t         *mc)
+{
+  if (mc->row_index != NULL)
+    return;
+
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_2_t *restrict edges = ms->edges;
+
+  BFT_MALLOC(mc->row_index, n_rows + 1, cs_lnum_t);
+
+  cs_lnum_t *restrict row_index = mc->row_index;
+
+  for (cs_lnum_t i = 0; i < n_rows + 1; i++)
+    row_index[i] = 0;
+
+  for (cs_lnum_t e_id = 0; e_id < ms->n_edges; e_id++) {
+    for (cs_lnum_t j = 0; j < 2; j++) {
+      cs_lnum_t r_id = edges[e_id][j];
+      if (r_id < n_rows)
+        row_index[r_id + 1] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    row_index[i+1] += row_index[i];
+
+  BFT_MALLOC(mc->row_col_id, row_index[n_rows], cs_lnum_t);
+  BFT_MALLOC(mc->row_xa_id, row_index[n_rows], cs_lnum_t);
+
+  cs_lnum_t *row_count;
+  BFT_MALLOC(row_count, n_rows, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    row_count[i] = row_index[i];
+
+  for (cs_lnum_t e_id = 0; e_id < ms->n_edges; e_id++) {
+    for (cs_lnum_t j = 0; j < 2; j++) {
+      cs_lnum_t r_id = edges[e_id][j];
+      if (r_id < n_rows) {
+        cs_lnum_t k = row_count[r_id];
+        mc->row_col_id[k] = edges[e_id][1-j];
+        mc->row_xa_id[k] = 2*e_id + j;
+        row_count[r_id] += 1;
+      }
+    }
+  }
+
+  BFT_FREE(row_count);
+}
 
-  return m;
+/*----------------------------------------------------------------------------
+ * Free row -> edges adjacency of native matrix coefficients.
+ *
+ * parameters:
+ *   mc  <-> pointer to native matrix coefficients
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_free_coeff_native_rows(cs_matrix_coeff_native_t  *mc)
+{
+  BFT_FREE(mc->row_index);
+  BFT_FREE(mc->row_col_id);
+  BFT_FREE(mc->row_xa_id);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -4997,6 +6593,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 
   switch(ms->type) {
   case CS_MATRIX_NATIVE:
+  case CS_MATRIX_CONV_DIFF:
     ms->structure = _create_struct_native(n_rows,
                                           n_cols_ext,
                                           n_edges,
@@ -5017,6 +6614,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                            edges);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     ms->structure = _create_struct_csr(false,
                                        n_rows,
                                        n_cols_ext,
@@ -5104,6 +6702,7 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                                 col_id);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     ms->structure = _create_struct_csr_from_csr(false,
                                                 transfer,
                                                 false,
@@ -5378,6 +6977,12 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
   case CS_MATRIX_MSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_sell();
+    break;
+  case CS_MATRIX_CONV_DIFF:
+    m->coeffs = _create_coeff_conv_diff();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -5510,6 +7115,20 @@ cs_matrix_destroy(cs_matrix_t **matrix)
         m->coeffs = NULL;
       }
       break;
+    case CS_MATRIX_SELL:
+      {
+        cs_matrix_coeff_sell_t *coeffs = m->coeffs;
+        _destroy_coeff_sell(&coeffs);
+        m->coeffs = NULL;
+      }
+      break;
+    case CS_MATRIX_CONV_DIFF:
+      {
+        cs_matrix_coeff_conv_diff_t *coeffs = m->coeffs;
+        _destroy_coeff_conv_diff(&coeffs);
+        m->coeffs = NULL;
+      }
+      break;
     default:
       assert(0);
       break;
@@ -5599,6 +7218,7 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
 
   switch(matrix->type) {
   case CS_MATRIX_NATIVE:
+  case CS_MATRIX_CONV_DIFF:
     {
       const cs_matrix_struct_native_t  *ms = matrix->structure;
       retval = ms->n_edges*2 + ms->n_rows;
@@ -5617,6 +7237,7 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
     }
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       const cs_matrix_struct_csr_t  *ms = matrix->structure;
       retval = ms->row_index[ms->n_rows] + ms->n_rows;
@@ -5955,6 +7576,18 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                              x_val);
     break;
 
+  case CS_MATRIX_SELL:
+    _set_coeffs_msr_from_msr(matrix,
+                             false, /* ignored in case of transfer */
+                             row_index,
+                             col_id,
+                             d_val_p,
+                             d_val,
+                             x_val_p,
+                             x_val);
+    _pack_coeffs_sell(matrix);
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -5965,6 +7598,75 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set coefficients of a matrix-free convection-diffusion operator.
+ *
+ * The matrix must be of type \ref CS_MATRIX_CONV_DIFF, whose structure is
+ * based on the mesh interior faces. Only the diagonal is provided
+ * (usually computed with \ref cs_matrix_wrapper_scalar_diag); extra-diagonal
+ * terms are evaluated from the face mass fluxes and viscosities at each
+ * matrix-vector product, using the same upwind expressions as
+ * \ref cs_matrix_scalar. Arrays are mapped, not copied, so they must
+ * remain available until \ref cs_matrix_release_coefficients is called.
+ *
+ * \param[in, out]  matrix      pointer to matrix structure
+ * \param[in]       symmetric   indicates if matrix coefficients are
+ *                              symmetric (convection is ignored if true)
+ * \param[in]       iconvp      indicator
+ *                               - 1 advection
+ *                               - 0 otherwise
+ * \param[in]       idiffp      indicator
+ *                               - 1 diffusion
+ *                               - 0 otherwise
+ * \param[in]       thetap      weighting coefficient for the theta-scheme
+ * \param[in]       da          diagonal values
+ * \param[in]       i_massflux  mass flux at interior faces
+ * \param[in]       i_visc      \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                              at interior faces for the matrix
+ * \param[in]       xcpp        array of specific heat (Cp), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_conv_diff_coefficients(cs_matrix_t      *matrix,
+                                     bool              symmetric,
+                                     int               iconvp,
+                                     int               idiffp,
+                                     double            thetap,
+                                     const cs_real_t  *da,
+                                     const cs_real_t  *i_massflux,
+                                     const cs_real_t  *i_visc,
+                                     const cs_real_t  *xcpp)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_CONV_DIFF)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("%s: matrix format %s is not a matrix-free operator."),
+       __func__, cs_matrix_type_name[matrix->type]);
+
+  cs_base_check_bool(&symmetric);
+
+  _set_fill_info(matrix, symmetric, NULL, NULL);
+
+  matrix->xa = NULL;
+  matrix->set_coefficients(matrix, symmetric, false, 0, NULL, da, NULL);
+
+  cs_matrix_coeff_conv_diff_t  *mc = matrix->coeffs;
+
+  mc->iconvp = iconvp;
+  mc->idiffp = idiffp;
+  mc->thetap = thetap;
+
+  mc->i_massflux = i_massflux;
+  mc->i_visc = i_visc;
+  mc->xcpp = xcpp;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Release shared matrix coefficients.
@@ -6184,6 +7886,22 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     }
     break;
 
+  case CS_MATRIX_CONV_DIFF:
+    {
+      cs_matrix_coeff_conv_diff_t *mc = matrix->coeffs;
+      if (mc->da == NULL) {
+        cs_lnum_t n_rows = matrix->n_rows;
+        if (mc->_da == NULL)
+          BFT_MALLOC(mc->_da, matrix->n_rows, cs_real_t);
+#       pragma omp parallel for  if(n_rows > CS_THR_MIN)
+        for (ii = 0; ii < n_rows; ii++)
+          mc->_da[ii] = 0.0;
+        mc->da = mc->_da;
+      }
+      diag = mc->da;
+    }
+    break;
+
   case CS_MATRIX_CSR:
     {
       cs_matrix_coeff_csr_t *mc = matrix->coeffs;
@@ -6213,6 +7931,7 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       cs_matrix_coeff_msr_t *mc = matrix->coeffs;
       if (mc->d_val == NULL) {
@@ -6596,6 +8315,118 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
        cs_matrix_type_name[matrix->type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Use a single-precision copy of MSR matrix extra-diagonal
+ * coefficients for matrix-vector products.
+ *
+ * The copy is updated automatically when coefficients are assigned
+ * again; diagonal values remain in double precision. The double-precision
+ * extra-diagonal values are kept, so this adds memory unless they are
+ * freed (see \ref cs_matrix_free_msr_x_val). The matrix-vector
+ * product functions for the current fill type are replaced by
+ * single-precision coefficient variants (overriding any tuned variant).
+ *
+ * This is only handled for MSR matrices with scalar extra-diagonal
+ * coefficients; the call is ignored in other cases.
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_msr_x_val_f(cs_matrix_t  *matrix)
+{
+  if (   matrix->type != CS_MATRIX_MSR
+      || matrix->eb_size[3] != 1)
+    return;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc->x_val == NULL)
+    return;
+
+  _update_x_val_f_msr(matrix);
+
+  cs_matrix_vector_product_t *spmv = NULL;
+
+  switch(matrix->fill_type) {
+  case CS_MATRIX_SCALAR:
+  case CS_MATRIX_SCALAR_SYM:
+    spmv = _mat_vec_p_l_msr_f;
+    break;
+  case CS_MATRIX_BLOCK_D:
+  case CS_MATRIX_BLOCK_D_66:
+  case CS_MATRIX_BLOCK_D_SYM:
+    spmv = _b_mat_vec_p_l_msr_f;
+    break;
+  default:
+    break;
+  }
+
+  if (spmv != NULL) {
+    matrix->vector_multiply[matrix->fill_type][0] = spmv;
+    matrix->vector_multiply[matrix->fill_type][1] = spmv;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get single-precision copy of MSR matrix extra-diagonal values.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ *
+ * \return  pointer to single-precision values, or NULL if not used
+ *          (see \ref cs_matrix_set_msr_x_val_f)
+ */
+/*----------------------------------------------------------------------------*/
+
+const float *
+cs_matrix_get_msr_x_val_f(const cs_matrix_t  *matrix)
+{
+  const float *x_val_f = NULL;
+
+  if (matrix->type == CS_MATRIX_MSR) {
+    const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+    if (mc != NULL)
+      x_val_f = mc->_x_val_f;
+  }
+
+  return x_val_f;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free double-precision MSR matrix extra-diagonal values once a
+ * single-precision copy is used.
+ *
+ * Matrix-vector products and smoothers using the single-precision copy
+ * remain available, but extra-diagonal values are not returned anymore by
+ * \ref cs_matrix_get_msr_arrays, so operations requiring them in double
+ * precision may not be used. Assigning coefficients again restores them.
+ *
+ * The call is ignored if no single-precision copy is present, or if the
+ * double-precision values are shared.
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_free_msr_x_val(cs_matrix_t  *matrix)
+{
+  if (matrix->type != CS_MATRIX_MSR)
+    return;
+
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc == NULL || mc->_x_val_f == NULL || mc->_x_val == NULL)
+    return;
+
+  BFT_FREE(mc->_x_val);
+  mc->x_val = NULL;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x
@@ -6635,6 +8466,86 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
        cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Matrix.vector products Y = A.X for multiple vectors.
+ *
+ * Vectors are stored one after the other, each with
+ * cs_matrix_get_n_columns(matrix) * diag block size values.
+ *
+ * For scalar matrices with native or MSR storage, matrix coefficients are
+ * loaded once for a group of vectors rather than once per vector, which
+ * reduces memory traffic when several systems share the same matrix.
+ * In other cases, products are simply done vector by vector.
+ *
+ * This function includes a halo update of each vector of X prior to
+ * multiplication by A.
+ *
+ * \param[in]       rotation_mode  halo update option for
+ *                                 rotational periodicity
+ * \param[in]       matrix         pointer to matrix structure
+ * \param[in]       n_vecs         number of vectors
+ * \param[in, out]  x              multipliying vectors values
+ *                                 (ghost values updated)
+ * \param[out]      y              resulting vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(cs_halo_rotation_t   rotation_mode,
+                                const cs_matrix_t   *matrix,
+                                int                  n_vecs,
+                                cs_real_t           *restrict x,
+                                cs_real_t           *restrict y)
+{
+  assert(matrix != NULL);
+
+  const cs_lnum_t stride = matrix->n_cols_ext * matrix->db_size[1];
+
+  if (matrix->halo != NULL) {
+    for (int k = 0; k < n_vecs; k++)
+      _pre_vector_multiply_sync(rotation_mode,
+                                matrix,
+                                x + k*stride,
+                                y + k*stride);
+  }
+
+  bool multi = false;
+
+  if (   n_vecs > 1
+      && (   matrix->fill_type == CS_MATRIX_SCALAR
+          || matrix->fill_type == CS_MATRIX_SCALAR_SYM)) {
+
+    if (matrix->type == CS_MATRIX_NATIVE) {
+      _mat_vec_p_l_native_multi(matrix, n_vecs, x, y);
+      multi = true;
+    }
+    else if (matrix->type == CS_MATRIX_MSR) {
+      const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+      if (mc->x_val != NULL && mc->_x_val_f == NULL) {
+        _mat_vec_p_l_msr_multi(matrix, n_vecs, x, y);
+        multi = true;
+      }
+    }
+
+  }
+
+  if (multi)
+    return;
+
+  if (matrix->vector_multiply[matrix->fill_type][0] == NULL)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Matrix is missing a vector multiply function for fill type %s."),
+       cs_matrix_fill_type_name[matrix->fill_type]);
+
+  for (int k = 0; k < n_vecs; k++)
+    matrix->vector_multiply[matrix->fill_type][0](false,
+                                                  matrix,
+                                                  x + k*stride,
+                                                  y + k*stride);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x with no prior halo update of x.
@@ -7198,6 +9109,25 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
 #endif
 
+      switch(m->fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        vector_multiply = _mat_vec_p_l_native_gather;
+        break;
+      default:
+        vector_multiply = NULL;
+      }
+
+      if (vector_multiply != NULL)
+        _variant_add(_("native, gather"),
+                     m->type,
+                     m->fill_type,
+                     2, /* ed_flag */
+                     vector_multiply,
+                     n_variants,
+                     &n_variants_max,
+                     m_variant);
+
       if (m->numbering->type == CS_NUMBERING_VECTORIZE) {
 
         switch(m->fill_type) {
@@ -7385,6 +9315,87 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
   }
 
+  if (m->type == CS_MATRIX_SELL) {
+
+    switch(m->fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      vector_multiply = _mat_vec_p_l_sell;
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+      vector_multiply = _b_mat_vec_p_l_sell;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("SELL"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#if defined(CS_MATRIX_SELL_AVX2)
+
+    switch(m->fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      vector_multiply = _mat_vec_p_l_sell_avx2;
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+      vector_multiply = _b_mat_vec_p_l_sell_avx2;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("SELL, with AVX2"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#endif /* defined(CS_MATRIX_SELL_AVX2) */
+
+#if defined(CS_MATRIX_SELL_AVX512)
+
+    switch(m->fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      vector_multiply = _mat_vec_p_l_sell_avx512;
+      break;
+    case CS_MATRIX_BLOCK_D:
+    case CS_MATRIX_BLOCK_D_66:
+    case CS_MATRIX_BLOCK_D_SYM:
+      vector_multiply = _b_mat_vec_p_l_sell_avx512;
+      break;
+    default:
+      vector_multiply = NULL;
+    }
+
+    _variant_add(_("SELL, with AVX-512"),
+                 m->type,
+                 m->fill_type,
+                 2, /* ed_flag */
+                 vector_multiply,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#endif /* defined(CS_MATRIX_SELL_AVX512) */
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_variant_t);
 }
@@ -7426,6 +9437,17 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
 
   for (int i = 0; i < 2; i++)
     m->vector_multiply[m->fill_type][0] = mv->vector_multiply[0];
+
+  /* Row adjacency is only kept for matrices using the gather product */
+
+  if (m->type == CS_MATRIX_NATIVE && m->coeffs != NULL) {
+    cs_matrix_coeff_native_t *mc = m->coeffs;
+    if (   mv->vector_multiply[0] == _mat_vec_p_l_native_gather
+        || mv->vector_multiply[1] == _mat_vec_p_l_native_gather)
+      cs_matrix_build_coeff_native_rows(m->structure, mc);
+    else
+      cs_matrix_free_coeff_native_rows(mc);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -7441,6 +9463,8 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     omp             (for OpenMP with compatible numbering)
  *     omp_atomic      (for OpenMP with atomics)
  *     vector          (For vector machine with compatible numbering)
+ *     gather          (row-based gather, for CS_MATRIX_SCALAR or
+ *                      CS_MATRIX_SCALAR_SYM)
  *
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     default
@@ -7458,6 +9482,12 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
  *
+ *   CS_MATRIX_SELL    (scalar and diagonal block fill types)
+ *     default         (widest SIMD variant available)
+ *     standard        (portable C)
+ *     avx2            (with AVX2)
+ *     avx512          (with AVX-512)
+ *
  * parameters:
  *   mv        <-> Pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
@@ -59,6 +59,11 @@ typedef enum {
   CS_MATRIX_CSR_SYM,          /*!< Compressed Symmetric Sparse Row storage */
   CS_MATRIX_MSR,              /*!< Modified Compressed Sparse Row storage
                                 (separate diagonal) */
+  CS_MATRIX_SELL,             /*!< Sliced ELLPACK (SELL-C-sigma) storage
+                                (separate diagonal, MSR-based) */
+  CS_MATRIX_CONV_DIFF,        /*!< Matrix-free convection-diffusion operator
+                                (diagonal + face fluxes and viscosities,
+                                scalar only) */
 
   CS_MATRIX_N_BUILTIN_TYPES,  /*!< Number of known and built-in matrix types */
 
@@ -568,6 +573,38 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                                     cs_real_t          **d_val,
                                     cs_real_t          **x_val);
 
+/*----------------------------------------------------------------------------
+ * Set coefficients of a matrix-free convection-diffusion operator.
+ *
+ * The matrix must be of type CS_MATRIX_CONV_DIFF. Only the diagonal is
+ * provided; extra-diagonal terms are evaluated from the face mass fluxes
+ * and viscosities at each matrix-vector product, using the same upwind
+ * expressions as cs_matrix_scalar(). Arrays are mapped, not copied.
+ *
+ * parameters:
+ *   matrix     <-> pointer to matrix structure
+ *   symmetric  <-- indicates if matrix coefficients are symmetric
+ *                  (convection is ignored if true)
+ *   iconvp     <-- 1 for advection, 0 otherwise
+ *   idiffp     <-- 1 for diffusion, 0 otherwise
+ *   thetap     <-- weighting coefficient for the theta-scheme
+ *   da         <-- diagonal values
+ *   i_massflux <-- mass flux at interior faces
+ *   i_visc     <-- face viscosity at interior faces for the matrix
+ *   xcpp       <-- array of specific heat (Cp), or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_conv_diff_coefficients(cs_matrix_t      *matrix,
+                                     bool              symmetric,
+                                     int               iconvp,
+                                     int               idiffp,
+                                     double            thetap,
+                                     const cs_real_t  *da,
+                                     const cs_real_t  *i_massflux,
+                                     const cs_real_t  *i_visc,
+                                     const cs_real_t  *xcpp);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create and initialize a CSR matrix assembler values structure.
@@ -804,6 +841,60 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
                          const cs_real_t    **d_val,
                          const cs_real_t    **x_val);
 
+/*----------------------------------------------------------------------------
+ * Use a single-precision copy of MSR matrix extra-diagonal coefficients
+ * for matrix-vector products.
+ *
+ * The copy is updated automatically when coefficients are assigned
+ * again; diagonal values remain in double precision. The double-precision
+ * extra-diagonal values are kept, so this adds memory unless they are
+ * freed (see cs_matrix_free_msr_x_val). The matrix-vector
+ * product functions for the current fill type are replaced by
+ * single-precision coefficient variants (overriding any tuned variant).
+ *
+ * This is only handled for MSR matrices with scalar extra-diagonal
+ * coefficients; the call is ignored in other cases.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_msr_x_val_f(cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------
+ * Get single-precision copy of MSR matrix extra-diagonal values.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *
+ * returns:
+ *   pointer to single-precision values, or NULL if not used
+ *   (see cs_matrix_set_msr_x_val_f)
+ *----------------------------------------------------------------------------*/
+
+const float *
+cs_matrix_get_msr_x_val_f(const cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------
+ * Free double-precision MSR matrix extra-diagonal values once a
+ * single-precision copy is used.
+ *
+ * Matrix-vector products and smoothers using the single-precision copy
+ * remain available, but extra-diagonal values are not returned anymore by
+ * cs_matrix_get_msr_arrays, so operations requiring them in double
+ * precision may not be used. Assigning coefficients again restores them.
+ *
+ * The call is ignored if no single-precision copy is present, or if the
+ * double-precision values are shared.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_free_msr_x_val(cs_matrix_t  *matrix);
+
 /*----------------------------------------------------------------------------
  * Assign functions based on a variant to a given matrix.
  *
@@ -840,6 +931,31 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
                           cs_real_t           *restrict x,
                           cs_real_t           *restrict y);
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector products Y = A.X for multiple vectors.
+ *
+ * Vectors are stored one after the other, each with
+ * cs_matrix_get_n_columns(matrix) * diag block size values.
+ * For scalar native or MSR matrices, coefficients are loaded only once
+ * for a group of vectors.
+ *
+ * This function includes a halo update of X prior to multiplication by A.
+ *
+ * parameters:
+ *   rotation_mode --> halo update option for rotational periodicity
+ *   matrix        --> pointer to matrix structure
+ *   n_vecs        --> number of vectors
+ *   x             <-> multipliying vectors values (ghost values updated)
+ *   y             --> resulting vectors
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(cs_halo_rotation_t   rotation_mode,
+                                const cs_matrix_t   *matrix,
+                                int                  n_vecs,
+                                cs_real_t           *restrict x,
+                                cs_real_t           *restrict y);
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with no prior halo update of x.
  *
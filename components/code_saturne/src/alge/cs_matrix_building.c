@@ -207,8 +207,6 @@ cs_matrix_wrapper_scalar(int               iconvp,
                          cs_real_t         xa[])
 {
   const cs_mesh_t *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-  const cs_lnum_t n_cells = m->n_cells;
 
   if (isym != 1 && isym != 2) {
     bft_error(__FILE__, __LINE__, 0,
@@ -249,6 +247,22 @@ cs_matrix_wrapper_scalar(int               iconvp,
 
   /* Penalization if non invertible matrix */
 
+  cs_matrix_wrapper_scalar_penalize(ndircp, da);
+}
+
+/*----------------------------------------------------------------------------
+ * Diagonal penalization applied by cs_matrix_wrapper_scalar, for use
+ * when scalar matrix coefficients are computed by other means
+ * (see cs_convection_diffusion_matrix_scalar)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_penalize(int        ndircp,
+                                  cs_real_t  da[])
+{
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
   /* If no Dirichlet condition, the diagonal is slightly increased in order
      to shift the eigenvalues spectrum (if IDIRCL=0, we force NDIRCP to be at
      least 1 in order not to shift the diagonal). */
@@ -269,7 +283,6 @@ cs_matrix_wrapper_scalar(int               iconvp,
       da[cell_id] += mq->c_disable_flag[cell_id];
     }
   }
-
 }
 
 /*----------------------------------------------------------------------------
@@ -377,6 +390,125 @@ cs_matrix_wrapper_scalar_conv_diff(int               iconvp,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Diagonal-only counterpart of cs_matrix_wrapper_scalar, for use with
+ * matrix-free operators (see cs_matrix_set_conv_diff_coefficients):
+ * extra-diagonal terms are computed on the fly and not stored.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_diag(int               iconvp,
+                              int               idiffp,
+                              int               ndircp,
+                              int               isym,
+                              double            thetap,
+                              int               imucpp,
+                              const cs_real_t   coefbp[],
+                              const cs_real_t   cofbfp[],
+                              const cs_real_t   rovsdt[],
+                              const cs_real_t   i_massflux[],
+                              const cs_real_t   b_massflux[],
+                              const cs_real_t   i_visc[],
+                              const cs_real_t   b_visc[],
+                              const cs_real_t   xcpp[],
+                              cs_real_t         da[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  if (isym != 1 && isym != 2) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isym"));
+  }
+
+  /* The symmetric matrix has no convection part */
+
+  const int _iconvp = (isym == 1) ? 0 : iconvp;
+
+  /* 1. Initialization */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    da[cell_id] = rovsdt[cell_id];
+  }
+  if (n_cells_ext > n_cells) {
+#   pragma omp parallel for if (n_cells_ext - n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++) {
+      da[cell_id] = 0.;
+    }
+  }
+
+  /* 2. Contribution of the extra-diagonal terms to the diagonal,
+        with the same expressions as in cs_matrix_scalar */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, _iconvp, idiffp)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        double flui = 0.5*(i_massflux[face_id] -fabs(i_massflux[face_id]));
+        double fluj =-0.5*(i_massflux[face_id] +fabs(i_massflux[face_id]));
+
+        double cpi = 1., cpj = 1.;
+        if (imucpp != 0) {
+          cpi = xcpp[ii];
+          cpj = xcpp[jj];
+        }
+
+        double xa_ij = thetap*(_iconvp*cpi*flui -idiffp*i_visc[face_id]);
+        double xa_ji = thetap*(_iconvp*cpj*fluj -idiffp*i_visc[face_id]);
+
+        da[ii] -= xa_ij + _iconvp*(1. - thetap)*cpi*i_massflux[face_id];
+        da[jj] -= xa_ji - _iconvp*(1. - thetap)*cpj*i_massflux[face_id];
+
+      }
+    }
+  }
+
+  /* 3. Contribution of boundary faces to the diagonal */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, _iconvp, idiffp) \
+               if(m->n_b_faces > CS_THR_MIN)
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        double flui = 0.5*(b_massflux[face_id] - fabs(b_massflux[face_id]));
+        double cpi = (imucpp != 0) ? xcpp[ii] : 1.;
+
+        da[ii] += _iconvp*cpi*(flui*thetap*(coefbp[face_id]-1.)
+                              -(1.-thetap)*b_massflux[face_id])
+                + idiffp*thetap*b_visc[face_id]*cofbfp[face_id];
+      }
+    }
+  }
+
+  /* Penalization if non invertible matrix */
+
+  cs_matrix_wrapper_scalar_penalize(ndircp, da);
+}
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_vector (or its counterpart for
  * symmetric matrices)
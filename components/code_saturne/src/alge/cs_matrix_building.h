@@ -124,6 +124,16 @@ cs_matrix_wrapper_scalar(int               iconvp,
                          cs_real_t         da[],
                          cs_real_t         xa[]);
 
+/*----------------------------------------------------------------------------
+ * Diagonal penalization applied by cs_matrix_wrapper_scalar, for use
+ * when scalar matrix coefficients are computed by other means
+ * (see cs_convection_diffusion_matrix_scalar)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_penalize(int        ndircp,
+                                  cs_real_t  da[]);
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar for convection/diffusion multigrid
  *----------------------------------------------------------------------------*/
@@ -149,6 +159,28 @@ cs_matrix_wrapper_scalar_conv_diff(int               iconvp,
                                    cs_real_t         da_diff[],
                                    cs_real_t         xa_diff[]);
 
+/*----------------------------------------------------------------------------
+ * Diagonal-only counterpart of cs_matrix_wrapper_scalar, for use with
+ * matrix-free operators (see cs_matrix_set_conv_diff_coefficients)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_diag(int               iconvp,
+                              int               idiffp,
+                              int               ndircp,
+                              int               isym,
+                              double            thetap,
+                              int               imucpp,
+                              const cs_real_t   coefbp[],
+                              const cs_real_t   cofbfp[],
+                              const cs_real_t   rovsdt[],
+                              const cs_real_t   i_massflux[],
+                              const cs_real_t   b_massflux[],
+                              const cs_real_t   i_visc[],
+                              const cs_real_t   b_visc[],
+                              const cs_real_t   xcpp[],
+                              cs_real_t         da[]);
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_vector (or its counterpart for
  * symmetric matrices)
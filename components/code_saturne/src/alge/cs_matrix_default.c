@@ -552,6 +552,11 @@ cs_matrix_default(bool             symmetric,
       t = CS_MATRIX_NATIVE;
   }
 
+  /* Matrix-free operators can not be assigned from native coefficients */
+
+  else if (t == CS_MATRIX_CONV_DIFF)
+    t = CS_MATRIX_NATIVE;
+
   m = _get_matrix(t);
 
   return m;
@@ -609,6 +614,22 @@ cs_matrix_native(bool              symmetric,
   return _get_matrix(CS_MATRIX_NATIVE);
 }
 
+/*----------------------------------------------------------------------------
+ * Return matrix-free convection-diffusion operator for scalar systems
+ *
+ * Coefficients of the returned matrix must be set using
+ * cs_matrix_set_conv_diff_coefficients().
+ *
+ * returns:
+ *   pointer to matrix-free operator
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_t  *
+cs_matrix_conv_diff(void)
+{
+  return _get_matrix(CS_MATRIX_CONV_DIFF);
+}
+
 /*----------------------------------------------------------------------------
  * Determine or apply default tuning for a given matrix type
  *
@@ -157,6 +157,19 @@ cs_matrix_native(bool              symmetric,
                  const cs_lnum_t  *diag_block_size,
                  const cs_lnum_t  *extra_diag_block_size);
 
+/*----------------------------------------------------------------------------
+ * Return matrix-free convection-diffusion operator for scalar systems
+ *
+ * Coefficients of the returned matrix must be set using
+ * cs_matrix_set_conv_diff_coefficients().
+ *
+ * returns:
+ *   pointer to matrix-free operator
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_t  *
+cs_matrix_conv_diff(void);
+
 /*----------------------------------------------------------------------------
  * Determine or apply default tuning for a given matrix type
  *
@@ -128,6 +128,16 @@ typedef struct _cs_matrix_coeff_native_t {
   cs_real_t         *_da;           /* Diagonal terms */
   cs_real_t         *_xa;           /* Extra-diagonal terms */
 
+  /* Row -> edges adjacency, only built for matrices using
+     gather-based products (NULL otherwise) */
+
+  cs_lnum_t         *row_index;     /* Row index (0 to n-1) */
+  cs_lnum_t         *row_col_id;    /* Column id for each row entry */
+  cs_lnum_t         *row_xa_id;     /* Extradiagonal value id for each row
+                                       entry (2*edge_id + 0 for the first
+                                       edge row, 2*edge_id + 1 for the
+                                       second) */
+
 } cs_matrix_coeff_native_t;
 
 /* CSR (Compressed Sparse Row) matrix structure representation */
@@ -233,8 +243,68 @@ typedef struct _cs_matrix_coeff_msr_t {
   cs_real_t        *_d_val;           /* Diagonal matrix coefficients */
   cs_real_t        *_x_val;           /* Extra-diagonal matrix coefficients */
 
+  /* Optional single-precision copy (NULL if unused) */
+
+  float            *_x_val_f;         /* Extra-diagonal matrix coefficients */
+
 } cs_matrix_coeff_msr_t;
 
+/* SELL-C-sigma matrix coefficients representation */
+/*-------------------------------------------------*/
+
+/* The leading MSR part holds the row-ordered coefficients (so that queries
+   and MSR-based operations remain available); the sliced arrays are a
+   SIMD-friendly copy of the extra-diagonal terms, built when coefficients
+   are set. Rows are sorted by decreasing length inside windows of sigma
+   rows, then grouped in slices of C rows, each slice being padded to its
+   longest row and stored column-major (C and sigma are defined in
+   cs_matrix.c). */
+
+typedef struct _cs_matrix_coeff_sell_t {
+
+  cs_matrix_coeff_msr_t  msr;         /* MSR (row-ordered) coefficients */
+
+  cs_lnum_t         n_slices;         /* Number of slices */
+
+  cs_lnum_t        *slice_index;      /* Start of each slice in padded
+                                         arrays (size: n_slices + 1) */
+  cs_lnum_t        *row_id;           /* Row id for each slice lane
+                                         (size: n_slices*C,
+                                         -1 for padding lanes) */
+  cs_lnum_t        *col_id;           /* Padded column ids */
+  cs_real_t        *x_val;            /* Padded extra-diagonal values */
+
+} cs_matrix_coeff_sell_t;
+
+/* Matrix-free convection-diffusion operator coefficients */
+/*---------------------------------------------------------*/
+
+/* The structure is that of the native matrix; only the diagonal is
+   stored, extra-diagonal terms being evaluated from the interior face
+   mass fluxes and viscosities when computing products. */
+
+typedef struct _cs_matrix_coeff_conv_diff_t {
+
+  bool              symmetric;        /* Symmetry indicator (if true,
+                                         convection is ignored) */
+
+  int               iconvp;           /* Convection indicator */
+  int               idiffp;           /* Diffusion indicator */
+  double            thetap;           /* Theta-scheme coefficient */
+
+  /* Pointers to shared arrays */
+
+  const cs_real_t  *da;               /* Diagonal terms */
+  const cs_real_t  *i_massflux;       /* Interior faces mass flux */
+  const cs_real_t  *i_visc;           /* Interior faces viscosity */
+  const cs_real_t  *xcpp;             /* Cells specific heat, or NULL */
+
+  /* Pointers to private arrays (NULL if shared) */
+
+  cs_real_t        *_da;              /* Diagonal terms */
+
+} cs_matrix_coeff_conv_diff_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
@@ -346,6 +416,29 @@ struct _cs_matrix_variant_t {
  * Semi-private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Build row -> edges adjacency of native matrix coefficients, for
+ * gather-based matrix.vector products.
+ *
+ * parameters:
+ *   ms  <-- pointer to native matrix structure
+ *   mc  <-> pointer to native matrix coefficients
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_build_coeff_native_rows(const cs_matrix_struct_native_t  *ms,
+                                  cs_matrix_coeff_native_t         *mc);
+
+/*----------------------------------------------------------------------------
+ * Free row -> edges adjacency of native matrix coefficients.
+ *
+ * parameters:
+ *   mc  <-> pointer to native matrix coefficients
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_free_coeff_native_rows(cs_matrix_coeff_native_t  *mc);
+
 /*----------------------------------------------------------------------------
  * Create CSR matrix coefficients.
  *
@@ -169,6 +169,24 @@ _matrix_tune_test(const cs_matrix_t     *m,
     y[i] = 0.0;
   }
 
+  /* Native scalar matrices are timed using a private copy of their
+     coefficients description, with the row adjacency needed by the
+     gather-based product, so it is not kept with the tuned matrix */
+
+  cs_matrix_coeff_native_t  mc_t;
+  void  *coeffs_t = m->coeffs;
+
+  if (   m->type == CS_MATRIX_NATIVE
+      && (   m->fill_type == CS_MATRIX_SCALAR
+          || m->fill_type == CS_MATRIX_SCALAR_SYM)) {
+    memcpy(&mc_t, m->coeffs, sizeof(cs_matrix_coeff_native_t));
+    mc_t.row_index = NULL;
+    mc_t.row_col_id = NULL;
+    mc_t.row_xa_id = NULL;
+    cs_matrix_build_coeff_native_rows(m->structure, &mc_t);
+    coeffs_t = &mc_t;
+  }
+
   /* Loop on variant types */
   /*-----------------------*/
 
@@ -188,6 +206,7 @@ _matrix_tune_test(const cs_matrix_t     *m,
         cs_matrix_t m_t;
         memcpy(&m_t, m, sizeof(cs_matrix_t));
 
+        m_t.coeffs = coeffs_t;
         m_t.vector_multiply[m->fill_type][ed_flag] = vector_multiply;
 
         wt0 = cs_timer_wtime(), wt1 = wt0;
@@ -230,6 +249,9 @@ _matrix_tune_test(const cs_matrix_t     *m,
 
   } /* end of loop on variants */
 
+  if (coeffs_t == &mc_t)
+    cs_matrix_free_coeff_native_rows(&mc_t);
+
   BFT_FREE(x);
   BFT_FREE(y);
 }
@@ -249,6 +249,51 @@ _b_diag_dom_diag_normalize(const cs_real_t  *restrict da,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute extra-diagonal terms of a matrix-free convection-diffusion
+ * operator for a given edge, using the same upwind expressions as the
+ * matching matrix.vector product.
+ *
+ * parameters:
+ *   mc      <-- Pointer to matrix coefficients
+ *   ii      <-- id of first row adjacent to edge
+ *   jj      <-- id of second row adjacent to edge
+ *   edge_id <-- edge (interior face) id
+ *   x_ij    --> coefficient for row ii, column jj
+ *   x_ji    --> coefficient for row jj, column ii
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_conv_diff_edge_coeffs(const cs_matrix_coeff_conv_diff_t  *mc,
+                       cs_lnum_t                           ii,
+                       cs_lnum_t                           jj,
+                       cs_lnum_t                           edge_id,
+                       double                             *x_ij,
+                       double                             *x_ji)
+{
+  double _x_ij = 0., _x_ji = 0.;
+
+  if (mc->idiffp != 0 && mc->i_visc != NULL) {
+    _x_ij = -mc->thetap*mc->idiffp*mc->i_visc[edge_id];
+    _x_ji = _x_ij;
+  }
+
+  if (! mc->symmetric && mc->iconvp != 0 && mc->i_massflux != NULL) {
+    const cs_real_t m_ij = mc->i_massflux[edge_id];
+    double flui =  0.5*(m_ij - fabs(m_ij));
+    double fluj = -0.5*(m_ij + fabs(m_ij));
+    if (mc->xcpp != NULL) {
+      flui *= mc->xcpp[ii];
+      fluj *= mc->xcpp[jj];
+    }
+    _x_ij += mc->thetap*mc->iconvp*flui;
+    _x_ji += mc->thetap*mc->iconvp*fluj;
+  }
+
+  *x_ij = _x_ij;
+  *x_ji = _x_ji;
+}
+
 /*----------------------------------------------------------------------------
  * Measure Diagonal dominance of native matrix.
  *
@@ -430,6 +475,41 @@ _bb_diag_dom_native(const cs_matrix_t  *matrix,
   _b_diag_dom_diag_normalize(mc->da, dd, ms->n_rows, db_size);
 }
 
+/*----------------------------------------------------------------------------
+ * Measure Diagonal dominance of matrix-free convection-diffusion operator.
+ *
+ * parameters:
+ *   matrix <-- Pointer to matrix structure
+ *   dd     --> Resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_diag_dom_conv_diff(const cs_matrix_t  *matrix,
+                    cs_real_t          *restrict dd)
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_conv_diff_t  *mc = matrix->coeffs;
+
+  /* diagonal contribution */
+
+  _diag_dom_diag_contrib(mc->da, dd, ms->n_rows, ms->n_cols_ext);
+
+  /* non-diagonal terms */
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+  for (cs_lnum_t edge_id = 0; edge_id < ms->n_edges; edge_id++) {
+    cs_lnum_t ii = face_cel_p[edge_id][0];
+    cs_lnum_t jj = face_cel_p[edge_id][1];
+    double x_ij, x_ji;
+    _conv_diff_edge_coeffs(mc, ii, jj, edge_id, &x_ij, &x_ji);
+    dd[ii] -= fabs(x_ij);
+    dd[jj] -= fabs(x_ji);
+  }
+
+  _diag_dom_diag_normalize(mc->da, dd, ms->n_rows);
+}
+
 /*----------------------------------------------------------------------------
  * Measure Diagonal dominance of CSR matrix.
  *
@@ -589,6 +669,22 @@ _diag_dom_msr(const cs_matrix_t  *matrix,
 
   }
 
+  /* Only a single-precision copy may remain on coarse multigrid levels */
+
+  else if (mc->_x_val_f != NULL) {
+
+#   pragma omp parallel for private(jj, n_cols, sii)
+    for (ii = 0; ii < n_rows; ii++) {
+      const float *restrict m_row_f = mc->_x_val_f + ms->row_index[ii];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      sii = 0.0;
+      for (jj = 0; jj < n_cols; jj++)
+        sii -= fabs(m_row_f[jj]);
+      dd[ii] += sii;
+    }
+
+  }
+
   _diag_dom_diag_normalize(mc->d_val, dd, n_rows);
 }
 
@@ -912,6 +1008,70 @@ _b_pre_dump_native(const cs_matrix_t  *matrix,
   return n_entries;
 }
 
+/*----------------------------------------------------------------------------
+ * Prepare dump of matrix-free convection-diffusion operator.
+ *
+ * Extra-diagonal terms are evaluated as in the matrix.vector product.
+ *
+ * parameters:
+ *   matrix    <-- Pointer to matrix structure
+ *   g_coo_num <-- Global coordinate numbers
+ *   m_coo     --> Matrix coefficient coordinates array
+ *   m_val     --> Matrix coefficient values array
+ *
+ * returns:
+ *   number of matrix entries
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_pre_dump_conv_diff(const cs_matrix_t   *matrix,
+                    const cs_gnum_t     *g_coo_num,
+                    cs_gnum_t          **m_coo,
+                    cs_real_t          **m_val)
+{
+  cs_gnum_t   *restrict _m_coo;
+  cs_real_t   *restrict _m_val;
+
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_conv_diff_t  *mc = matrix->coeffs;
+
+  cs_lnum_t  n_entries = ms->n_rows + ms->n_edges*2;
+
+  /* Allocate arrays */
+
+  BFT_MALLOC(_m_coo, n_entries*2, cs_gnum_t);
+  BFT_MALLOC(_m_val, n_entries, double);
+
+  *m_coo = _m_coo;
+  *m_val = _m_val;
+
+  /* diagonal contribution */
+
+  _pre_dump_diag_contrib(mc->da, _m_coo, _m_val, g_coo_num, ms->n_rows);
+
+  /* non-diagonal terms */
+
+  cs_lnum_t dump_id = ms->n_rows;
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+  for (cs_lnum_t edge_id = 0; edge_id < ms->n_edges; edge_id++) {
+    cs_lnum_t ii = face_cel_p[edge_id][0];
+    cs_lnum_t jj = face_cel_p[edge_id][1];
+    double x_ij, x_ji;
+    _conv_diff_edge_coeffs(mc, ii, jj, edge_id, &x_ij, &x_ji);
+    _m_coo[dump_id*2] = g_coo_num[ii];
+    _m_coo[dump_id*2 + 1] = g_coo_num[jj];
+    _m_val[dump_id] = x_ij;
+    _m_coo[dump_id*2 + 2] = g_coo_num[jj];
+    _m_coo[dump_id*2 + 3] = g_coo_num[ii];
+    _m_val[dump_id + 1] = x_ji;
+    dump_id += 2;
+  }
+
+  return n_entries;
+}
+
 /*----------------------------------------------------------------------------
  * Prepare dump of CSR matrix.
  *
@@ -1372,11 +1532,16 @@ _prepare_matrix_dump_data(const cs_matrix_t   *m,
     _n_entries = _pre_dump_csr_sym(m, g_coo_num, &_m_coords, &_m_vals);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     if (m->db_size[3] == 1)
       _n_entries = _pre_dump_msr(m, g_coo_num, &_m_coords, &_m_vals);
     else
       _n_entries = _b_pre_dump_msr(m, g_coo_num, &_m_coords, &_m_vals);
     break;
+  case CS_MATRIX_CONV_DIFF:
+    assert(m->db_size[3] == 1);
+    _n_entries = _pre_dump_conv_diff(m, g_coo_num, &_m_coords, &_m_vals);
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Dump of matrixes in %s format\n"
@@ -1867,6 +2032,7 @@ _frobenius_norm(const cs_matrix_t  *m)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     if (   (m->eb_size[0]*m->eb_size[0] == m->eb_size[3])
         && (m->db_size[0]*m->db_size[0] == m->db_size[3])) {
       cs_lnum_t  d_stride = m->db_size[3];
@@ -1929,11 +2095,15 @@ cs_matrix_diag_dominance(const cs_matrix_t  *matrix,
     _diag_dom_csr_sym(matrix, dd);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     if (matrix->db_size[3] == 1)
       _diag_dom_msr(matrix, dd);
     else
       _b_diag_dom_msr(matrix, dd);
     break;
+  case CS_MATRIX_CONV_DIFF:
+    assert(matrix->db_size[3] == 1);
+    _diag_dom_conv_diff(matrix, dd);
     break;
   default:
     bft_error(__FILE__, __LINE__, 0,
@@ -2076,23 +2246,26 @@ cs_matrix_dump_test(cs_lnum_t              n_rows,
   cs_lnum_t  diag_block_size[4] = {3, 3, 3, 9};
   cs_lnum_t  extra_diag_block_size[4] = {1, 1, 1, 1};
 
-  const int n_tests = 7;
+  const int n_tests = 8;
   const char *name[] = {"matrix_native",
                         "matrix_native_sym",
                         "matrix_native_block",
                         "matrix_csr",
                         "matrix_csr_sym",
                         "matrix_msr",
-                        "matrix_msr_block"};
+                        "matrix_msr_block",
+                        "matrix_sell"};
   const cs_matrix_type_t type[] = {CS_MATRIX_NATIVE,
                                    CS_MATRIX_NATIVE,
                                    CS_MATRIX_NATIVE,
                                    CS_MATRIX_CSR,
                                    CS_MATRIX_CSR_SYM,
                                    CS_MATRIX_MSR,
-                                   CS_MATRIX_MSR};
-  const bool sym_flag[] = {false, true, false, false, true, false, false};
-  const int block_flag[] = {0, 0, 1, 0, 0, 0, 1};
+                                   CS_MATRIX_MSR,
+                                   CS_MATRIX_SELL};
+  const bool sym_flag[] = {false, true, false, false, true, false, false,
+                           false};
+  const int block_flag[] = {0, 0, 1, 0, 0, 0, 1, 0};
 
   /* Allocate and initialize  working arrays */
   /*-----------------------------------------*/
@@ -161,6 +161,8 @@ typedef struct _cs_multigrid_info_t {
 
   unsigned             n_calls[2];          /* Number of times grids built
                                                (0) or solved (1) */
+  unsigned             n_reuse;             /* Number of grid builds reusing
+                                               a previous coarsening */
 
   unsigned long long   n_levels_tot;        /* Total accumulated number of
                                                grid levels built */
@@ -279,6 +281,17 @@ struct _cs_multigrid_t {
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
 
+  int        reuse_interval;     /* Number of setups sharing a coarsening
+                                    (full coarsening at each setup if < 2) */
+  double     reuse_cycle_ratio;  /* Full coarsening is forced when the
+                                    number of cycles exceeds this multiple
+                                    of that of the first solve following
+                                    the last full coarsening */
+
+  bool       mixed_precision;    /* Use single-precision coarse matrix
+                                    coefficients when used as a
+                                    preconditioner */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -329,6 +342,25 @@ struct _cs_multigrid_t {
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
 
+  /* Coarse grids maintained between setups for reuse */
+
+  unsigned                    n_reuse_levels;   /* Number of levels kept */
+  cs_grid_t                 **reuse_hierarchy;  /* Kept coarse grids
+                                                   (level 0 unused) */
+  cs_lnum_t                   reuse_n_cols_ext; /* Associated fine grid
+                                                   number of columns */
+  int                         reuse_count;      /* Setups since last
+                                                   full coarsening */
+  unsigned                    reuse_n_cycles;   /* Cycles of first solve
+                                                   (or setup, when used as
+                                                   a preconditioner) after
+                                                   full coarsening */
+  unsigned                    reuse_pc_n_cycles; /* Cycles of preconditioner
+                                                    applications since last
+                                                    setup */
+  bool                        reuse_rebuild;    /* Force full coarsening
+                                                   at next setup */
+
   cs_time_plot_t             *cycle_plot;       /* plotting of cycles */
   int                         plot_time_stamp;  /* plotting time stamp;
                                                    if < 0, use wall clock */
@@ -411,6 +443,8 @@ _multigrid_info_init(cs_multigrid_info_t *info)
   for (i = 0; i < 2; i++)
     info->n_calls[i] = 0;
 
+  info->n_reuse = 0;
+
   info->n_levels_tot = 0;
 
   for (i = 0; i < 3; i++) {
@@ -488,6 +522,18 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                   (unsigned long long)(mg->merge_glob_threshold));
 #endif
 
+  if (mg->reuse_interval > 1)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarsening reuse parameters:\n"
+                    "    full coarsening interval:        %d\n"
+                    "    cycles ratio threshold:          %g\n"),
+                  mg->reuse_interval, mg->reuse_cycle_ratio);
+
+  if (mg->mixed_precision && mg->info.is_pc)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarse matrix coefficients:        "
+                    "single precision copy\n"));
+
   cs_log_printf(CS_LOG_SETUP,
                 _("  Cycle type:                        %s\n"),
                 _(cs_multigrid_type_name[mg->type]));
@@ -617,6 +663,11 @@ _multigrid_performance_log(const cs_multigrid_t *mg)
                 tmp_s[1], n_cy_mean,
                 (int)(mg->info.n_cycles[0]), (int)(mg->info.n_cycles[1]));
 
+  if (mg->info.n_reuse > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Coarsening reused for %u of %u constructions\n\n"),
+                  mg->info.n_reuse, mg->info.n_calls[0]);
+
   cs_log_timer_array_header(CS_LOG_PERFORMANCE,
                             2,                  /* indent, */
                             "",                 /* header title */
@@ -2025,6 +2076,124 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy coarse grids kept for reuse between setups.
+ *
+ * parameters:
+ *   mg <-> pointer to multigrid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_reuse_free(cs_multigrid_t  *mg)
+{
+  if (mg->reuse_hierarchy != NULL) {
+    for (int i = mg->n_reuse_levels - 1; i > 0; i--)
+      cs_grid_destroy(mg->reuse_hierarchy + i);
+    BFT_FREE(mg->reuse_hierarchy);
+  }
+
+  mg->n_reuse_levels = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether coarse grids kept from a previous setup may be reused
+ * for a new fine grid; they are destroyed otherwise.
+ *
+ * A full coarsening is required when the reuse interval is reached,
+ * when convergence degraded during the last solve, or when the fine
+ * grid's size changed.
+ *
+ * When used as a preconditioner, each application is limited to a fixed
+ * number of cycles, so convergence degradation is instead measured by the
+ * total number of cycles between successive setups, which follows the
+ * outer solver's iteration count.
+ *
+ * parameters:
+ *   mg <-> pointer to multigrid structure
+ *   f  <-- new fine grid
+ *
+ * returns:
+ *   true if the kept coarse grids may be reused
+ *----------------------------------------------------------------------------*/
+
+static bool
+_multigrid_reuse_check(cs_multigrid_t   *mg,
+                       const cs_grid_t  *f)
+{
+  int reuse = 1;
+
+  if (mg->info.is_pc && mg->reuse_pc_n_cycles > 0) {
+    if (mg->reuse_n_cycles == 0)
+      mg->reuse_n_cycles = mg->reuse_pc_n_cycles;
+    else if (mg->reuse_pc_n_cycles > mg->reuse_cycle_ratio*mg->reuse_n_cycles)
+      mg->reuse_rebuild = true;
+    mg->reuse_pc_n_cycles = 0;
+  }
+
+  if (mg->reuse_hierarchy == NULL || mg->n_reuse_levels < 2)
+    reuse = 0;
+  else if (   mg->reuse_rebuild
+           || mg->reuse_count >= mg->reuse_interval)
+    reuse = 0;
+  else if (cs_grid_get_n_cols_ext(f) != mg->reuse_n_cols_ext)
+    reuse = 0;
+
+#if defined(HAVE_MPI)
+  if (mg->caller_n_ranks > 1) {
+    int _reuse = reuse;
+    MPI_Allreduce(&_reuse, &reuse, 1, MPI_INT, MPI_MIN, mg->caller_comm);
+  }
+#endif
+
+  if (reuse == 0)
+    _multigrid_reuse_free(mg);
+
+  return (reuse == 1) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether coarse level solvers only need single-precision
+ * extra-diagonal coefficients.
+ *
+ * Matrix-vector products and the symmetric and truncated Gauss-Seidel
+ * smoothers have single-precision variants; process-local Gauss-Seidel
+ * smoothers, Gauss-Seidel type coarse solvers and recursive multigrids
+ * access the double-precision coefficients.
+ *
+ * parameters:
+ *   mg <-- pointer to multigrid solver info and context
+ *
+ * returns:
+ *   true if the double-precision coarse coefficients are not needed
+ *   by level solvers
+ *----------------------------------------------------------------------------*/
+
+static bool
+_multigrid_x_val_f_only(const cs_multigrid_t  *mg)
+{
+  for (int i = 0; i < 3; i++) {
+    if (mg->lv_mg[i] != NULL)
+      return false;
+  }
+
+  for (int i = 0; i < 2; i++) {
+    if (mg->info.type[i] == CS_SLES_P_GAUSS_SEIDEL)
+      return false;
+  }
+
+  switch (mg->info.type[2]) {
+  case CS_SLES_P_GAUSS_SEIDEL:
+  case CS_SLES_P_SYM_GAUSS_SEIDEL:
+  case CS_SLES_TS_F_GAUSS_SEIDEL:
+  case CS_SLES_TS_B_GAUSS_SEIDEL:
+    return false;
+  default:
+    break;
+  }
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup multigrid sparse linear equation solver.
@@ -2066,6 +2235,21 @@ _setup_hierarchy(void             *context,
 
   _multigrid_add_level(mg, f); /* Assign to hierarchy */
 
+  /* Check if coarse grids from the previous setup may be reused;
+     only the coarse matrix coefficients are then recomputed */
+
+  const bool reuse_active = (   mg->reuse_interval > 1
+                              && mg->subtype != CS_MULTIGRID_BOTTOM);
+
+  bool reuse = false;
+  unsigned n_reuse_levels = 0, n_reused = 0;
+
+  if (reuse_active) {
+    reuse = _multigrid_reuse_check(mg, f);
+    if (reuse)
+      n_reuse_levels = mg->n_reuse_levels;
+  }
+
   /* Add info */
 
   cs_grid_get_info(f,
@@ -2096,12 +2280,35 @@ _setup_hierarchy(void             *context,
     if ((int)(mg->setup_data->n_levels) >= mg->n_levels_max)
       break;
 
+    /* All kept levels reused: previous coarsening stopped here */
+
+    if (reuse && mg->setup_data->n_levels >= n_reuse_levels)
+      break;
+
     /* Build coarser grid from previous grid */
 
     if (verbosity > 2)
       bft_printf(_("\n   building level %2u grid\n"), mg->setup_data->n_levels);
 
-    if (mg->subtype == CS_MULTIGRID_BOTTOM)
+    cs_grid_t *g_r = NULL;
+
+    if (reuse) {
+      g_r = mg->reuse_hierarchy[mg->setup_data->n_levels];
+      mg->reuse_hierarchy[mg->setup_data->n_levels] = NULL;
+      if (cs_grid_coarsen_update(g, g_r, verbosity))
+        n_reused += 1;
+      else {
+        /* Merged levels and below are rebuilt */
+        cs_grid_destroy(&g_r);
+        _multigrid_reuse_free(mg);
+        reuse = false;
+      }
+    }
+
+    if (g_r != NULL)
+      g = g_r;
+
+    else if (mg->subtype == CS_MULTIGRID_BOTTOM)
       g = cs_grid_coarsen_to_single(g, mg->merge_stride, verbosity);
 
     else
@@ -2152,6 +2359,11 @@ _setup_hierarchy(void             *context,
 
       _multigrid_add_level(mg, g); /* Assign to hierarchy */
 
+      /* Reduced precision coarse matrix coefficients for preconditioning */
+
+      if (mg->mixed_precision && mg->info.is_pc)
+        cs_grid_set_matrix_x_val_f(g);
+
       /* Print coarse mesh stats */
 
       if (verbosity > 2) {
@@ -2305,10 +2517,28 @@ _setup_hierarchy(void             *context,
 
   mg->info.n_calls[0] += 1;
 
-  /* Cleanup temporary interpolation arrays */
+  if (reuse_active) {
+    if (n_reused > 0) {
+      mg->info.n_reuse += 1;
+      mg->reuse_count += 1;
+    }
+    else {
+      mg->reuse_count = 1;
+      mg->reuse_n_cycles = 0;
+      mg->reuse_rebuild = false;
+      mg->reuse_n_cols_ext = cs_grid_get_n_cols_ext(f);
+    }
+  }
 
-  for (unsigned i = 0; i < mg->setup_data->n_levels; i++)
-    cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
+  /* Cleanup temporary interpolation arrays; connectivity and geometry
+     are kept when needed to update coarse grids at the next setup */
+
+  for (unsigned i = 0; i < mg->setup_data->n_levels; i++) {
+    if (reuse_active)
+      cs_grid_free_coeff_quantities(mg->setup_data->grid_hierarchy[i]);
+    else
+      cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
+  }
 
   /* Setup solvers */
 
@@ -2317,6 +2547,18 @@ _setup_hierarchy(void             *context,
   else
     _multigrid_setup_sles(mg, name, verbosity);
 
+  /* Without coarsening reuse, double-precision coarse coefficients are
+     not needed anymore once the hierarchy is built if all level solvers
+     use the single-precision copy */
+
+  if (   mg->mixed_precision && mg->info.is_pc
+      && mg->subtype == CS_MULTIGRID_MAIN
+      && !reuse_active
+      && _multigrid_x_val_f_only(mg)) {
+    for (unsigned i = 1; i < mg->setup_data->n_levels; i++)
+      cs_grid_free_matrix_x_val(mg->setup_data->grid_hierarchy[i]);
+  }
+
   /* Update timers */
 
   t2 = cs_timer_time();
@@ -3817,6 +4059,11 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
 
+  mg->reuse_interval = 1;
+  mg->reuse_cycle_ratio = 1.5;
+
+  mg->mixed_precision = false;
+
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
     mg->lv_mg[i] = NULL;
@@ -3847,6 +4094,14 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->setup_data = NULL;
 
+  mg->n_reuse_levels = 0;
+  mg->reuse_hierarchy = NULL;
+  mg->reuse_n_cols_ext = 0;
+  mg->reuse_count = 0;
+  mg->reuse_n_cycles = 0;
+  mg->reuse_pc_n_cycles = 0;
+  mg->reuse_rebuild = false;
+
   BFT_MALLOC(mg->lv_info, mg->n_levels_max, cs_multigrid_level_info_t);
 
   for (ii = 0; ii < mg->n_levels_max; ii++)
@@ -3904,6 +4159,8 @@ cs_multigrid_destroy(void  **context)
   if (mg == NULL)
     return;
 
+  _multigrid_reuse_free(mg);
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_row_num != NULL) {
@@ -4135,6 +4392,25 @@ cs_multigrid_get_fine_solver_type(const cs_multigrid_t  *mg)
   return info->type[0];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return number of setups which reused a previous coarsening.
+ *
+ * \param[in]  mg  pointer to multigrid info and context
+ *
+ * \return   number of grid hierarchy constructions reusing coarse grids
+ */
+/*----------------------------------------------------------------------------*/
+
+unsigned
+cs_multigrid_get_n_reuse(const cs_multigrid_t  *mg)
+{
+  if (mg == NULL)
+    return 0;
+
+  return mg->info.n_reuse;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup multigrid sparse linear equation solver.
@@ -4411,6 +4687,25 @@ cs_multigrid_solve(void                *context,
     mg_info->n_cycles[1] = n_cycles;
   }
 
+  /* Force full coarsening at next setup if convergence degraded
+     relative to the first solve following the last full coarsening */
+
+  if (mg->reuse_interval > 1) {
+    if (mg_info->is_pc) {
+      /* Preconditioner applications are limited to a fixed number of
+         cycles, so degradation is measured from one setup to the next
+         (see _multigrid_reuse_check) */
+      mg->reuse_pc_n_cycles += n_cycles;
+      if (cvg == CS_SLES_DIVERGED || cvg == CS_SLES_BREAKDOWN)
+        mg->reuse_rebuild = true;
+    }
+    else if (mg->reuse_n_cycles == 0)
+      mg->reuse_n_cycles = n_cycles;
+    else if (   cvg != CS_SLES_CONVERGED
+             || n_cycles > mg->reuse_cycle_ratio * mg->reuse_n_cycles)
+      mg->reuse_rebuild = true;
+  }
+
   /* Update number of resolutions and timing data */
 
   mg_info->n_calls[1] += 1;
@@ -4470,9 +4765,24 @@ cs_multigrid_free(void  *context)
     }
     BFT_FREE(mgd->sles_hierarchy);
 
-    /* Destroy grid hierarchy */
+    /* Destroy grid hierarchy, keeping coarse grids for reuse if
+       required (the finest grid shares the caller's matrix) */
+
+    int n_destroy = mgd->n_levels;
+
+    if (   mg->reuse_interval > 1
+        && mg->subtype != CS_MULTIGRID_BOTTOM
+        && mgd->n_levels > 1) {
+      _multigrid_reuse_free(mg);
+      mg->n_reuse_levels = mgd->n_levels;
+      BFT_MALLOC(mg->reuse_hierarchy, mgd->n_levels, cs_grid_t *);
+      mg->reuse_hierarchy[0] = NULL;
+      for (unsigned i = 1; i < mgd->n_levels; i++)
+        mg->reuse_hierarchy[i] = mgd->grid_hierarchy[i];
+      n_destroy = 1;
+    }
 
-    for (int i = mgd->n_levels - 1; i > -1; i--)
+    for (int i = n_destroy - 1; i > -1; i--)
       cs_grid_destroy(mgd->grid_hierarchy + i);
     BFT_FREE(mgd->grid_hierarchy);
 
@@ -4844,6 +5154,85 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarsening reuse options.
+ *
+ * When a system's matrix is set up repeatedly with the same structure
+ * and slowly varying coefficients (such as the pressure system at each
+ * time step), the coarse grids' aggregation, connectivity and halos may
+ * be kept from one setup to the next, only the coarse matrix coefficients
+ * being recomputed. Levels resulting from rank merging are always rebuilt.
+ *
+ * A full coarsening is done every \p interval setups, or at the next setup
+ * when the number of cycles of a solve exceeds \p cycle_ratio times that
+ * of the first solve following the last full coarsening (or the solve
+ * did not converge). When the multigrid is used as a preconditioner,
+ * the cycles of all applications between two setups are compared instead,
+ * and only divergence or breakdown of an application forces a full
+ * coarsening.
+ *
+ * \param[in, out]  mg           pointer to multigrid info and context
+ * \param[in]       interval     number of setups sharing the same
+ *                               coarsening (full coarsening at each
+ *                               setup if < 2)
+ * \param[in]       cycle_ratio  cycles ratio above which a full coarsening
+ *                               is forced
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reuse_options(cs_multigrid_t  *mg,
+                               int              interval,
+                               double           cycle_ratio)
+{
+  if (mg == NULL)
+    return;
+
+  mg->reuse_interval = interval;
+  mg->reuse_cycle_ratio = cycle_ratio;
+
+  if (interval < 2)
+    _multigrid_reuse_free(mg);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid mixed-precision option.
+ *
+ * When the multigrid is used as a preconditioner, a single-precision copy
+ * of the extra-diagonal coefficients of coarse (scalar) grid matrices is
+ * used for matrix-vector products and Gauss-Seidel type smoothers,
+ * reducing the coefficient memory traffic of each sweep. The finest level,
+ * diagonal terms and level vectors remain in double precision, as does the
+ * outer Krylov solver. This option has no effect when the multigrid is used
+ * as a solver.
+ *
+ * Without coarsening reuse, the double-precision coarse coefficients are
+ * freed once the hierarchy is built, unless a smoother or coarse solver
+ * requires them (process-local Gauss-Seidel smoother, Gauss-Seidel type
+ * coarse solver, or recursive multigrid), reducing coarse matrix memory.
+ * Otherwise, they are kept, as they are needed to update coarse levels
+ * when coarsening is reused and by those solvers, so memory use of each
+ * coarse level increases by about half the size of its extra-diagonal
+ * coefficients; this option then trades memory for bandwidth.
+ *
+ * \param[in, out]  mg               pointer to multigrid info and context
+ * \param[in]       mixed_precision  true to use single-precision coarse
+ *                                   matrix coefficients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_mixed_precision(cs_multigrid_t  *mg,
+                                 bool             mixed_precision)
+{
+  if (mg == NULL)
+    return;
+
+  mg->mixed_precision = mixed_precision;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
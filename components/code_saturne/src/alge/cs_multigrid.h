@@ -243,6 +243,19 @@ cs_multigrid_set_solver_options(cs_multigrid_t     *mg,
 cs_sles_it_type_t
 cs_multigrid_get_fine_solver_type(const cs_multigrid_t  *mg);
 
+/*----------------------------------------------------------------------------
+ * Return number of setups which reused a previous coarsening.
+ *
+ * parameters:
+ *   mg <-- pointer to multigrid info and context
+ *
+ * returns:
+ *   number of grid hierarchy constructions reusing coarse grids
+ *----------------------------------------------------------------------------*/
+
+unsigned
+cs_multigrid_get_n_reuse(const cs_multigrid_t  *mg);
+
 /*----------------------------------------------------------------------------
  * Setup multigrid sparse linear equation solver.
  *
@@ -443,6 +456,51 @@ cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
                                int              rows_mean_threshold,
                                cs_gnum_t        rows_glob_threshold);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarsening reuse options.
+ *
+ * A full coarsening is done every \p interval setups, or at the next setup
+ * when the number of cycles of a solve exceeds \p cycle_ratio times that
+ * of the first solve following the last full coarsening; other setups
+ * only recompute the coarse matrix coefficients. When used as a
+ * preconditioner, the cycles of all applications between two setups
+ * are compared instead.
+ *
+ * \param[in, out]  mg           pointer to multigrid info and context
+ * \param[in]       interval     number of setups sharing the same
+ *                               coarsening (full coarsening at each
+ *                               setup if < 2)
+ * \param[in]       cycle_ratio  cycles ratio above which a full coarsening
+ *                               is forced
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reuse_options(cs_multigrid_t  *mg,
+                               int              interval,
+                               double           cycle_ratio);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid mixed-precision option.
+ *
+ * When used as a preconditioner, coarse scalar grid matrices then use
+ * a single-precision copy of their extra-diagonal coefficients for
+ * matrix-vector products and Gauss-Seidel type smoothers. This reduces
+ * memory traffic per sweep, but increases memory use, as the
+ * double-precision coefficients are kept.
+ *
+ * \param[in, out]  mg               pointer to multigrid info and context
+ * \param[in]       mixed_precision  true to use single-precision coarse
+ *                                   matrix coefficients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_mixed_precision(cs_multigrid_t  *mg,
+                                 bool             mixed_precision);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -1450,6 +1450,115 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Process-local symmetric Gauss-Seidel,
+ * with single-precision extra-diagonal coefficients.
+ *
+ * Only scalar (non-blocked) matrices are handled here.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_p_sym_gauss_seidel_msr_f(cs_sles_it_t              *c,
+                          const cs_matrix_t         *a,
+                          cs_lnum_t                  diag_block_size,
+                          cs_halo_rotation_t         rotation_mode,
+                          cs_sles_it_convergence_t  *convergence,
+                          const cs_real_t           *rhs,
+                          cs_real_t                 *restrict vx,
+                          size_t                     aux_size,
+                          void                      *aux_vectors)
+{
+  CS_UNUSED(diag_block_size);
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  assert(diag_block_size == 1);
+
+  unsigned n_iter = 0;
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, NULL, NULL);
+  const float  *a_x_val = cs_matrix_get_msr_x_val_f(a);
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 0; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    /* Synchronize ghost cells first */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk: forward step */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN && !_thread_debug)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+      const float *restrict m_row = a_x_val + a_row_index[ii];
+      const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+      cs_real_t vx0 = rhs[ii];
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        vx0 -= (m_row[jj]*vx[col_id[jj]]);
+
+      vx[ii] = vx0 * ad_inv[ii];
+
+    }
+
+    /* Synchronize ghost cells again */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk: backward step */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN && !_thread_debug)
+    for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
+
+      const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+      const float *restrict m_row = a_x_val + a_row_index[ii];
+      const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+      cs_real_t vx0 = rhs[ii];
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        vx0 -= (m_row[jj]*vx[col_id[jj]]);
+
+      vx[ii] = vx0 * ad_inv[ii];
+
+    }
+
+  }
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Truncated forward Gauss-Seidel.
  *
@@ -1692,6 +1801,174 @@ _ts_b_gauss_seidel_msr(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Truncated forward or backward Gauss-Seidel,
+ * with single-precision extra-diagonal coefficients.
+ *
+ * Only scalar (non-blocked) matrices are handled here.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   forward         <-- true for forward sweep, false for backward
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_ts_gauss_seidel_msr_f(cs_sles_it_t              *c,
+                       const cs_matrix_t         *a,
+                       bool                       forward,
+                       const cs_real_t           *rhs,
+                       cs_real_t                 *restrict vx)
+{
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, NULL, NULL);
+  const float  *a_x_val = cs_matrix_get_msr_x_val_f(a);
+
+  /* Zeroe ghost cell values first */
+
+  for (cs_lnum_t ii = n_rows; ii < n_cols_ext; ii++)
+    vx[ii] = 0.0;
+
+  /* Compute Vx <- Vx - (A-diag).Rk */
+
+  if (forward) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN && !_thread_debug)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+      const float *restrict m_row = a_x_val + a_row_index[ii];
+      const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+      cs_real_t vx0 = rhs[ii];
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        if (col_id[jj] > ii) break;
+        vx0 -= (m_row[jj]*vx[col_id[jj]]);
+      }
+
+      vx[ii] = vx0 * ad_inv[ii];
+    }
+
+  }
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN && !_thread_debug)
+    for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
+
+      const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+      const float *restrict m_row = a_x_val + a_row_index[ii];
+      const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+      cs_real_t vx0 = rhs[ii];
+
+      for (cs_lnum_t jj = n_cols-1; jj > -1; jj--) {
+        if (col_id[jj] < ii) break;
+        vx0 -= (m_row[jj]*vx[col_id[jj]]);
+      }
+
+      vx[ii] = vx0 * ad_inv[ii];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Truncated forward Gauss-Seidel,
+ * with single-precision extra-diagonal coefficients.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_ts_f_gauss_seidel_msr_f(cs_sles_it_t              *c,
+                         const cs_matrix_t         *a,
+                         cs_lnum_t                  diag_block_size,
+                         cs_halo_rotation_t         rotation_mode,
+                         cs_sles_it_convergence_t  *convergence,
+                         const cs_real_t           *rhs,
+                         cs_real_t                 *restrict vx,
+                         size_t                     aux_size,
+                         void                      *aux_vectors)
+{
+  CS_UNUSED(diag_block_size);
+  CS_UNUSED(rotation_mode);
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  assert(diag_block_size == 1);
+
+  _ts_gauss_seidel_msr_f(c, a, true, rhs, vx);
+
+  convergence->n_iterations = 1;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Truncated backward Gauss-Seidel,
+ * with single-precision extra-diagonal coefficients.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_ts_b_gauss_seidel_msr_f(cs_sles_it_t              *c,
+                         const cs_matrix_t         *a,
+                         cs_lnum_t                  diag_block_size,
+                         cs_halo_rotation_t         rotation_mode,
+                         cs_sles_it_convergence_t  *convergence,
+                         const cs_real_t           *rhs,
+                         cs_real_t                 *restrict vx,
+                         size_t                     aux_size,
+                         void                      *aux_vectors)
+{
+  CS_UNUSED(diag_block_size);
+  CS_UNUSED(rotation_mode);
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  assert(diag_block_size == 1);
+
+  _ts_gauss_seidel_msr_f(c, a, false, rhs, vx);
+
+  convergence->n_iterations = 1;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local symmetric Gauss-Seidel.
  *
@@ -1926,6 +2203,14 @@ cs_multigrid_smoother_setup(void               *context,
   else
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, false);
 
+  /* Use single-precision coefficients if available (scalar case) */
+
+  bool use_x_val_f = false;
+  if (   diag_block_size == 1
+      && cs_matrix_get_type(a) == CS_MATRIX_MSR
+      && cs_matrix_get_msr_x_val_f(a) != NULL)
+    use_x_val_f = true;
+
   switch (c->type) {
 
   case CS_SLES_PCG:
@@ -1975,14 +2260,23 @@ cs_multigrid_smoother_setup(void               *context,
     c->solve = _p_gauss_seidel;
     break;
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
-    c->solve = _p_sym_gauss_seidel_msr;
+    if (use_x_val_f)
+      c->solve = _p_sym_gauss_seidel_msr_f;
+    else
+      c->solve = _p_sym_gauss_seidel_msr;
     break;
 
   case CS_SLES_TS_F_GAUSS_SEIDEL:
-    c->solve = _ts_f_gauss_seidel_msr;
+    if (use_x_val_f)
+      c->solve = _ts_f_gauss_seidel_msr_f;
+    else
+      c->solve = _ts_f_gauss_seidel_msr;
     break;
   case CS_SLES_TS_B_GAUSS_SEIDEL:
-    c->solve = _ts_b_gauss_seidel_msr;
+    if (use_x_val_f)
+      c->solve = _ts_b_gauss_seidel_msr_f;
+    else
+      c->solve = _ts_b_gauss_seidel_msr;
     break;
 
   default:
@@ -320,6 +320,8 @@ struct _cs_sles_t {
                                               or NULL */
 
   int                       verbosity;     /* verbosity level */
+  bool                      matrix_free;   /* use matrix-free operator
+                                              when available */
 
   int                       type_id;       /* id of solver type */
   void                     *context;       /* solver context
@@ -327,6 +329,8 @@ struct _cs_sles_t {
 
   cs_sles_setup_t          *setup_func;    /* solver setup function */
   cs_sles_solve_t          *solve_func;    /* solve function */
+  cs_sles_solve_multi_t    *solve_multi_func; /* multiple right-hand side
+                                                 solve function, or NULL */
   cs_sles_free_t           *free_func;     /* free setup function */
 
   cs_sles_log_t            *log_func;      /* logging function */
@@ -405,6 +409,8 @@ _sles_create(int          f_id,
   else
     sles->verbosity = 0;
 
+  sles->matrix_free = false;
+
   if (_type_name_map == NULL)
     _type_name_map = cs_map_name_to_id_create();
   sles->type_id = cs_map_name_to_id(_type_name_map, "<undefined>");
@@ -414,6 +420,7 @@ _sles_create(int          f_id,
   sles->context = NULL;
   sles->setup_func = NULL;
   sles->solve_func = NULL;
+  sles->solve_multi_func = NULL;
   sles->free_func = NULL;
   sles->log_func = NULL;
   sles->copy_func = NULL;
@@ -1326,6 +1333,7 @@ cs_sles_define(int                 f_id,
   sles->context = context;
   sles->setup_func = setup_func;
   sles->solve_func = solve_func;
+  sles->solve_multi_func = NULL;
   sles->free_func = free_func;
   sles->log_func = log_func;
   sles->copy_func = copy_func;
@@ -1373,6 +1381,49 @@ cs_sles_get_verbosity(cs_sles_t  *sles)
   return sles->verbosity;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether a matrix-free operator may be used for a given
+ *        linear equation solver.
+ *
+ * When set, scalar convection-diffusion systems solved through
+ * \ref cs_sles_solve_native do not assemble their extra-diagonal
+ * coefficients, which are recomputed from face fluxes and viscosities
+ * at each matrix-vector product. This is only honored for solvers
+ * not requiring matrix coefficients (i.e. Krylov solvers without
+ * multigrid or Gauss-Seidel based components), and is ignored otherwise.
+ *
+ * By default, matrix-free operation is not used.
+ *
+ * \param[in, out]  sles         pointer to solver object
+ * \param[in]       matrix_free  true to allow matrix-free operation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_matrix_free(cs_sles_t  *sles,
+                        bool        matrix_free)
+{
+  sles->matrix_free = matrix_free;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether a matrix-free operator may be used for a given
+ *        linear equation solver.
+ *
+ * \param[in]  sles  pointer to solver object
+ *
+ * \return  true if matrix-free operation is allowed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_get_matrix_free(const cs_sles_t  *sles)
+{
+  return sles->matrix_free;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Activate postprocessing output for a given linear equation solver.
@@ -1690,6 +1741,156 @@ cs_sles_solve(cs_sles_t           *sles,
   return state;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sparse linear system resolution for multiple right-hand sides
+ *        sharing the same matrix.
+ *
+ * Vectors of successive systems are stored one after the other, each with
+ * cs_matrix_get_n_columns(a) * diag block size values.
+ *
+ * If the associated solver provides a multiple right-hand side solve
+ * function (see \ref cs_sles_set_solve_multi_func), systems are solved
+ * together, which allows amortizing the matrix memory traffic and
+ * global reductions over all systems. Otherwise, or for systems which
+ * did not converge when solved together, each system is solved using
+ * \ref cs_sles_solve (so the usual error handling applies).
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[in]       r_norm         residue normalization for each system
+ * \param[out]      n_iter         number of "equivalent" iterations
+ *                                 for each system
+ * \param[out]      residue        residue for each system
+ * \param[in]       rhs            right hand sides
+ * \param[in, out]  vx             system solutions
+ * \param[in]       aux_size       size of aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state (worst of all systems)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    cs_halo_rotation_t   rotation_mode,
+                    double               precision,
+                    int                  n_rhs,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residue[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx,
+                    size_t               aux_size,
+                    void                *aux_vectors)
+{
+  cs_sles_convergence_state_t state = CS_SLES_CONVERGED;
+
+  const cs_lnum_t *diag_block_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t stride = cs_matrix_get_n_columns(a) * diag_block_size[1];
+
+  if (sles->context == NULL)
+    _cs_sles_define_default(sles->f_id, sles->name, a);
+
+  /* Solve systems together only if all need solving and no
+     postprocessing of individual residuals is required */
+
+  bool grouped = (   sles->solve_multi_func != NULL
+                  && sles->post_info == NULL
+                  && n_rhs > 1);
+
+  if (grouped) {
+
+    const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
+
+    for (int k = 0; k < n_rhs && grouped; k++)
+      grouped = _needs_solving(sles_name,
+                               a,
+                               sles->verbosity,
+                               precision,
+                               r_norm[k],
+                               residue + k,
+                               vx + k*stride,
+                               rhs + k*stride);
+
+  }
+
+  if (grouped) {
+
+    cs_timer_t t0 = cs_timer_time();
+
+    int t_top_id = cs_timer_stats_switch(_sles_stat_id);
+
+    const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
+
+    state = sles->solve_multi_func(sles->context,
+                                   sles_name,
+                                   a,
+                                   sles->verbosity,
+                                   rotation_mode,
+                                   precision,
+                                   n_rhs,
+                                   r_norm,
+                                   n_iter,
+                                   residue,
+                                   rhs,
+                                   vx,
+                                   aux_size,
+                                   aux_vectors);
+
+    cs_timer_stats_switch(t_top_id);
+
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
+
+    if (state >= CS_SLES_ITERATING) {
+      sles->n_calls += n_rhs;
+      return state;
+    }
+
+    /* Solve systems which did not converge individually
+       (cs_sles_solve counts those calls) */
+
+    state = CS_SLES_CONVERGED;
+
+    for (int k = 0; k < n_rhs; k++) {
+      if (residue[k] < precision*r_norm[k]) {
+        sles->n_calls += 1;
+        continue;
+      }
+      int _n_iter = 0;
+      cs_sles_convergence_state_t _state
+        = cs_sles_solve(sles, a, rotation_mode, precision, r_norm[k],
+                        &_n_iter, residue + k,
+                        rhs + k*stride, vx + k*stride,
+                        aux_size, aux_vectors);
+      n_iter[k] += _n_iter;
+      state = CS_MIN(state, _state);
+    }
+
+  }
+
+  else {
+
+    for (int k = 0; k < n_rhs; k++) {
+      cs_sles_convergence_state_t _state
+        = cs_sles_solve(sles, a, rotation_mode, precision, r_norm[k],
+                        n_iter + k, residue + k,
+                        rhs + k*stride, vx + k*stride,
+                        aux_size, aux_vectors);
+      state = CS_MIN(state, _state);
+    }
+
+  }
+
+  return state;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free sparse linear equation solver setup.
@@ -1758,11 +1959,13 @@ cs_sles_copy(cs_sles_t        *dest,
 
   dest->type_id = src->type_id;
   dest->verbosity = src->verbosity;
+  dest->matrix_free = src->matrix_free;
 
   /* Now define options */
   dest->context = src->copy_func(src->context);
   dest->setup_func = src->setup_func;
   dest->solve_func = src->solve_func;
+  dest->solve_multi_func = src->solve_multi_func;
   dest->free_func = src->free_func;
   dest->log_func = src->log_func;
   dest->copy_func = src->copy_func;
@@ -1799,6 +2002,29 @@ cs_sles_set_error_handler(cs_sles_t                *sles,
     sles->error_func = error_handler_func;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a multiple right-hand side solve function to a given
+ *        sparse linear equation solver.
+ *
+ * This function is optional, and is used by \ref cs_sles_solve_multi
+ * when available. It is reset whenever the solver is redefined with
+ * \ref cs_sles_define.
+ *
+ * \param[in, out]  sles              pointer to solver object
+ * \param[in]       solve_multi_func  pointer to multiple right-hand side
+ *                                    solve function, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_multi_func(cs_sles_t              *sles,
+                             cs_sles_solve_multi_t  *solve_multi_func)
+{
+  if (sles != NULL)
+    sles->solve_multi_func = solve_multi_func;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return pointer to default sparse linear solver definition function.
@@ -142,6 +142,50 @@ typedef cs_sles_convergence_state_t
                    size_t               aux_size,
                    void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Function pointer for resolution of multiple linear systems sharing the
+ * same matrix.
+ *
+ * This type of function is optional; it behaves as cs_sles_solve_t, for
+ * n_rhs systems whose vectors are stored one after the other, each with
+ * cs_matrix_get_n_columns(a) * diag block size values.
+ *
+ * parameters:
+ *   context       <-> pointer to solver context
+ *   name          <-- pointer to name of linear system
+ *   a             <-- matrix
+ *   verbosity     <-- associated verbosity
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   precision     <-- solver precision
+ *   n_rhs         <-- number of right-hand sides
+ *   r_norm        <-- residue normalization for each system
+ *   n_iter        --> number of "equivalent" iterations for each system
+ *   residue       --> residue for each system
+ *   rhs           <-- right hand sides
+ *   vx            <-- system solutions
+ *   aux_size      <-- number of elements in aux_vectors
+ *   aux_vectors   <-- optional working area (internal allocation if NULL)
+ *
+ * returns:
+ *   convergence status (worst of all systems)
+ *----------------------------------------------------------------------------*/
+
+typedef cs_sles_convergence_state_t
+(cs_sles_solve_multi_t) (void                *context,
+                         const char          *name,
+                         const cs_matrix_t   *a,
+                         int                  verbosity,
+                         cs_halo_rotation_t   rotation_mode,
+                         double               precision,
+                         int                  n_rhs,
+                         const double         r_norm[],
+                         int                  n_iter[],
+                         double               residue[],
+                         const cs_real_t     *rhs,
+                         cs_real_t           *vx,
+                         size_t               aux_size,
+                         void                *aux_vectors);
+
 /*----------------------------------------------------------------------------
  * Function pointer for freeing of a linear system's context data.
  *
@@ -482,6 +526,36 @@ cs_sles_set_verbosity(cs_sles_t  *sles,
 int
 cs_sles_get_verbosity(cs_sles_t  *sles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether a matrix-free operator may be used for a given
+ *        linear equation solver.
+ *
+ * By default, matrix-free operation is not used.
+ *
+ * \param[in, out]  sles         pointer to solver object
+ * \param[in]       matrix_free  true to allow matrix-free operation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_matrix_free(cs_sles_t  *sles,
+                        bool        matrix_free);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether a matrix-free operator may be used for a given
+ *        linear equation solver.
+ *
+ * \param[in]  sles  pointer to solver object
+ *
+ * \return  true if matrix-free operation is allowed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_get_matrix_free(const cs_sles_t  *sles);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Activate postprocessing output for a given linear equation solver.
@@ -649,6 +723,49 @@ cs_sles_solve(cs_sles_t           *sles,
               size_t               aux_size,
               void                *aux_vectors);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sparse linear system resolution for multiple right-hand sides
+ *        sharing the same matrix.
+ *
+ * Vectors of successive systems are stored one after the other, each with
+ * cs_matrix_get_n_columns(a) * diag block size values. Systems are solved
+ * together when the solver provides a matching function, or one after the
+ * other using \ref cs_sles_solve otherwise.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[in]       r_norm         residue normalization for each system
+ * \param[out]      n_iter         number of "equivalent" iterations
+ *                                 for each system
+ * \param[out]      residue        residue for each system
+ * \param[in]       rhs            right hand sides
+ * \param[in, out]  vx             system solutions
+ * \param[in]       aux_size       size of aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state (worst of all systems)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    cs_halo_rotation_t   rotation_mode,
+                    double               precision,
+                    int                  n_rhs,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residue[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx,
+                    size_t               aux_size,
+                    void                *aux_vectors);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free sparse linear equation solver setup.
@@ -712,6 +829,21 @@ void
 cs_sles_set_error_handler(cs_sles_t                *sles,
                           cs_sles_error_handler_t  *error_handler_func);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a multiple right-hand side solve function to a given
+ *        sparse linear equation solver.
+ *
+ * \param[in, out]  sles              pointer to solver object
+ * \param[in]       solve_multi_func  pointer to multiple right-hand side
+ *                                    solve function, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_multi_func(cs_sles_t              *sles,
+                             cs_sles_solve_multi_t  *solve_multi_func);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return pointer to default sparse linear solver definition function.
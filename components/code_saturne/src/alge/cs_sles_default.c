@@ -698,6 +698,145 @@ cs_sles_setup_native_conv_diff(int                  f_id,
   cs_multigrid_setup_conv_diff(mg, name, a, a_conv, a_diff, verbosity);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if a matrix-free operator may be used for a given system.
+ *
+ * This requires that matrix-free operation has been allowed for the
+ * associated solver (see \ref cs_sles_set_matrix_free), and that the
+ * solver only accesses the matrix through matrix-vector products and its
+ * diagonal, i.e. a Krylov or Jacobi solver with no preconditioner, or
+ * a Jacobi or polynomial preconditioner.
+ *
+ * \param[in]  f_id  associated field id, or < 0
+ * \param[in]  name  associated name if f_id < 0, or NULL
+ *
+ * \return  true if a matrix-free operator may be used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_native_matrix_free(int          f_id,
+                           const char  *name)
+{
+  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
+
+  if (cs_sles_get_matrix_free(sc) == false)
+    return false;
+
+  if (   cs_sles_get_context(sc) == NULL
+      || strcmp(cs_sles_get_type(sc), "cs_sles_it_t") != 0)
+    return false;
+
+  cs_sles_it_t  *c = cs_sles_get_context(sc);
+
+  switch(cs_sles_it_get_type(c)) {
+  case CS_SLES_P_GAUSS_SEIDEL:
+  case CS_SLES_P_SYM_GAUSS_SEIDEL:
+  case CS_SLES_TS_F_GAUSS_SEIDEL:
+  case CS_SLES_TS_B_GAUSS_SEIDEL:
+    return false;
+  default:
+    break;
+  }
+
+  cs_sles_pc_t  *pc = cs_sles_it_get_pc(c);
+  if (pc != NULL) {
+    const char *pc_type = cs_sles_pc_get_type(pc);
+    if (   strcmp(pc_type, "none") != 0
+        && strcmp(pc_type, "jacobi") != 0
+        && strncmp(pc_type, "polynomial", 10) != 0)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse linear equation solver setup for scalar
+ *        convection-diffusion systems using a matrix-free operator.
+ *
+ * The extra-diagonal terms are not assembled, but evaluated from the
+ * face mass fluxes and viscosities at each matrix-vector product.
+ * Arrays are mapped, so they must remain available until
+ * \ref cs_sles_free_native is called. Subsequent calls to
+ * \ref cs_sles_solve_native for this system use this operator (and
+ * should be passed a NULL xa argument).
+ *
+ * \param[in]  f_id        associated field id, or < 0
+ * \param[in]  name        associated name if f_id < 0, or NULL
+ * \param[in]  symmetric   indicates if matrix coefficients are symmetric
+ * \param[in]  iconvp      1 for advection, 0 otherwise
+ * \param[in]  idiffp      1 for diffusion, 0 otherwise
+ * \param[in]  thetap      weighting coefficient for the theta-scheme
+ * \param[in]  da          diagonal values
+ * \param[in]  i_massflux  mass flux at interior faces
+ * \param[in]  i_visc      face viscosity at interior faces for the matrix
+ * \param[in]  xcpp        array of specific heat (Cp), or NULL
+ *
+ * \return  pointer to associated matrix-free operator
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_sles_setup_native_matrix_free(int                  f_id,
+                                 const char          *name,
+                                 bool                 symmetric,
+                                 int                  iconvp,
+                                 int                  idiffp,
+                                 double               thetap,
+                                 const cs_real_t     *da,
+                                 const cs_real_t     *i_massflux,
+                                 const cs_real_t     *i_visc,
+                                 const cs_real_t     *xcpp)
+{
+  /* Check if this system has already been setup */
+
+  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
+
+  int setup_id = 0;
+  while (setup_id < _n_setups) {
+    if (_sles_setup[setup_id] == sc)
+      break;
+    else
+      setup_id++;
+  }
+
+  if (setup_id >= _n_setups) {
+
+    _n_setups += 1;
+
+    if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
+      bft_error
+        (__FILE__, __LINE__, 0,
+         "Too many linear systems solved without calling cs_sles_free_native\n"
+         "  maximum number of systems: %d\n"
+         "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
+         "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
+
+    _sles_setup[setup_id] = sc;
+    _matrix_setup[setup_id][0] = cs_matrix_conv_diff();
+    _matrix_setup[setup_id][1] = NULL;
+    _matrix_setup[setup_id][2] = NULL;
+
+  }
+
+  cs_matrix_t *a = _matrix_setup[setup_id][0];
+
+  cs_matrix_set_conv_diff_coefficients(a,
+                                       symmetric,
+                                       iconvp,
+                                       idiffp,
+                                       thetap,
+                                       da,
+                                       i_massflux,
+                                       i_visc,
+                                       xcpp);
+
+  return a;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Call sparse linear equation solver using native matrix arrays.
@@ -140,6 +140,53 @@ cs_sles_setup_native_conv_diff(int                  f_id,
                                const cs_real_t     *da_diff,
                                const cs_real_t     *xa_diff);
 
+/*----------------------------------------------------------------------------
+ * Indicate if a matrix-free operator may be used for a given system.
+ *
+ * parameters:
+ *   f_id  associated field id, or < 0
+ *   name  associated name if f_id < 0, or NULL
+ *
+ * returns:
+ *   true if a matrix-free operator may be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_sles_native_matrix_free(int          f_id,
+                           const char  *name);
+
+/*----------------------------------------------------------------------------
+ * Call sparse linear equation solver setup for scalar convection-diffusion
+ * systems using a matrix-free operator.
+ *
+ * parameters:
+ *   f_id        associated field id, or < 0
+ *   name        associated name if f_id < 0, or NULL
+ *   symmetric   indicates if matrix coefficients are symmetric
+ *   iconvp      1 for advection, 0 otherwise
+ *   idiffp      1 for diffusion, 0 otherwise
+ *   thetap      weighting coefficient for the theta-scheme
+ *   da          diagonal values
+ *   i_massflux  mass flux at interior faces
+ *   i_visc      face viscosity at interior faces for the matrix
+ *   xcpp        array of specific heat (Cp), or NULL
+ *
+ * returns:
+ *   pointer to associated matrix-free operator
+ *----------------------------------------------------------------------------*/
+
+cs_matrix_t *
+cs_sles_setup_native_matrix_free(int                  f_id,
+                                 const char          *name,
+                                 bool                 symmetric,
+                                 int                  iconvp,
+                                 int                  idiffp,
+                                 double               thetap,
+                                 const cs_real_t     *da,
+                                 const cs_real_t     *i_massflux,
+                                 const cs_real_t     *i_visc,
+                                 const cs_real_t     *xcpp);
+
 /*----------------------------------------------------------------------------
  * Call sparse linear equation solver using native matrix arrays.
  *
@@ -104,10 +104,36 @@ BEGIN_C_DECLS
 
 #define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
 
+/* Maximum number of values in a single grouped (possibly non-blocking) sum */
+
+#define CS_SLES_IT_SUM_MAX 8
+
+/* Iteration period for residual replacement in pipelined Bi-CGSTAB */
+
+#define CS_SLES_IT_PIPELINED_REPLACE 50
+
+/* Number of basis vectors generated per block in s-step GMRES */
+
+#define CS_SLES_IT_CA_GMRES_S 4
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
 
+/* Grouped global sum, which may be completed later so as to overlap
+   communication with computation (pipelined variants) */
+
+typedef struct {
+
+  int          n;                          /* number of summed values */
+  double       local[CS_SLES_IT_SUM_MAX];  /* local contributions */
+
+#if defined(HAVE_MPI)
+  MPI_Request  request;                    /* associated request */
+#endif
+
+} cs_sles_it_sum_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -131,6 +157,9 @@ const char *cs_sles_it_type_name[]
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
+     N_("Pipelined Conjugate Gradient"),
+     N_("Pipelined BiCGstab"),
+     N_("Communication-avoiding GMRES"),
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
@@ -243,6 +272,72 @@ _convergence_test(cs_sles_it_t              *c,
   return CS_SLES_ITERATING;
 }
 
+/*----------------------------------------------------------------------------
+ * Start summing a group of local values over all ranks.
+ *
+ * When non-blocking collectives are available (MPI 3 or above), the call
+ * returns immediately, and the result is available in s only after
+ * _sum_wait() is called, so that the reduction's latency may be hidden
+ * by computation done in between. Otherwise, the sum is completed here.
+ *
+ * parameters:
+ *   c   <-- pointer to solver context info
+ *   n   <-- number of values (at most CS_SLES_IT_SUM_MAX)
+ *   s   <-> local values on input, global sums on completion
+ *   sum --> grouped sum handle
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_start(const cs_sles_it_t  *c,
+           int                  n,
+           double               s[],
+           cs_sles_it_sum_t    *sum)
+{
+  assert(n <= CS_SLES_IT_SUM_MAX);
+
+  sum->n = n;
+
+#if defined(HAVE_MPI)
+
+  sum->request = MPI_REQUEST_NULL;
+
+  if (c->comm != MPI_COMM_NULL) {
+    for (int i = 0; i < n; i++)
+      sum->local[i] = s[i];
+#if (MPI_VERSION >= 3)
+    MPI_Iallreduce(sum->local, s, n, MPI_DOUBLE, MPI_SUM, c->comm,
+                   &(sum->request));
+#else
+    MPI_Allreduce(sum->local, s, n, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+  }
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(s);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Complete a grouped sum started with _sum_start().
+ *
+ * parameters:
+ *   sum <-> grouped sum handle
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_wait(cs_sles_it_sum_t  *sum)
+{
+#if defined(HAVE_MPI)
+  if (sum->request != MPI_REQUEST_NULL)
+    MPI_Wait(&(sum->request), MPI_STATUS_IGNORE);
+#else
+  CS_UNUSED(sum);
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned conjugate gradient.
  *
@@ -443,6 +538,255 @@ _conjugate_gradient(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Sum an array of local values over all ranks, in place.
+ *
+ * parameters:
+ *   c   <-- pointer to solver context info
+ *   n   <-- number of values
+ *   s   <-> local values on input, global sums on output
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_multi(const cs_sles_it_t  *c,
+           int                  n,
+           double               s[])
+{
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+#if defined(HAVE_MPI_IN_PLACE)
+    MPI_Allreduce(MPI_IN_PLACE, s, n, MPI_DOUBLE, MPI_SUM, c->comm);
+#else
+    double *_s;
+    BFT_MALLOC(_s, n, double);
+    memcpy(_s, s, n*sizeof(double));
+    MPI_Allreduce(_s, s, n, MPI_DOUBLE, MPI_SUM, c->comm);
+    BFT_FREE(_s);
+#endif
+  }
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(n);
+  CS_UNUSED(s);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs for multiple right-hand sides sharing the same
+ * matrix, using preconditioned conjugate gradient.
+ *
+ * Matrix.vector products are done for all systems together, so that
+ * matrix coefficients are loaded once per iteration, and dot products of
+ * all systems are summed with a single global reduction. Iterations
+ * continue until all systems have converged (or failed), converged systems
+ * being left unchanged.
+ *
+ * Vectors of successive systems are stored one after the other, with
+ * n_cols_ext values each (scalar matrices only).
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   n_rhs           <-- number of right hand sides
+ *   convergence     <-- convergence information structure for each system
+ *   cvg             --> convergence state of each system
+ *   rhs             <-- right hand sides
+ *   vx              <-> system solutions
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *----------------------------------------------------------------------------*/
+
+static void
+_conjugate_gradient_multi(cs_sles_it_t                 *c,
+                          const cs_matrix_t            *a,
+                          cs_halo_rotation_t            rotation_mode,
+                          int                           n_rhs,
+                          cs_sles_it_convergence_t      convergence[],
+                          cs_sles_convergence_state_t   cvg[],
+                          const cs_real_t              *rhs,
+                          cs_real_t                    *restrict vx,
+                          size_t                        aux_size,
+                          void                         *aux_vectors)
+{
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict dk, *restrict gk, *restrict zk;
+  double  *s, *rk_gkm1, *initial_residue;
+
+  unsigned n_iter = 0;
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t stride = cs_matrix_get_n_columns(a);
+  const size_t wa_size = (size_t)stride * n_rhs;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  {
+    const size_t n_wa = 4;
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    gk = _aux_vectors + wa_size*2;
+    zk = _aux_vectors + wa_size*3;
+  }
+
+  BFT_MALLOC(s, n_rhs*4, double);
+  rk_gkm1 = s + n_rhs*2;
+  initial_residue = s + n_rhs*3;
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residue and descent direction */
+
+  cs_matrix_vector_multiply_multi(rotation_mode, a, n_rhs, vx, rk);
+
+  for (int k = 0; k < n_rhs; k++) {
+
+    cs_real_t *restrict _rk = rk + k*stride;
+    const cs_real_t *restrict _rhs = rhs + k*stride;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      _rk[ii] -= _rhs[ii];
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            _rk,
+                            gk + k*stride);
+
+    memcpy(dk + k*stride, gk + k*stride, n_rows * sizeof(cs_real_t));
+
+    cs_dot_xx_xy(n_rows, _rk, gk + k*stride, s + 2*k, s + 2*k + 1);
+
+  }
+
+  _sum_multi(c, n_rhs*2, s);
+
+  int n_active = 0;
+
+  for (int k = 0; k < n_rhs; k++) {
+    double residue = sqrt(s[2*k]);
+    rk_gkm1[k] = s[2*k + 1];
+    initial_residue[k] = residue;
+    c->setup_data->initial_residue = residue;
+    cvg[k] = _convergence_test(c, n_iter, residue, convergence + k);
+    if (cvg[k] == CS_SLES_ITERATING)
+      n_active += 1;
+  }
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (n_active > 0) {
+
+    n_iter += 1;
+
+    cs_matrix_vector_multiply_multi(rotation_mode, a, n_rhs, dk, zk);
+
+    /* Descent parameters */
+
+    for (int k = 0; k < n_rhs; k++) {
+      if (cvg[k] == CS_SLES_ITERATING)
+        cs_dot_xy_yz(n_rows, rk + k*stride, dk + k*stride, zk + k*stride,
+                     s + 2*k, s + 2*k + 1);
+      else
+        s[2*k] = 0, s[2*k + 1] = 0;
+    }
+
+    _sum_multi(c, n_rhs*2, s);
+
+    for (int k = 0; k < n_rhs; k++) {
+
+      if (cvg[k] != CS_SLES_ITERATING)
+        continue;
+
+      cs_real_t *restrict _vx = vx + k*stride;
+      cs_real_t *restrict _rk = rk + k*stride;
+      const cs_real_t *restrict _dk = dk + k*stride;
+      const cs_real_t *restrict _zk = zk + k*stride;
+
+      double ro_0 = s[2*k], ro_1 = s[2*k + 1];
+      cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
+      cs_real_t alpha =  - ro_0 * d_ro_1;
+
+#     pragma omp parallel if(n_rows > CS_THR_MIN)
+      {
+#       pragma omp for nowait
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+          _vx[ii] += (alpha * _dk[ii]);
+
+#       pragma omp for nowait
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+          _rk[ii] += (alpha * _zk[ii]);
+      }
+
+      /* Preconditioning */
+
+      c->setup_data->pc_apply(c->setup_data->pc_context,
+                              rotation_mode,
+                              _rk,
+                              gk + k*stride);
+
+      cs_dot_xx_xy(n_rows, _rk, gk + k*stride, s + 2*k, s + 2*k + 1);
+
+    }
+
+    /* Residues and next descent directions */
+
+    _sum_multi(c, n_rhs*2, s);
+
+    n_active = 0;
+
+    for (int k = 0; k < n_rhs; k++) {
+
+      if (cvg[k] != CS_SLES_ITERATING)
+        continue;
+
+      double residue = sqrt(s[2*k]);
+      c->setup_data->initial_residue = initial_residue[k];
+      cvg[k] = _convergence_test(c, n_iter, residue, convergence + k);
+
+      if (cvg[k] != CS_SLES_ITERATING)
+        continue;
+
+      n_active += 1;
+
+      double rk_gk = s[2*k + 1];
+      double beta = rk_gk / rk_gkm1[k];
+      rk_gkm1[k] = rk_gk;
+
+      cs_real_t *restrict _dk = dk + k*stride;
+      const cs_real_t *restrict _gk = gk + k*stride;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        _dk[ii] = _gk[ii] + (beta * _dk[ii]);
+
+    }
+
+  }
+
+  BFT_FREE(s);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using flexible preconditioned conjugate gradient.
  *
@@ -1998,18 +2342,18 @@ _breakdown(cs_sles_it_t                 *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using preconditioned Bi-CGSTAB.
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
  *
- * Parallel-optimized version, groups dot products, at the cost of
- * computation of the preconditionning for n+1 iterations instead of n.
+ * The single grouped reduction of each iteration is overlapped with the
+ * preconditioner application and matrix-vector product, at the cost of
+ * additional vector updates (see Ghysels and Vanroose, 2014).
  *
  * On entry, vx is considered initialized.
  *
  * parameters:
  *   c               <-- pointer to solver context info
- *   name            <-- pointer to system name
  *   a               <-- matrix
- *   diag_block_size <-- block size of diagonal elements
+ *   diag_block_size <-- block size of element ii, ii
  *   rotation_mode   <-- halo update option for rotational periodicity
  *   convergence     <-- convergence information structure
  *   rhs             <-- right hand side
@@ -2022,23 +2366,25 @@ _breakdown(cs_sles_it_t                 *c,
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
-_bi_cgstab(cs_sles_it_t              *c,
-           const cs_matrix_t         *a,
-           cs_lnum_t                  diag_block_size,
-           cs_halo_rotation_t         rotation_mode,
-           cs_sles_it_convergence_t  *convergence,
-           const cs_real_t           *rhs,
-           cs_real_t                 *restrict vx,
-           size_t                     aux_size,
-           void                      *aux_vectors)
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              cs_lnum_t                  diag_block_size,
+                              cs_halo_rotation_t         rotation_mode,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
 {
   cs_sles_convergence_state_t cvg;
   double  _epzero = 1.e-30; /* smaller than epzero */
-  double  ro_0, ro_1, alpha, beta, betam1, gamma, omega, ukres0;
-  double  residue;
-  cs_real_t  *_aux_vectors;
-  cs_real_t  *restrict res0, *restrict rk, *restrict pk, *restrict zk;
-  cs_real_t  *restrict uk, *restrict vk;
+  double  gamma, gamma_m1 = 1., delta, alpha = 1., beta, residue;
+  double  s[3];
+  cs_sles_it_sum_t  sum;
+  cs_real_t *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk, *restrict mk;
+  cs_real_t  *restrict nk, *restrict pk, *restrict sk, *restrict qk;
+  cs_real_t  *restrict zk;
 
   unsigned n_iter = 0;
 
@@ -2051,7 +2397,7 @@ _bi_cgstab(cs_sles_it_t              *c,
 
   {
     const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
-    const size_t n_wa = 6;
+    const size_t n_wa = 9;
     const size_t wa_size = CS_SIMD_SIZE(n_cols);
 
     if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
@@ -2059,34 +2405,37 @@ _bi_cgstab(cs_sles_it_t              *c,
     else
       _aux_vectors = aux_vectors;
 
-    res0 = _aux_vectors;
-    rk = _aux_vectors + wa_size;
-    pk = _aux_vectors + wa_size*2;
-    zk = _aux_vectors + wa_size*3;
-    uk = _aux_vectors + wa_size*4;
-    vk = _aux_vectors + wa_size*5;
-  }
-
-# pragma omp parallel for if(n_rows > CS_THR_MIN)
-  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-    pk[ii] = 0.0;
-    uk[ii] = 0.0;
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    pk = _aux_vectors + wa_size*5;
+    sk = _aux_vectors + wa_size*6;
+    qk = _aux_vectors + wa_size*7;
+    zk = _aux_vectors + wa_size*8;
   }
 
   /* Initialize iterative calculation */
   /*----------------------------------*/
 
-  cs_matrix_vector_multiply(rotation_mode, a, vx, res0);
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);  /* rk = A.x0 */
 
 # pragma omp parallel for if(n_rows > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-    res0[ii] = -res0[ii] + rhs[ii];
-    rk[ii] = res0[ii];
+    rk[ii] = rhs[ii] - rk[ii];
+    pk[ii] = 0.0;
+    sk[ii] = 0.0;
+    qk[ii] = 0.0;
+    zk[ii] = 0.0;
   }
 
-  alpha = 1.0;
-  betam1 = 1.0;
-  gamma = 1.0;
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          uk);
+
+  cs_matrix_vector_multiply(rotation_mode, a, uk, wk);  /* wk = A.uk */
 
   cvg = CS_SLES_ITERATING;
 
@@ -2095,19 +2444,187 @@ _bi_cgstab(cs_sles_it_t              *c,
 
   while (cvg == CS_SLES_ITERATING) {
 
-    /* Compute beta and omega;
-       group dot products for new iteration's beta
-       and previous iteration's residue to reduce total latency */
+    /* Start grouped sum of rk.rk, rk.uk and uk.wk */
 
-    if (n_iter == 0) {
-      beta = _dot_product_xx(c, rk); /* rk == res0 here */
-      residue = sqrt(beta);
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s, s+1, s+2);
+
+    _sum_start(c, 3, s, &sum);
+
+    /* Overlap reduction with mk = C.wk and nk = A.mk */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            wk,
+                            mk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, mk, nk);
+
+    _sum_wait(&sum);
+
+    residue = sqrt(s[0]);
+    gamma = s[1];
+    delta = s[2];
+
+    if (n_iter == 0)
       c->setup_data->initial_residue = residue;
-    }
-    else {
-      _dot_products_xx_xy(c, rk, res0, &residue, &beta);
-      residue = sqrt(residue);
-    }
+
+    /* Convergence test */
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* Descent parameters */
+
+    if (n_iter > 0) {
+      beta = gamma / gamma_m1;
+      delta -= beta * gamma / alpha;
+    }
+    else
+      beta = 0.;
+
+    n_iter += 1;
+
+    if (_breakdown(c, convergence, "delta", delta, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    alpha = gamma / delta;
+    gamma_m1 = gamma;
+
+    /* Update recurrences */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      zk[ii] = nk[ii] + beta*zk[ii];
+      qk[ii] = mk[ii] + beta*qk[ii];
+      sk[ii] = wk[ii] + beta*sk[ii];
+      pk[ii] = uk[ii] + beta*pk[ii];
+      vx[ii] += alpha*pk[ii];
+      rk[ii] -= alpha*sk[ii];
+      uk[ii] -= alpha*qk[ii];
+      wk[ii] -= alpha*zk[ii];
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using preconditioned Bi-CGSTAB.
+ *
+ * Parallel-optimized version, groups dot products, at the cost of
+ * computation of the preconditionning for n+1 iterations instead of n.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   name            <-- pointer to system name
+ *   a               <-- matrix
+ *   diag_block_size <-- block size of diagonal elements
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_bi_cgstab(cs_sles_it_t              *c,
+           const cs_matrix_t         *a,
+           cs_lnum_t                  diag_block_size,
+           cs_halo_rotation_t         rotation_mode,
+           cs_sles_it_convergence_t  *convergence,
+           const cs_real_t           *rhs,
+           cs_real_t                 *restrict vx,
+           size_t                     aux_size,
+           void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  double  _epzero = 1.e-30; /* smaller than epzero */
+  double  ro_0, ro_1, alpha, beta, betam1, gamma, omega, ukres0;
+  double  residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict res0, *restrict rk, *restrict pk, *restrict zk;
+  cs_real_t  *restrict uk, *restrict vk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 6;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    res0 = _aux_vectors;
+    rk = _aux_vectors + wa_size;
+    pk = _aux_vectors + wa_size*2;
+    zk = _aux_vectors + wa_size*3;
+    uk = _aux_vectors + wa_size*4;
+    vk = _aux_vectors + wa_size*5;
+  }
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    pk[ii] = 0.0;
+    uk[ii] = 0.0;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, res0);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    res0[ii] = -res0[ii] + rhs[ii];
+    rk[ii] = res0[ii];
+  }
+
+  alpha = 1.0;
+  betam1 = 1.0;
+  gamma = 1.0;
+
+  cvg = CS_SLES_ITERATING;
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Compute beta and omega;
+       group dot products for new iteration's beta
+       and previous iteration's residue to reduce total latency */
+
+    if (n_iter == 0) {
+      beta = _dot_product_xx(c, rk); /* rk == res0 here */
+      residue = sqrt(beta);
+      c->setup_data->initial_residue = residue;
+    }
+    else {
+      _dot_products_xx_xy(c, rk, res0, &residue, &beta);
+      residue = sqrt(residue);
+    }
 
     /* Convergence test */
     cvg = _convergence_test(c, n_iter, residue, convergence);
@@ -2207,19 +2724,48 @@ _bi_cgstab(cs_sles_it_t              *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of (ad+ax).vx = Rhs using (not yet preconditioned) Bi-CGSTAB2.
+ * Apply the right-preconditioned operator: vy = A.C.vx.
  *
- * This Krylov method is based on an implemantation of J.P. Caltagirone
- * in his file bibpac6.f90 for Aquillon. He refers to it as Bi-CGSTAB2,
- * but a proper reference for the method has yet to be found.
- * (Gutknecht's BiCGstab2?)
+ * parameters:
+ *   c             <-- pointer to solver context info
+ *   a             <-- matrix
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   vx            <-- input vector
+ *   wk            --- work vector for C.vx
+ *   vy            --> result
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_pc_matrix_vector_multiply(cs_sles_it_t        *c,
+                           const cs_matrix_t   *a,
+                           cs_halo_rotation_t   rotation_mode,
+                           cs_real_t           *restrict vx,
+                           cs_real_t           *restrict wk,
+                           cs_real_t           *restrict vy)
+{
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          vx,
+                          wk);
+
+  cs_matrix_vector_multiply(rotation_mode, a, wk, vy);
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned Bi-CGSTAB.
+ *
+ * Each of the 2 grouped reductions of an iteration is overlapped with a
+ * preconditioner application and matrix-vector product (see Cools and
+ * Vanroose, 2017). Preconditioning is applied on the right, so the
+ * correction is built in the preconditioned space and mapped back to
+ * vx with one additional preconditioner application at exit.
  *
  * On entry, vx is considered initialized.
  *
  * parameters:
  *   c               <-- pointer to solver context info
  *   a               <-- matrix
- *   diag_block_size <-- block size of element ii, ii
+ *   diag_block_size <-- block size of diagonal elements
  *   rotation_mode   <-- halo update option for rotational periodicity
  *   convergence     <-- convergence information structure
  *   rhs             <-- right hand side
@@ -2232,25 +2778,25 @@ _bi_cgstab(cs_sles_it_t              *c,
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
-_bicgstab2(cs_sles_it_t              *c,
-           const cs_matrix_t         *a,
-           cs_lnum_t                  diag_block_size,
-           cs_halo_rotation_t         rotation_mode,
-           cs_sles_it_convergence_t  *convergence,
-           const cs_real_t           *rhs,
-           cs_real_t                 *restrict vx,
-           size_t                     aux_size,
-           void                      *aux_vectors)
+_bi_cgstab_pipelined(cs_sles_it_t              *c,
+                     const cs_matrix_t         *a,
+                     cs_lnum_t                  diag_block_size,
+                     cs_halo_rotation_t         rotation_mode,
+                     cs_sles_it_convergence_t  *convergence,
+                     const cs_real_t           *rhs,
+                     cs_real_t                 *restrict vx,
+                     size_t                     aux_size,
+                     void                      *aux_vectors)
 {
   cs_sles_convergence_state_t cvg;
-  double  _epzero = 1.e-30;/* smaller than epzero */
-  double  ro_0, ro_1, alpha, beta, gamma;
-  double  omega_1, omega_2, mu, nu, tau;
-  double  residue;
+  double  _epzero = 1.e-30; /* smaller than epzero */
+  double  alpha, beta = 0., omega = 1., rr0, rr0_m1, den, residue;
+  double  s[5], r0r0;
+  cs_sles_it_sum_t  sum;
   cs_real_t  *_aux_vectors;
-  cs_real_t  *restrict res0, *restrict qk, *restrict rk, *restrict sk;
-  cs_real_t  *restrict tk, *restrict uk, *restrict vk, *restrict wk;
-  cs_real_t  *restrict zk;
+  cs_real_t  *restrict res0, *restrict rk, *restrict wk, *restrict tk;
+  cs_real_t  *restrict pk, *restrict sk, *restrict zk, *restrict qk;
+  cs_real_t  *restrict yk, *restrict vk, *restrict xk, *restrict mk;
 
   unsigned n_iter = 0;
 
@@ -2263,7 +2809,7 @@ _bicgstab2(cs_sles_it_t              *c,
 
   {
     const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
-    size_t  n_wa = 9;
+    const size_t n_wa = 12;
     const size_t wa_size = CS_SIMD_SIZE(n_cols);
 
     if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
@@ -2272,21 +2818,17 @@ _bicgstab2(cs_sles_it_t              *c,
       _aux_vectors = aux_vectors;
 
     res0 = _aux_vectors;
-    zk = _aux_vectors + wa_size;
-    qk = _aux_vectors + wa_size*2;
-    rk = _aux_vectors + wa_size*3;
-    sk = _aux_vectors + wa_size*4;
-    tk = _aux_vectors + wa_size*5;
-    uk = _aux_vectors + wa_size*6;
-    vk = _aux_vectors + wa_size*7;
-    wk = _aux_vectors + wa_size*8;
-  }
-
-  /* Initialize work arrays */
-
-# pragma omp parallel for if(n_rows > CS_THR_MIN)
-  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-    uk[ii] = 0.0;
+    rk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    tk = _aux_vectors + wa_size*3;
+    pk = _aux_vectors + wa_size*4;
+    sk = _aux_vectors + wa_size*5;
+    zk = _aux_vectors + wa_size*6;
+    qk = _aux_vectors + wa_size*7;
+    yk = _aux_vectors + wa_size*8;
+    vk = _aux_vectors + wa_size*9;
+    xk = _aux_vectors + wa_size*10;
+    mk = _aux_vectors + wa_size*11;
   }
 
   /* Initialize iterative calculation */
@@ -2298,90 +2840,355 @@ _bicgstab2(cs_sles_it_t              *c,
   for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
     res0[ii] = -res0[ii] + rhs[ii];
     rk[ii] = res0[ii];
-    qk[ii] = rk[ii];
+    pk[ii] = 0.0;
+    sk[ii] = 0.0;
+    zk[ii] = 0.0;
+    vk[ii] = 0.0;
+    xk[ii] = 0.0;
   }
 
-  ro_0    = 1.0;
-  alpha   = 0.0;
-  omega_2 = 1.0;
+  /* wk = A.C.rk; start grouped sum of rk.rk, res0.rk and res0.wk,
+     overlapped with tk = A.C.wk */
 
-  cvg = CS_SLES_ITERATING;
+  _pc_matrix_vector_multiply(c, a, rotation_mode, rk, mk, wk);
 
-  /* Current Iteration */
-  /*-------------------*/
+  cs_dot_xx_yy_xy_xz_yz(n_rows, rk, res0, wk, s, &r0r0, s+1, s+3, s+2);
 
-  while (cvg == CS_SLES_ITERATING) {
+  _sum_start(c, 3, s, &sum);
 
-    /* Compute beta and omega;
-       group dot products for new iteration's beta
-       and previous iteration's residue to reduce total latency */
+  _pc_matrix_vector_multiply(c, a, rotation_mode, wk, mk, tk);
 
-    double mprec = 1.0e-60;
+  _sum_wait(&sum);
 
-    if (n_iter == 0) {
-      residue = sqrt(_dot_product_xx(c, rk)); /* rk == res0 here */
-      c->setup_data->initial_residue = residue;
-    }
-    else
-      residue = sqrt(_dot_product_xx(c, rk));
+  residue = sqrt(s[0]);
+  rr0 = s[1];
+  den = s[2];
 
-    /* Convergence test */
-    cvg = _convergence_test(c, n_iter, residue, convergence);
-    if (cvg != CS_SLES_ITERATING)
-        break;
+  c->setup_data->initial_residue = residue;
 
-    n_iter += 1;
+  alpha = (CS_ABS(den) > DBL_MIN) ? rr0 / den : 0.;
 
-    ro_0 = -omega_2*ro_0;
-    ro_1 = _dot_product(c, qk, rk);
+  cvg = _convergence_test(c, n_iter, residue, convergence);
 
-    if (_breakdown(c, convergence, "rho0", ro_0, 1.e-60,
-                   residue, n_iter, &cvg))
-      break;
+  /* Current Iteration */
+  /*-------------------*/
 
-    if (_breakdown(c, convergence, "rho1", ro_1, _epzero,
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+
+    if (_breakdown(c, convergence, "alpha", alpha, _epzero,
                    residue, n_iter, &cvg))
       break;
 
-    beta = alpha*ro_1/ro_0;
-    ro_0 = ro_1;
+    /* Update search directions and auxiliary vectors */
 
 #   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-      uk[ii] = rk[ii] - beta* uk[ii];
-
-    /* Compute vk =  A*uk */
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      pk[ii] = rk[ii] + beta*(pk[ii] - omega*sk[ii]);
+      sk[ii] = wk[ii] + beta*(sk[ii] - omega*zk[ii]);
+      zk[ii] = tk[ii] + beta*(zk[ii] - omega*vk[ii]);
+      qk[ii] = rk[ii] - alpha*sk[ii];
+      yk[ii] = wk[ii] - alpha*zk[ii];
+    }
 
-    cs_matrix_vector_multiply(rotation_mode, a, uk, vk);
+    /* Start grouped sum of yk.yk and yk.qk, overlapped with vk = A.C.zk */
 
-    /* Preconditionning */
+    cs_dot_xx_xy(n_rows, yk, qk, s, s+1);
 
-    c->setup_data->pc_apply(c->setup_data->pc_context,
-                            rotation_mode,
-                            vk,
-                            zk);
+    _sum_start(c, 2, s, &sum);
 
-    /* Compute gamma and alpha */
+    _pc_matrix_vector_multiply(c, a, rotation_mode, zk, mk, vk);
 
-    gamma = _dot_product(c, qk, vk);
+    _sum_wait(&sum);
 
-    if (_breakdown(c, convergence, "gamma", gamma, 1.e-60,
+    if (_breakdown(c, convergence, "y.y", s[0], _epzero,
                    residue, n_iter, &cvg))
       break;
 
-    alpha = ro_0/gamma;
+    omega = s[1] / s[0];
 
-    /* Update rk */
+    /* Update solution (in preconditioned space) and residue */
 
 #   pragma omp parallel for if(n_rows > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-      rk[ii] -= alpha*vk[ii];
-      vx[ii] += alpha*uk[ii];
+      xk[ii] += alpha*pk[ii] + omega*qk[ii];
+      rk[ii] = qk[ii] - omega*yk[ii];
+      wk[ii] = yk[ii] - omega*(tk[ii] - alpha*vk[ii]);
     }
 
-    /* p = A*r */
+    /* Start grouped sum of rk.rk, res0.rk, res0.wk, res0.sk and res0.zk,
+       overlapped with tk = A.C.wk */
 
-    cs_matrix_vector_multiply(rotation_mode, a, rk, sk);
+    cs_dot_xx_yy_xy_xz_yz(n_rows, rk, res0, wk, s, &r0r0, s+1, s+3, s+2);
+    cs_dot_xy_yz(n_rows, sk, res0, zk, s+3, s+4);
+
+    _sum_start(c, 5, s, &sum);
+
+    _pc_matrix_vector_multiply(c, a, rotation_mode, wk, mk, tk);
+
+    _sum_wait(&sum);
+
+    residue = sqrt(s[0]);
+
+    /* Residual replacement: the recurrences drift from the true values
+       when convergence stagnates, so recompute them periodically and
+       before accepting convergence */
+
+    if (   residue < convergence->precision * convergence->r_norm
+        || n_iter % CS_SLES_IT_PIPELINED_REPLACE == 0) {
+
+      c->setup_data->pc_apply(c->setup_data->pc_context,
+                              rotation_mode,
+                              xk,
+                              mk);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        vx[ii] += mk[ii];
+        xk[ii] = 0.0;
+      }
+
+      cs_matrix_vector_multiply(rotation_mode, a, vx, rk);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        rk[ii] = -rk[ii] + rhs[ii];
+
+      _pc_matrix_vector_multiply(c, a, rotation_mode, rk, mk, wk);
+      _pc_matrix_vector_multiply(c, a, rotation_mode, wk, mk, tk);
+      _pc_matrix_vector_multiply(c, a, rotation_mode, pk, mk, sk);
+      _pc_matrix_vector_multiply(c, a, rotation_mode, sk, mk, zk);
+      _pc_matrix_vector_multiply(c, a, rotation_mode, zk, mk, vk);
+
+      cs_dot_xx_yy_xy_xz_yz(n_rows, rk, res0, wk, s, &r0r0, s+1, s+3, s+2);
+      cs_dot_xy_yz(n_rows, sk, res0, zk, s+3, s+4);
+
+      _sum_start(c, 5, s, &sum);
+      _sum_wait(&sum);
+
+      residue = sqrt(s[0]);
+
+    }
+
+    /* Convergence test */
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    rr0_m1 = rr0;
+    rr0 = s[1];
+
+    if (_breakdown(c, convergence, "rho0", rr0_m1, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    if (_breakdown(c, convergence, "omega", omega, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    beta = (alpha / omega) * (rr0 / rr0_m1);
+
+    den = s[2] + beta*s[3] - beta*omega*s[4];
+
+    alpha = (CS_ABS(den) > DBL_MIN) ? rr0 / den : 0.;
+
+  }
+
+  /* Map correction back from preconditioned space: vx += C.xk */
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          xk,
+                          mk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    vx[ii] += mk[ii];
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of (ad+ax).vx = Rhs using (not yet preconditioned) Bi-CGSTAB2.
+ *
+ * This Krylov method is based on an implemantation of J.P. Caltagirone
+ * in his file bibpac6.f90 for Aquillon. He refers to it as Bi-CGSTAB2,
+ * but a proper reference for the method has yet to be found.
+ * (Gutknecht's BiCGstab2?)
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- block size of element ii, ii
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_bicgstab2(cs_sles_it_t              *c,
+           const cs_matrix_t         *a,
+           cs_lnum_t                  diag_block_size,
+           cs_halo_rotation_t         rotation_mode,
+           cs_sles_it_convergence_t  *convergence,
+           const cs_real_t           *rhs,
+           cs_real_t                 *restrict vx,
+           size_t                     aux_size,
+           void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  double  _epzero = 1.e-30;/* smaller than epzero */
+  double  ro_0, ro_1, alpha, beta, gamma;
+  double  omega_1, omega_2, mu, nu, tau;
+  double  residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict res0, *restrict qk, *restrict rk, *restrict sk;
+  cs_real_t  *restrict tk, *restrict uk, *restrict vk, *restrict wk;
+  cs_real_t  *restrict zk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    size_t  n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    res0 = _aux_vectors;
+    zk = _aux_vectors + wa_size;
+    qk = _aux_vectors + wa_size*2;
+    rk = _aux_vectors + wa_size*3;
+    sk = _aux_vectors + wa_size*4;
+    tk = _aux_vectors + wa_size*5;
+    uk = _aux_vectors + wa_size*6;
+    vk = _aux_vectors + wa_size*7;
+    wk = _aux_vectors + wa_size*8;
+  }
+
+  /* Initialize work arrays */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    uk[ii] = 0.0;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, res0);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    res0[ii] = -res0[ii] + rhs[ii];
+    rk[ii] = res0[ii];
+    qk[ii] = rk[ii];
+  }
+
+  ro_0    = 1.0;
+  alpha   = 0.0;
+  omega_2 = 1.0;
+
+  cvg = CS_SLES_ITERATING;
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Compute beta and omega;
+       group dot products for new iteration's beta
+       and previous iteration's residue to reduce total latency */
+
+    double mprec = 1.0e-60;
+
+    if (n_iter == 0) {
+      residue = sqrt(_dot_product_xx(c, rk)); /* rk == res0 here */
+      c->setup_data->initial_residue = residue;
+    }
+    else
+      residue = sqrt(_dot_product_xx(c, rk));
+
+    /* Convergence test */
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+        break;
+
+    n_iter += 1;
+
+    ro_0 = -omega_2*ro_0;
+    ro_1 = _dot_product(c, qk, rk);
+
+    if (_breakdown(c, convergence, "rho0", ro_0, 1.e-60,
+                   residue, n_iter, &cvg))
+      break;
+
+    if (_breakdown(c, convergence, "rho1", ro_1, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    beta = alpha*ro_1/ro_0;
+    ro_0 = ro_1;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      uk[ii] = rk[ii] - beta* uk[ii];
+
+    /* Compute vk =  A*uk */
+
+    cs_matrix_vector_multiply(rotation_mode, a, uk, vk);
+
+    /* Preconditionning */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            vk,
+                            zk);
+
+    /* Compute gamma and alpha */
+
+    gamma = _dot_product(c, qk, vk);
+
+    if (_breakdown(c, convergence, "gamma", gamma, 1.e-60,
+                   residue, n_iter, &cvg))
+      break;
+
+    alpha = ro_0/gamma;
+
+    /* Update rk */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] -= alpha*vk[ii];
+      vx[ii] += alpha*uk[ii];
+    }
+
+    /* p = A*r */
+
+    cs_matrix_vector_multiply(rotation_mode, a, rk, sk);
 
     c->setup_data->pc_apply(c->setup_data->pc_context,
                             rotation_mode,
@@ -2653,172 +3460,677 @@ _gmres(cs_sles_it_t              *c,
   double  epsi = 1.e-15;
   int scaltest = 0;
 
-  {
-    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+    size_t _aux_r_size;
+    size_t  n_wa = 4;
+    size_t  wa_size = n_cols < krylov_size? krylov_size : n_cols;
+
+    wa_size = CS_SIMD_SIZE(wa_size);
+    _aux_r_size =   wa_size*n_wa
+                  + (krylov_size-1)*(n_rows + krylov_size) + 3*krylov_size;
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < _aux_r_size)
+      BFT_MALLOC(_aux_vectors, _aux_r_size, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    dk = _aux_vectors;
+    gk = _aux_vectors + wa_size;
+    bk = _aux_vectors + 2*wa_size;
+    fk = _aux_vectors + 3*wa_size;
+    _krylov_vectors = _aux_vectors + n_wa*wa_size;
+    _h_matrix = _aux_vectors + n_wa*wa_size + (krylov_size - 1)*n_rows;
+    _givens_coeff =   _aux_vectors + n_wa*wa_size
+                    + (krylov_size - 1)*(n_rows + krylov_size);
+    _beta =   _aux_vectors + n_wa*wa_size
+            + (krylov_size - 1)*(n_rows + krylov_size) + 2*krylov_size;
+  }
+
+  for (cs_lnum_t ii = 0; ii < krylov_size*(krylov_size - 1); ii++)
+    _h_matrix[ii] = 0.;
+
+  cvg = CS_SLES_ITERATING;
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* compute  rk <- a*vx (vx = x0) */
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, dk);
+
+    /* compute  rk <- rhs - rk (r0 = b-A*x0) */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      dk[ii] = rhs[ii] - dk[ii];
+
+    if (n_iter == 0) {
+      residue = sqrt(_dot_product_xx(c, dk));
+      c->setup_data->initial_residue = residue;
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+      if (cvg != CS_SLES_ITERATING)
+        break;
+    }
+
+    /* beta = ||r0|| */
+    beta = sqrt(_dot_product(c, dk, dk));
+    dot_prod = beta;
+
+    _beta[0] = beta;
+    for (cs_lnum_t ii = 1; ii < krylov_size; ii++)
+      _beta[ii] = 0.;
+
+    /* Lap */
+
+    l_iter = 0;
+    l_old_iter = 0;
+
+    for (cs_lnum_t ii = 0; ii < krylov_size - 1; ii++) {
+
+      /* krk = k-ieth col of _krylov_vector = vi */
+      krk = _krylov_vectors + ii*n_rows;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+        krk[jj] = dk[jj]/dot_prod;
+
+      c->setup_data->pc_apply(c->setup_data->pc_context,
+                              rotation_mode,
+                              krk,
+                              gk);
+
+      /* compute w = dk <- A*vj */
+
+      cs_matrix_vector_multiply(rotation_mode, a, gk, dk);
+
+      for (cs_lnum_t jj = 0; jj < ii + 1; jj++) {
+
+        /* compute h(k,i) = <w,vi> = <dk,vi> */
+        _h_matrix[ii*krylov_size + jj]
+          = _dot_product(c, dk, (_krylov_vectors + jj*n_rows));
+
+        /* compute w = dk <- w - h(i,k)*vi */
+
+        cs_axpy(n_rows,
+                -_h_matrix[ii*krylov_size+jj],
+                (_krylov_vectors + jj*n_rows),
+                dk);
+
+      }
+
+      /* compute h(i+1,i) = sqrt<w,w> */
+      dot_prod = sqrt(_dot_product(c, dk, dk));
+      _h_matrix[ii*krylov_size + ii + 1] = dot_prod;
+
+      if (dot_prod < epsi) scaltest = 1;
+
+      if (   (l_iter + 1)%check_freq == 0
+          || l_iter == krylov_size - 2
+          || scaltest == 1) {
+
+          /* H matrix to diagonal sup matrix */
+
+        _givens_rot_update(_h_matrix,
+                           krylov_size,
+                           _beta,
+                           _givens_coeff,
+                           l_old_iter,
+                           l_iter + 1);
+
+        l_old_iter = l_iter + 1;
+
+        /* solve diag sup system */
+        _solve_diag_sup_halo(_h_matrix, l_iter + 1, krylov_size, _beta, gk);
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++) {
+          fk[jj] = 0.0;
+          for (cs_lnum_t kk = 0; kk <= l_iter; kk++)
+            fk[jj] += _krylov_vectors[kk*n_rows + jj] * gk[kk];
+        }
+
+        c->setup_data->pc_apply(c->setup_data->pc_context,
+                                rotation_mode,
+                                fk,
+                                gk);
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+          fk[jj] = vx[jj] + gk[jj];
+
+        cs_matrix_vector_multiply(rotation_mode, a, fk, bk);
+
+        /* compute residue = | Ax - b |_1 */
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+          bk[jj] -= rhs[jj];
+
+        residue = sqrt(_dot_product_xx(c, bk));
+
+        cvg = _convergence_test(c, n_iter, residue, convergence);
+
+      }
+
+      n_iter++;
+      l_iter++;
+
+      if (cvg == CS_SLES_CONVERGED || cvg == CS_SLES_MAX_ITERATION ||
+          l_iter == krylov_size - 1   || scaltest == 1) {
+#       pragma omp parallel for if (n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+          vx[jj] = fk[jj];
+        break;
+      }
+    }
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using s-step (communication-avoiding) GMRES,
+ * with right preconditioning, as described in \cite Hoemmen:2010.
+ *
+ * Basis vectors are generated CS_SLES_IT_CA_GMRES_S at a time using a
+ * Chebyshev polynomial basis, then orthogonalized against the previous
+ * ones with a block classical Gram-Schmidt step followed by a Cholesky QR
+ * factorization (both applied twice for stability). The inner products
+ * required by each pass are summed with a single global reduction, so
+ * only 2 reductions are needed every CS_SLES_IT_CA_GMRES_S iterations
+ * (instead of one per inner product), and the Hessenberg matrix is
+ * rebuilt from the basis change and orthogonalization coefficients.
+ *
+ * The Chebyshev interval is estimated from the Hessenberg matrix diagonal;
+ * until enough columns are available, the basis is built one vector
+ * at a time.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_gmres_s_step(cs_sles_it_t              *c,
+              const cs_matrix_t         *a,
+              cs_lnum_t                  diag_block_size,
+              cs_halo_rotation_t         rotation_mode,
+              cs_sles_it_convergence_t  *convergence,
+              const cs_real_t           *rhs,
+              cs_real_t                 *restrict vx,
+              size_t                     aux_size,
+              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t *restrict _krylov_vectors, *restrict _h_matrix, *restrict _h_rot;
+  cs_real_t *restrict _givens_coeff, *restrict _beta, *restrict _y;
+  cs_real_t *restrict dk, *restrict gk, *restrict fk;
+
+  const int s_max = CS_SLES_IT_CA_GMRES_S;
+
+  cs_lnum_t krylov_size_max = 40;
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  /* Krylov basis size (number of Hessenberg matrix columns + 1) */
+
+  int krylov_size = sqrt(n_rows*diag_block_size)*1.5 + 1;
+  if (krylov_size > krylov_size_max)
+    krylov_size = krylov_size_max;
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    int _krylov_size = krylov_size;
+    MPI_Allreduce(&_krylov_size,
+                  &krylov_size,
+                  1,
+                  MPI_INT,
+                  MPI_MIN,
+                  c->comm);
+  }
+#endif
+
+  if (krylov_size < 2)
+    krylov_size = 2;
+
+  const int m_max = krylov_size - 1;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+    size_t _aux_r_size;
+    size_t  n_wa = 3;
+    size_t  wa_size = CS_SIMD_SIZE(n_cols);
+
+    _aux_r_size =   wa_size*n_wa + (size_t)krylov_size*n_rows
+                  + 2*krylov_size*krylov_size + 4*krylov_size;
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < _aux_r_size)
+      BFT_MALLOC(_aux_vectors, _aux_r_size, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    dk = _aux_vectors;
+    gk = _aux_vectors + wa_size;
+    fk = _aux_vectors + 2*wa_size;
+    _krylov_vectors = _aux_vectors + n_wa*wa_size;
+    _h_matrix = _krylov_vectors + (size_t)krylov_size*n_rows;
+    _h_rot = _h_matrix + krylov_size*krylov_size;
+    _givens_coeff = _h_rot + krylov_size*krylov_size;
+    _beta = _givens_coeff + 2*krylov_size;
+    _y = _beta + krylov_size;
+  }
+
+  /* Small dense work arrays for block orthogonalization:
+     inner products (k+1+s)*s, Cholesky factor s*s, extended triangular
+     factor (k+1+s)*(s+1), and reconstructed Hessenberg columns (k+1+s)*s */
+
+  const int b_size = krylov_size + s_max;
+  double *_g, *_c, *_r, *_r_acc, *_r_big, *_h_new;
+  BFT_MALLOC(_g, b_size*s_max, double);
+  BFT_MALLOC(_c, b_size*s_max, double);
+  BFT_MALLOC(_r, s_max*s_max, double);
+  BFT_MALLOC(_r_acc, s_max*s_max, double);
+  BFT_MALLOC(_r_big, b_size*(s_max+1), double);
+  BFT_MALLOC(_h_new, b_size*s_max, double);
+
+  /* Chebyshev interval (center and half width) of the preconditioned
+     operator's spectrum; unknown at first */
+
+  bool have_interval = false;
+  double cheb_c = 0, cheb_d = 1;
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* compute  rk <- rhs - a*vx (r0 = b-A*x0) */
+
+    cs_matrix_vector_multiply(rotation_mode, a, vx, dk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      dk[ii] = rhs[ii] - dk[ii];
+
+    residue = sqrt(_dot_product_xx(c, dk));
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* First basis vector */
+
+    {
+      cs_real_t *restrict q0 = _krylov_vectors;
+      const double d_beta = (residue > 0) ? 1. / residue : 0.;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        q0[ii] = dk[ii] * d_beta;
+    }
+
+    _beta[0] = residue;
+    for (int ii = 1; ii < krylov_size; ii++)
+      _beta[ii] = 0.;
+
+    for (int ii = 0; ii < krylov_size*krylov_size; ii++) {
+      _h_matrix[ii] = 0.;
+      _h_rot[ii] = 0.;
+    }
+
+    int k = 0;                 /* number of Hessenberg columns so far */
+    bool end_cycle = false;
+
+    while (end_cycle == false) {
+
+      /* Block size and basis parameters */
+
+      int s = (have_interval) ? s_max : 1;
+      if (s > m_max - k)
+        s = m_max - k;
+
+      double b_c = 0., b_d = 1.;   /* monomial basis for single steps */
+      if (s > 1) {
+        b_c = cheb_c;
+        b_d = cheb_d;
+      }
+
+      /* Generate basis vectors T_1 ... T_s from T_0 = q_k:
+         A.M.T_0 = d.T_1 + c.T_0,
+         A.M.T_j = d/2.T_(j+1) + c.T_j + d/2.T_(j-1) for j > 0 */
+
+      for (int j = 0; j < s; j++) {
+
+        const cs_real_t *restrict t_j = _krylov_vectors + (size_t)(k+j)*n_rows;
+        const cs_real_t *restrict t_jm1
+          = (j > 0) ? _krylov_vectors + (size_t)(k+j-1)*n_rows : NULL;
+        cs_real_t *restrict t_jp1 = _krylov_vectors + (size_t)(k+j+1)*n_rows;
+
+        c->setup_data->pc_apply(c->setup_data->pc_context,
+                                rotation_mode,
+                                t_j,
+                                gk);
+
+        cs_matrix_vector_multiply(rotation_mode, a, gk, dk);
+
+        if (j == 0) {
+          const double d_inv = 1. / b_d;
+#         pragma omp parallel for if(n_rows > CS_THR_MIN)
+          for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+            t_jp1[ii] = (dk[ii] - b_c*t_j[ii]) * d_inv;
+        }
+        else {
+          const double d_inv = 2. / b_d;
+#         pragma omp parallel for if(n_rows > CS_THR_MIN)
+          for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+            t_jp1[ii] = (dk[ii] - b_c*t_j[ii]) * d_inv - t_jm1[ii];
+        }
+
+      }
+
+      /* Block classical Gram-Schmidt and Cholesky QR, applied twice
+         for stability. Each pass requires the inner products
+         G = [Q_0..Q_k, W_1..W_s]^T.W, summed with a single reduction;
+         coefficients are accumulated so that W = Q.C + W_orth.R */
+
+      const int n_c_rows = k + 1;
+
+      for (int pass = 0; pass < 2 && s > 0; pass++) {
 
-    size_t _aux_r_size;
-    size_t  n_wa = 4;
-    size_t  wa_size = n_cols < krylov_size? krylov_size : n_cols;
+        const int n_g_rows = k + 1 + s;
 
-    wa_size = CS_SIMD_SIZE(wa_size);
-    _aux_r_size =   wa_size*n_wa
-                  + (krylov_size-1)*(n_rows + krylov_size) + 3*krylov_size;
+        for (int j = 0; j < s; j++) {
+          const cs_real_t *w_j = _krylov_vectors + (size_t)(k+1+j)*n_rows;
+          for (int i = 0; i < n_g_rows; i++) {
+            if (i > k && i - (k+1) > j)
+              continue;
+            const cs_real_t *v_i = _krylov_vectors + (size_t)i*n_rows;
+            _g[j*n_g_rows + i] = cs_dot(n_rows, v_i, w_j);
+          }
+          for (int i = k+1+j+1; i < n_g_rows; i++)  /* symmetric part */
+            _g[j*n_g_rows + i] = 0.;
+        }
 
-    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < _aux_r_size)
-      BFT_MALLOC(_aux_vectors, _aux_r_size, cs_real_t);
-    else
-      _aux_vectors = aux_vectors;
+        _sum_multi(c, n_g_rows*s, _g);
 
-    dk = _aux_vectors;
-    gk = _aux_vectors + wa_size;
-    bk = _aux_vectors + 2*wa_size;
-    fk = _aux_vectors + 3*wa_size;
-    _krylov_vectors = _aux_vectors + n_wa*wa_size;
-    _h_matrix = _aux_vectors + n_wa*wa_size + (krylov_size - 1)*n_rows;
-    _givens_coeff =   _aux_vectors + n_wa*wa_size
-                    + (krylov_size - 1)*(n_rows + krylov_size);
-    _beta =   _aux_vectors + n_wa*wa_size
-            + (krylov_size - 1)*(n_rows + krylov_size) + 2*krylov_size;
-  }
+        for (int j = 0; j < s; j++) {
+          for (int i = j+1; i < s; i++)
+            _g[j*n_g_rows + k+1+i] = _g[i*n_g_rows + k+1+j];
+        }
 
-  for (cs_lnum_t ii = 0; ii < krylov_size*(krylov_size - 1); ii++)
-    _h_matrix[ii] = 0.;
+        /* Cholesky factorization of W^T.W - C^T.C = R^T.R;
+           the block is truncated at the first vanishing pivot */
+
+        int s_ok = s;
+
+        for (int j = 0; j < s && j < s_ok; j++) {
+          for (int i = 0; i <= j; i++) {
+            const double *c_i = _g + i*n_g_rows, *c_j = _g + j*n_g_rows;
+            double sum = _g[j*n_g_rows + k+1+i];
+            for (int l = 0; l <= k; l++)
+              sum -= c_i[l]*c_j[l];
+            for (int l = 0; l < i; l++)
+              sum -= _r[i*s_max + l]*_r[j*s_max + l];
+            if (i < j)
+              _r[j*s_max + i] = sum / _r[i*s_max + i];       /* R(i,j) */
+            else {
+              if (sum <= 1.e-20 * _g[j*n_g_rows + k+1+j] || !(sum > 0)) {
+                s_ok = j;
+                break;
+              }
+              _r[j*s_max + j] = sqrt(sum);
+            }
+          }
+        }
 
-  cvg = CS_SLES_ITERATING;
+        s = s_ok;
 
-  while (cvg == CS_SLES_ITERATING) {
+        if (s == 0)
+          break;
 
-    /* compute  rk <- a*vx (vx = x0) */
+        /* Orthonormalize new vectors in place:
+           W <- (W - Q.C).R^-1 */
 
-    cs_matrix_vector_multiply(rotation_mode, a, vx, dk);
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+          for (int j = 0; j < s; j++) {
+            const double *c_j = _g + j*n_g_rows;
+            const double *r_j = _r + j*s_max;
+            cs_real_t w = _krylov_vectors[(size_t)(k+1+j)*n_rows + ii];
+            for (int l = 0; l <= k; l++)
+              w -= c_j[l] * _krylov_vectors[(size_t)l*n_rows + ii];
+            for (int l = 0; l < j; l++)
+              w -= r_j[l] * _krylov_vectors[(size_t)(k+1+l)*n_rows + ii];
+            _krylov_vectors[(size_t)(k+1+j)*n_rows + ii] = w / r_j[j];
+          }
+        }
 
-    /* compute  rk <- rhs - rk (r0 = b-A*x0) */
+        /* Accumulate coefficients: C <- C + C_p.R, R <- R_p.R */
+
+        for (int j = 0; j < s; j++) {
+          double *c_j = _c + j*n_c_rows;
+          double *r_j = _r_acc + j*s_max;
+          if (pass == 0) {
+            for (int i = 0; i <= k; i++)
+              c_j[i] = _g[j*n_g_rows + i];
+            for (int i = 0; i <= j; i++)
+              r_j[i] = _r[j*s_max + i];
+          }
+          else {
+            for (int i = 0; i <= k; i++) {
+              for (int l = 0; l <= j; l++)
+                c_j[i] += _g[l*n_g_rows + i] * r_j[l];
+            }
+            for (int i = 0; i <= j; i++) {
+              double sum = 0.;
+              for (int l = i; l <= j; l++)
+                sum += _r[l*s_max + i] * r_j[l];
+              r_j[i] = sum;
+            }
+          }
+        }
 
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-      dk[ii] = rhs[ii] - dk[ii];
+      }
 
-    if (n_iter == 0) {
-      residue = sqrt(_dot_product_xx(c, dk));
-      c->setup_data->initial_residue = residue;
-      cvg = _convergence_test(c, n_iter, residue, convergence);
-      if (cvg != CS_SLES_ITERATING)
+      if (s == 0) {     /* breakdown (or exact solution reached) */
+        end_cycle = true;
         break;
-    }
+      }
 
-    /* beta = ||r0|| */
-    beta = sqrt(_dot_product(c, dk, dk));
-    dot_prod = beta;
+      /* Rebuild Hessenberg columns k..k+s-1:
+         [T_0..T_s] = Q.R_big, A.M.[T_0..T_(s-1)] = [T_0..T_s].B,
+         so H_new.R_bot = R_big.B - H_old.R_top */
+
+      const int n_h_rows = k + 1 + s;
+
+      for (int j = 0; j <= s; j++) {
+        double *rb_j = _r_big + j*n_h_rows;
+        for (int i = 0; i < n_h_rows; i++)
+          rb_j[i] = 0.;
+        if (j == 0)
+          rb_j[k] = 1.;
+        else {
+          for (int i = 0; i <= k; i++)
+            rb_j[i] = _c[(j-1)*n_c_rows + i];
+          for (int i = 0; i < j; i++)
+            rb_j[k+1+i] = _r_acc[(j-1)*s_max + i];
+        }
+      }
 
-    _beta[0] = beta;
-    for (cs_lnum_t ii = 1; ii < krylov_size; ii++)
-      _beta[ii] = 0.;
+      for (int j = 0; j < s; j++) {
 
-    /* Lap */
+        double *hn_j = _h_new + j*n_h_rows;
 
-    l_iter = 0;
-    l_old_iter = 0;
+        /* R_big.B (B tridiagonal) */
 
-    for (cs_lnum_t ii = 0; ii < krylov_size - 1; ii++) {
+        const double b_jj = b_c;
+        const double b_j1j = (j == 0) ? b_d : 0.5*b_d;
+        const double b_jm1j = (j == 0) ? 0. : 0.5*b_d;
 
-      /* krk = k-ieth col of _krylov_vector = vi */
-      krk = _krylov_vectors + ii*n_rows;
+        for (int i = 0; i < n_h_rows; i++) {
+          hn_j[i] =   _r_big[j*n_h_rows + i]*b_jj
+                    + _r_big[(j+1)*n_h_rows + i]*b_j1j;
+          if (j > 0)
+            hn_j[i] += _r_big[(j-1)*n_h_rows + i]*b_jm1j;
+        }
 
-#     pragma omp parallel for if(n_rows > CS_THR_MIN)
-      for (cs_lnum_t jj = 0; jj < n_rows; jj++)
-        krk[jj] = dk[jj]/dot_prod;
+        /* - H_old.R_top (the first column of R_top is e_k,
+           so only the following ones contribute) */
 
-      c->setup_data->pc_apply(c->setup_data->pc_context,
-                              rotation_mode,
-                              krk,
-                              gk);
+        for (int l = 0; l < k && j > 0; l++) {
+          const double r_lj = _r_big[j*n_h_rows + l];
+          for (int i = 0; i <= l+1; i++)
+            hn_j[i] -= _h_matrix[l*krylov_size + i] * r_lj;
+        }
 
-      /* compute w = dk <- A*vj */
+        /* Solve X.R_bot = M by forward substitution on columns */
 
-      cs_matrix_vector_multiply(rotation_mode, a, gk, dk);
+        for (int l = 0; l < j; l++) {
+          const double r_lj = _r_big[j*n_h_rows + k + l];
+          const double *hn_l = _h_new + l*n_h_rows;
+          for (int i = 0; i < n_h_rows; i++)
+            hn_j[i] -= hn_l[i] * r_lj;
+        }
 
-      for (cs_lnum_t jj = 0; jj < ii + 1; jj++) {
+        const double d_jj = 1. / _r_big[j*n_h_rows + k + j];
+        for (int i = 0; i < n_h_rows; i++)
+          hn_j[i] *= d_jj;
 
-        /* compute h(k,i) = <w,vi> = <dk,vi> */
-        _h_matrix[ii*krylov_size + jj]
-          = _dot_product(c, dk, (_krylov_vectors + jj*n_rows));
+      }
 
-        /* compute w = dk <- w - h(i,k)*vi */
+      for (int j = 0; j < s; j++) {
+        for (int i = 0; i < n_h_rows; i++) {
+          _h_matrix[(k+j)*krylov_size + i] = _h_new[j*n_h_rows + i];
+          _h_rot[(k+j)*krylov_size + i] = _h_new[j*n_h_rows + i];
+        }
+      }
 
-        cs_axpy(n_rows,
-                -_h_matrix[ii*krylov_size+jj],
-                (_krylov_vectors + jj*n_rows),
-                dk);
+      /* H matrix to diagonal sup matrix; the last right-hand side
+         coefficient is the (preconditioned) residual estimate */
 
-      }
+      _givens_rot_update(_h_rot,
+                         krylov_size,
+                         _beta,
+                         _givens_coeff,
+                         k,
+                         k + s);
 
-      /* compute h(i+1,i) = sqrt<w,w> */
-      dot_prod = sqrt(_dot_product(c, dk, dk));
-      _h_matrix[ii*krylov_size + ii + 1] = dot_prod;
+      k += s;
+      n_iter += s;
 
-      if (dot_prod < epsi) scaltest = 1;
+      /* Update Chebyshev interval estimate from the range of the
+         Hessenberg matrix diagonal (Rayleigh quotients of the basis
+         vectors), slightly widened */
 
-      if (   (l_iter + 1)%check_freq == 0
-          || l_iter == krylov_size - 2
-          || scaltest == 1) {
+      if (k >= s_max) {
+        double l_min = HUGE_VAL, l_max = -HUGE_VAL;
+        for (int i = 0; i < k; i++) {
+          l_min = CS_MIN(l_min, _h_matrix[i*krylov_size + i]);
+          l_max = CS_MAX(l_max, _h_matrix[i*krylov_size + i]);
+        }
+        cheb_c = 0.5*(l_max + l_min);
+        cheb_d = 0.55*(l_max - l_min);
+        if (cheb_d < 1.e-3*CS_ABS(cheb_c))
+          cheb_d = 1.e-3*CS_ABS(cheb_c);
+        have_interval = (cheb_d > 0.);
+        if (!have_interval)
+          cheb_c = 0., cheb_d = 1.;
+      }
 
-          /* H matrix to diagonal sup matrix */
+      double residue_est = CS_ABS(_beta[k]);
 
-        _givens_rot_update(_h_matrix,
-                           krylov_size,
-                           _beta,
-                           _givens_coeff,
-                           l_old_iter,
-                           l_iter + 1);
+      if (   k >= m_max
+          || n_iter >= convergence->n_iterations_max
+          || residue_est < convergence->precision * convergence->r_norm)
+        end_cycle = true;
 
-        l_old_iter = l_iter + 1;
+    }
 
-        /* solve diag sup system */
-        _solve_diag_sup_halo(_h_matrix, l_iter + 1, krylov_size, _beta, gk);
+    /* Breakdown on the first block: A.M.q_0 is colinear to q_0,
+       so vx + (beta/h_00).M.q_0 is the solution (happy breakdown) */
 
-#       pragma omp parallel for if(n_rows > CS_THR_MIN)
-        for (cs_lnum_t jj = 0; jj < n_rows; jj++) {
-          fk[jj] = 0.0;
-          for (cs_lnum_t kk = 0; kk <= l_iter; kk++)
-            fk[jj] += _krylov_vectors[kk*n_rows + jj] * gk[kk];
-        }
+    if (k == 0) {
 
-        c->setup_data->pc_apply(c->setup_data->pc_context,
-                                rotation_mode,
-                                fk,
-                                gk);
+      c->setup_data->pc_apply(c->setup_data->pc_context,
+                              rotation_mode,
+                              _krylov_vectors,
+                              gk);
 
-#       pragma omp parallel for if(n_rows > CS_THR_MIN)
-        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
-          fk[jj] = vx[jj] + gk[jj];
+      cs_matrix_vector_multiply(rotation_mode, a, gk, dk);
 
-        cs_matrix_vector_multiply(rotation_mode, a, fk, bk);
+      const double h_00 = _dot_product(c, _krylov_vectors, dk);
 
-        /* compute residue = | Ax - b |_1 */
+      if (! (CS_ABS(h_00) > 0.)) { /* no progress possible */
+        cvg = CS_SLES_BREAKDOWN;
+        break;
+      }
 
-#       pragma omp parallel for if(n_rows > CS_THR_MIN)
-        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
-          bk[jj] -= rhs[jj];
+      const double alpha = _beta[0] / h_00;
 
-        residue = sqrt(_dot_product_xx(c, bk));
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+        vx[jj] += alpha * gk[jj];
 
-        cvg = _convergence_test(c, n_iter, residue, convergence);
+      n_iter += 1;
+      continue;
 
-      }
+    }
 
-      n_iter++;
-      l_iter++;
+    /* Solve least squares problem and update solution:
+       vx <- vx + M.Q.y */
 
-      if (cvg == CS_SLES_CONVERGED || cvg == CS_SLES_MAX_ITERATION ||
-          l_iter == krylov_size - 1   || scaltest == 1) {
-#       pragma omp parallel for if (n_rows > CS_THR_MIN)
-        for (cs_lnum_t jj = 0; jj < n_rows; jj++)
-          vx[jj] = fk[jj];
-        break;
-      }
+    _solve_diag_sup_halo(_h_rot, k, krylov_size, _beta, _y);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t jj = 0; jj < n_rows; jj++) {
+      fk[jj] = 0.0;
+      for (int kk = 0; kk < k; kk++)
+        fk[jj] += _krylov_vectors[(size_t)kk*n_rows + jj] * _y[kk];
     }
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            fk,
+                            gk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+      vx[jj] += gk[jj];
+
   }
 
+  BFT_FREE(_h_new);
+  BFT_FREE(_r_big);
+  BFT_FREE(_r_acc);
+  BFT_FREE(_r);
+  BFT_FREE(_c);
+  BFT_FREE(_g);
+
   if (_aux_vectors != aux_vectors)
     BFT_FREE(_aux_vectors);
 
@@ -3616,6 +4928,8 @@ cs_sles_it_define(int                 f_id,
                                  cs_sles_it_copy,
                                  cs_sles_it_destroy);
 
+  cs_sles_set_solve_multi_func(sc, cs_sles_it_solve_multi);
+
   cs_sles_set_error_handler(sc,
                             cs_sles_it_error_post_and_abort);
 
@@ -3715,6 +5029,7 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   case CS_SLES_BICGSTAB:
   case CS_SLES_BICGSTAB2:
   case CS_SLES_PCR3:
+  case CS_SLES_PIPELINED_BICGSTAB:
     c->fallback_cvg = CS_SLES_BREAKDOWN;
     break;
   default:
@@ -3987,6 +5302,10 @@ cs_sles_it_setup(void               *context,
     }
     break;
 
+  case CS_SLES_PIPELINED_PCG:
+    c->solve = _conjugate_gradient_pipelined;
+    break;
+
   case CS_SLES_FCG:
     c->solve = _flexible_conjugate_gradient;
     break;
@@ -4010,10 +5329,16 @@ cs_sles_it_setup(void               *context,
   case CS_SLES_BICGSTAB2:
     c->solve = _bicgstab2;
     break;
+  case CS_SLES_PIPELINED_BICGSTAB:
+    c->solve = _bi_cgstab_pipelined;
+    break;
 
   case CS_SLES_GMRES:
     c->solve = _gmres;
     break;
+  case CS_SLES_CA_GMRES:
+    c->solve = _gmres_s_step;
+    break;
 
   case CS_SLES_P_GAUSS_SEIDEL:
     c->solve = _p_gauss_seidel;
@@ -4219,6 +5544,191 @@ cs_sles_it_solve(void                *context,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call iterative sparse linear equation solver for multiple
+ *        right-hand sides sharing the same matrix.
+ *
+ * Vectors of successive systems are stored one after the other, each with
+ * cs_matrix_get_n_columns(a) * diag block size values.
+ *
+ * With the preconditioned conjugate gradient and a scalar matrix, all
+ * systems are solved together, so that the matrix is loaded once per
+ * iteration for all systems, and dot products are summed with a single
+ * reduction. Otherwise, systems are solved one after the other.
+ *
+ * When solved together, systems which did not converge are not included
+ * in the solver statistics, as \ref cs_sles_solve_multi solves them
+ * again individually.
+ *
+ * \param[in, out]  context        pointer to iterative solver info and context
+ *                                 (actual type: cs_sles_it_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[in]       r_norm         residue normalization for each system
+ * \param[out]      n_iter         number of "equivalent" iterations
+ *                                 for each system
+ * \param[out]      residue        residue for each system
+ * \param[in]       rhs            right hand sides
+ * \param[in, out]  vx             system solutions
+ * \param[in]       aux_size       number of elements in aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state (worst of all systems)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(void                *context,
+                       const char          *name,
+                       const cs_matrix_t   *a,
+                       int                  verbosity,
+                       cs_halo_rotation_t   rotation_mode,
+                       double               precision,
+                       int                  n_rhs,
+                       const double         r_norm[],
+                       int                  n_iter[],
+                       double               residue[],
+                       const cs_real_t     *rhs,
+                       cs_real_t           *vx,
+                       size_t               aux_size,
+                       void                *aux_vectors)
+{
+  cs_sles_it_t  *c = context;
+
+  cs_sles_convergence_state_t cvg = CS_SLES_CONVERGED;
+
+  const cs_lnum_t *diag_block_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t stride = cs_matrix_get_n_columns(a) * diag_block_size[1];
+
+  /* Check if systems may be solved together */
+
+  bool grouped = (   c->type == CS_SLES_PCG
+                  && diag_block_size[0] == 1
+                  && n_rhs > 1);
+
+#if defined(HAVE_MPI)
+  if (c->comm != c->caller_comm)
+    grouped = false;
+#endif
+
+  if (! grouped) {
+    for (int k = 0; k < n_rhs; k++) {
+      cs_sles_convergence_state_t _cvg
+        = cs_sles_it_solve(context, name, a, verbosity, rotation_mode,
+                           precision, r_norm[k], n_iter + k, residue + k,
+                           rhs + k*stride, vx + k*stride,
+                           aux_size, aux_vectors);
+      cvg = CS_MIN(cvg, _cvg);
+    }
+    return cvg;
+  }
+
+  cs_timer_t t0 = {0, 0, 0, 0}, t1;
+
+  if (c->update_stats == true)
+    t0 = cs_timer_time();
+
+  /* Setup if not already done */
+
+  if (c->setup_data == NULL) {
+
+    if (c->update_stats) { /* Stop solve timer to switch to setup timer */
+      t1 = cs_timer_time();
+      cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+    }
+
+    cs_sles_it_setup(c, name, a, verbosity);
+
+    if (c->update_stats) /* Restart solve timer */
+      t0 = cs_timer_time();
+
+  }
+
+  /* Use strictest normalization for preconditioner */
+
+  if (c->pc != NULL) {
+    double r_norm_min = r_norm[0];
+    for (int k = 1; k < n_rhs; k++)
+      r_norm_min = CS_MIN(r_norm_min, r_norm[k]);
+    cs_sles_pc_set_tolerance(c->pc, precision, r_norm_min);
+  }
+
+  /* Solve sparse linear systems */
+
+  cs_sles_it_convergence_t  *convergence;
+  cs_sles_convergence_state_t  *_cvg;
+
+  BFT_MALLOC(convergence, n_rhs, cs_sles_it_convergence_t);
+  BFT_MALLOC(_cvg, n_rhs, cs_sles_convergence_state_t);
+
+  for (int k = 0; k < n_rhs; k++) {
+    n_iter[k] = 0;
+    cs_sles_it_convergence_init(convergence + k,
+                                name,
+                                verbosity,
+                                c->n_max_iter,
+                                precision,
+                                r_norm[k],
+                                residue + k);
+    _cvg[k] = CS_SLES_CONVERGED;
+  }
+
+  c->setup_data->initial_residue = -1;
+
+  if (verbosity > 1) {
+    for (int k = 0; k < n_rhs; k++)
+      cs_log_printf(CS_LOG_DEFAULT,
+                    _(" RHS %d norm:        %11.4e\n"), k, r_norm[k]);
+    cs_log_printf(CS_LOG_DEFAULT, "\n");
+  }
+
+  _conjugate_gradient_multi(c, a, rotation_mode, n_rhs,
+                            convergence, _cvg,
+                            rhs, vx, aux_size, aux_vectors);
+
+  /* Update return values */
+
+  for (int k = 0; k < n_rhs; k++) {
+    n_iter[k] = convergence[k].n_iterations;
+    residue[k] = convergence[k].residue;
+    cvg = CS_MIN(cvg, _cvg[k]);
+  }
+
+  if (c->update_stats == true) {
+
+    t1 = cs_timer_time();
+
+    for (int k = 0; k < n_rhs; k++) {
+      if (_cvg[k] != CS_SLES_CONVERGED)
+        continue;
+      unsigned _n_iter = n_iter[k];
+      if (c->n_iterations_tot == 0)
+        c->n_iterations_min = _n_iter;
+      else if (c->n_iterations_min > _n_iter)
+        c->n_iterations_min = _n_iter;
+      if (c->n_iterations_max < _n_iter)
+        c->n_iterations_max = _n_iter;
+      c->n_iterations_last = _n_iter;
+      c->n_iterations_tot += _n_iter;
+      c->n_solves += 1;
+    }
+
+    cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+
+  }
+
+  BFT_FREE(_cvg);
+  BFT_FREE(convergence);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free iterative sparse linear equation solver setup context.
@@ -69,6 +69,15 @@ typedef enum {
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
+  CS_SLES_PIPELINED_PCG,       /*!< Pipelined preconditioned conjugate
+                                    gradient, overlapping reductions with
+                                    computation, described in
+                                    \cite Ghysels:2014 */
+  CS_SLES_PIPELINED_BICGSTAB,  /*!< Pipelined preconditioned BiCGstab,
+                                    described in \cite Cools:2017 */
+  CS_SLES_CA_GMRES,            /*!< s-step (communication-avoiding)
+                                    preconditioned GMRES, described in
+                                    \cite Hoemmen:2010 */
 
   CS_SLES_N_IT_TYPES,          /*!< Number of resolution algorithms
                                     excluding smoother only*/
@@ -238,6 +247,52 @@ cs_sles_it_solve(void                *context,
                  size_t               aux_size,
                  void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Call iterative sparse linear equation solver for multiple right-hand
+ * sides sharing the same matrix.
+ *
+ * Vectors of successive systems are stored one after the other, each with
+ * cs_matrix_get_n_columns(a) * diag block size values. With the
+ * preconditioned conjugate gradient and a scalar matrix, systems are solved
+ * together; otherwise, they are solved one after the other.
+ *
+ * parameters:
+ *   context       <-> pointer to iterative sparse linear solver info
+ *                     (actual type: cs_sles_it_t  *)
+ *   name          <-- pointer to system name
+ *   a             <-- matrix
+ *   verbosity     <-- verbosity level
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   precision     <-- solver precision
+ *   n_rhs         <-- number of right-hand sides
+ *   r_norm        <-- residue normalization for each system
+ *   n_iter        --> number of iterations for each system
+ *   residue       --> residue for each system
+ *   rhs           <-- right hand sides
+ *   vx            <-> system solutions
+ *   aux_size      <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors   --- optional working area (internal allocation if NULL)
+ *
+ * returns:
+ *   convergence state (worst of all systems)
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(void                *context,
+                       const char          *name,
+                       const cs_matrix_t   *a,
+                       int                  verbosity,
+                       cs_halo_rotation_t   rotation_mode,
+                       double               precision,
+                       int                  n_rhs,
+                       const double         r_norm[],
+                       int                  n_iter[],
+                       double               residue[],
+                       const cs_real_t     *rhs,
+                       cs_real_t           *vx,
+                       size_t               aux_size,
+                       void                *aux_vectors);
+
 /*----------------------------------------------------------------------------
  * Free iterative sparse linear equation solver setup context.
  *
@@ -87,6 +87,47 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+#if defined(DEBUG) && !defined(NDEBUG)
+
+/*----------------------------------------------------------------------------
+ * Check that values computed by the fused convection/diffusion balance and
+ * matrix assembly match those of the separate computation, relative to
+ * the largest reference value.
+ *
+ * parameters:
+ *   var_name <-- variable name
+ *   a_name   <-- name of compared array
+ *   n_vals   <-- number of local values
+ *   ref      <-- values from separate computation
+ *   val      <-- values from fused computation
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_fused_conv_diff(const char       *var_name,
+                       const char       *a_name,
+                       cs_lnum_t         n_vals,
+                       const cs_real_t   ref[],
+                       const cs_real_t   val[])
+{
+  cs_real_t d_max[2] = {0., 0.};
+
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    d_max[0] = CS_MAX(d_max[0], CS_ABS(val[i] - ref[i]));
+    d_max[1] = CS_MAX(d_max[1], CS_ABS(ref[i]));
+  }
+
+  cs_parall_max(2, CS_REAL_TYPE, d_max);
+
+  if (d_max[0] > 1.e-10*CS_MAX(d_max[1], 1.))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: fused convection/diffusion balance and matrix assembly\n"
+                "differs from separate computation for %s\n"
+                "(max. difference %g, max. reference value %g)."),
+              var_name, a_name, d_max[0], d_max[1]);
+}
+
+#endif /* defined(DEBUG) && !defined(NDEBUG) */
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -271,6 +312,11 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   cs_real_t *dam_conv, *xam_conv, *dam_diff, *xam_diff;
 
   bool conv_diff_mg = false;
+  bool matrix_free = false;
+  bool fused_cd = false;
+  cs_matrix_t *a_mf = NULL;
+
+  cs_var_cal_opt_t var_cal_opt_fused;
 
   /*============================================================================
    * 0.  Initialization
@@ -296,6 +342,34 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       conv_diff_mg = true;
   }
 
+  /* Extra-diagonal terms are not assembled if the solver allows it */
+
+  if (coupling_id < 0 && !conv_diff_mg)
+    matrix_free = cs_sles_native_matrix_free(f_id, var_name);
+
+  /* Matrix coefficients and the implicit balance may be computed in a
+     single pass over faces (using the same options as cs_balance_scalar) */
+
+  if (!conv_diff_mg && !matrix_free) {
+    if (f_id > -1)
+      cs_field_get_key_struct(f,
+                              cs_field_key_id("var_cal_opt"),
+                              &var_cal_opt_fused);
+    else {
+      var_cal_opt_fused = *var_cal_opt;
+      var_cal_opt_fused.iwgrec = 0;
+      var_cal_opt_fused.icoupl = -1;
+    }
+    var_cal_opt_fused.thetav = thetap;
+
+    if (   var_cal_opt_fused.iconv == iconvp
+        && var_cal_opt_fused.idiff == idiffp)
+      fused_cd = cs_convection_diffusion_matrix_fusable(idtvar,
+                                                        imucpp,
+                                                        icvflb,
+                                                        &var_cal_opt_fused);
+  }
+
   /* Allocate temporary arrays */
 
   BFT_MALLOC(dam, n_cells_ext, cs_real_t);
@@ -318,7 +392,10 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   bool symmetric = (isym == 1) ? true : false;
 
-  BFT_MALLOC(xam,isym*n_i_faces,cs_real_t);
+  if (!matrix_free)
+    BFT_MALLOC(xam,isym*n_i_faces,cs_real_t);
+  else
+    xam = NULL;
   if (conv_diff_mg) {
     BFT_MALLOC(xam_conv, 2*n_i_faces, cs_real_t);
     BFT_MALLOC(xam_diff,   n_i_faces, cs_real_t);
@@ -392,7 +469,24 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                                        dam_diff,
                                        xam_diff);
   }
-  else {
+  else if (matrix_free) {
+    cs_matrix_wrapper_scalar_diag(iconvp,
+                                  idiffp,
+                                  ndircp,
+                                  isym,
+                                  thetap,
+                                  imucpp,
+                                  coefbp,
+                                  cofbfp,
+                                  rovsdt,
+                                  i_massflux,
+                                  b_massflux,
+                                  i_viscm,
+                                  b_viscm,
+                                  xcpp,
+                                  dam);
+  }
+  else if (!fused_cd) {
     cs_matrix_wrapper_scalar(iconvp,
                              idiffp,
                              ndircp,
@@ -411,6 +505,9 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                              xam);
   }
 
+  /* Otherwise (fused_cd), the matrix is built with the implicit balance
+     below, as neither is needed before */
+
   /* For steady computations, the diagonal is relaxed */
   if (idtvar < 0) {
 #   pragma omp parallel for
@@ -418,6 +515,20 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       dam[iel] /= relaxp;
   }
 
+  /* Matrix-free operator: extra-diagonal terms are computed from the
+     face fluxes and viscosities at each product */
+  if (matrix_free)
+    a_mf = cs_sles_setup_native_matrix_free(f_id,
+                                            var_name,
+                                            symmetric,
+                                            iconvp,
+                                            idiffp,
+                                            thetap,
+                                            dam,
+                                            i_massflux,
+                                            i_viscm,
+                                            (imucpp != 0) ? xcpp : NULL);
+
   /*==========================================================================
    * 2. Iterative process to handle non orthogonalities (starting from the
    *    second iteration).
@@ -515,30 +626,130 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
      has to impose 1 on mass accumulation. */
   imasac = 1;
 
-  cs_balance_scalar(idtvar,
-                    f_id,
-                    imucpp,
-                    imasac,
-                    inc,
-                    iccocg,
-                    var_cal_opt,
-                    pvar,
-                    pvara,
-                    coefap,
-                    coefbp,
-                    cofafp,
-                    cofbfp,
-                    i_massflux,
-                    b_massflux,
-                    i_visc,
-                    b_visc,
-                    viscel,
-                    xcpp,
-                    weighf,
-                    weighb,
-                    icvflb,
-                    icvfli,
-                    smbrp);
+  if (fused_cd) {
+
+#if defined(DEBUG) && !defined(NDEBUG)
+    /* Regression check: compute the matrix and balance separately first,
+       and compare with the fused computation below */
+    cs_real_t *dam_ref, *xam_ref, *smbr_ref;
+    BFT_MALLOC(dam_ref, n_cells_ext, cs_real_t);
+    BFT_MALLOC(xam_ref, isym*n_i_faces, cs_real_t);
+    BFT_MALLOC(smbr_ref, n_cells_ext, cs_real_t);
+    for (cs_lnum_t iel = 0; iel < n_cells; iel++)
+      smbr_ref[iel] = smbrp[iel];
+
+    /* The slope test upwind indicator field is reset and recomputed by
+       the fused pass; only its upwind face count logging must not be
+       duplicated by the reference computation */
+    cs_var_cal_opt_t var_cal_opt_ref = *var_cal_opt;
+    var_cal_opt_ref.verbosity = 0;
+
+    cs_matrix_wrapper_scalar(iconvp,
+                             idiffp,
+                             ndircp,
+                             isym,
+                             thetap,
+                             imucpp,
+                             coefbp,
+                             cofbfp,
+                             rovsdt,
+                             i_massflux,
+                             b_massflux,
+                             i_viscm,
+                             b_viscm,
+                             xcpp,
+                             dam_ref,
+                             xam_ref);
+
+    cs_balance_scalar(idtvar,
+                      f_id,
+                      imucpp,
+                      imasac,
+                      inc,
+                      iccocg,
+                      &var_cal_opt_ref,
+                      pvar,
+                      pvara,
+                      coefap,
+                      coefbp,
+                      cofafp,
+                      cofbfp,
+                      i_massflux,
+                      b_massflux,
+                      i_visc,
+                      b_visc,
+                      viscel,
+                      xcpp,
+                      weighf,
+                      weighb,
+                      icvflb,
+                      icvfli,
+                      smbr_ref);
+#endif
+
+    var_cal_opt_fused.thetav = thetap;
+    cs_convection_diffusion_matrix_scalar(f_id,
+                                          var_cal_opt_fused,
+                                          isym,
+                                          inc,
+                                          iccocg,
+                                          imasac,
+                                          pvar,
+                                          pvara,
+                                          coefap,
+                                          coefbp,
+                                          cofafp,
+                                          cofbfp,
+                                          i_massflux,
+                                          b_massflux,
+                                          i_visc,
+                                          b_visc,
+                                          i_viscm,
+                                          b_viscm,
+                                          rovsdt,
+                                          smbrp,
+                                          dam,
+                                          xam);
+
+    cs_matrix_wrapper_scalar_penalize(ndircp, dam);
+
+#if defined(DEBUG) && !defined(NDEBUG)
+    _check_fused_conv_diff(var_name, "diagonal", n_cells, dam_ref, dam);
+    _check_fused_conv_diff(var_name, "extra-diagonal",
+                           isym*n_i_faces, xam_ref, xam);
+    _check_fused_conv_diff(var_name, "right hand side",
+                           n_cells, smbr_ref, smbrp);
+
+    BFT_FREE(dam_ref);
+    BFT_FREE(xam_ref);
+    BFT_FREE(smbr_ref);
+#endif
+  }
+  else
+    cs_balance_scalar(idtvar,
+                      f_id,
+                      imucpp,
+                      imasac,
+                      inc,
+                      iccocg,
+                      var_cal_opt,
+                      pvar,
+                      pvara,
+                      coefap,
+                      coefbp,
+                      cofafp,
+                      cofbfp,
+                      i_massflux,
+                      b_massflux,
+                      i_visc,
+                      b_visc,
+                      viscel,
+                      xcpp,
+                      weighf,
+                      weighb,
+                      icvflb,
+                      icvfli,
+                      smbrp);
 
   if (iswdyp >= 1) {
 #   pragma omp parallel for
@@ -581,15 +792,18 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   if (iinvpe == 2)
     rotation_mode = CS_HALO_ROTATION_IGNORE;
 
-  cs_matrix_vector_native_multiply(symmetric,
-                                   db_size,
-                                   eb_size,
-                                   rotation_mode,
-                                   f_id,
-                                   dam,
-                                   xam,
-                                   pvar,
-                                   w1);
+  if (matrix_free)
+    cs_matrix_vector_multiply(rotation_mode, a_mf, pvar, w1);
+  else
+    cs_matrix_vector_native_multiply(symmetric,
+                                     db_size,
+                                     eb_size,
+                                     rotation_mode,
+                                     f_id,
+                                     dam,
+                                     xam,
+                                     pvar,
+                                     w1);
 
 # pragma omp parallel for
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
@@ -644,6 +644,215 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      grad);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute cell gradients of several scalar fields.
+ *
+ * Fields sharing the same gradient options, and requiring neither
+ * gradient weighting nor internal coupling, are handled together
+ * with \ref cs_gradient_scalar_multi, so that face geometric quantities
+ * are loaded and halos are exchanged only once for all those fields.
+ * Other fields are handled with \ref cs_field_gradient_scalar.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       f               pointers to fields
+ * \param[in]       use_previous_t  should we use values from the previous
+ *                                  time step ?
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[out]      grad            gradient for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar_multi(int                        n_fields,
+                               const cs_field_t    *const f[],
+                               bool                       use_previous_t,
+                               int                        inc,
+                               bool                       recompute_cocg,
+                               cs_real_3_t         *const grad[])
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  int n_b_fields = 0;
+  int *b_field_id = NULL;
+  const cs_equation_param_t *eqp_b = NULL;
+  int imrgra_b = -1, verbosity = 0;
+
+  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
+
+  BFT_MALLOC(b_field_id, n_fields, int);
+
+  /* Select fields which may be batched; with periodicity of rotation,
+     Reynolds stress components require specific handling */
+
+  for (int i = 0; i < n_fields; i++) {
+
+    if (f[i]->dim != 1 || m->have_rotation_perio)
+      continue;
+
+    if (f[i]->n_time_vals < 2 && use_previous_t)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field %s does not maintain previous time step values\n"
+                  "so \"use_previous_t\" can not be handled."),
+                __func__, f[i]->name);
+
+    const cs_field_t *parent_f = f[i];
+    const int f_parent_id
+      = cs_field_get_key_int(f[i], cs_field_key_id("parent_field_id"));
+    if (f_parent_id > -1)
+      parent_f = cs_field_by_id(f_parent_id);
+
+    int imrgra = cs_glob_space_disc->imrgra;
+    const cs_equation_param_t
+      *eqp = cs_field_get_equation_param_const(parent_f);
+
+    if (eqp != NULL)
+      imrgra = eqp->imrgra;
+    else
+      eqp = &eqp_default;
+
+    if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
+      if (eqp->iwgrec == 1) {
+        int key_id = cs_field_key_id("gradient_weighting_id");
+        if (cs_field_get_key_int(parent_f, key_id) > -1)
+          continue;
+      }
+      int key_id = cs_field_key_id_try("coupling_entity");
+      if (key_id > -1) {
+        if (cs_field_get_key_int(parent_f, key_id) > -1)
+          continue;
+      }
+    }
+
+    /* Batched fields must share the same gradient options */
+
+    if (n_b_fields == 0) {
+      eqp_b = eqp;
+      imrgra_b = imrgra;
+    }
+    else if (   imrgra != imrgra_b
+             || eqp->nswrgr != eqp_b->nswrgr
+             || eqp->imligr != eqp_b->imligr
+             || eqp->epsrgr != eqp_b->epsrgr
+             || eqp->climgr != eqp_b->climgr)
+      continue;
+
+    verbosity = CS_MAX(verbosity, eqp->verbosity);
+
+    b_field_id[n_b_fields++] = i;
+
+  }
+
+  /* Batched fields */
+
+  if (n_b_fields > 1) {
+
+    const cs_equation_param_t *eqp = eqp_b;
+
+    cs_halo_type_t halo_type = CS_HALO_STANDARD;
+    cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+
+    cs_gradient_type_by_imrgra(imrgra_b,
+                               &gradient_type,
+                               &halo_type);
+
+    const cs_lnum_t n_f = n_b_fields;
+
+    const cs_real_t **bc_coeff_a, **bc_coeff_b;
+    BFT_MALLOC(bc_coeff_a, n_b_fields, const cs_real_t *);
+    BFT_MALLOC(bc_coeff_b, n_b_fields, const cs_real_t *);
+
+    cs_real_t *var;
+    cs_real_3_t *_grad;
+    BFT_MALLOC(var, n_cells_ext*n_f, cs_real_t);
+    BFT_MALLOC(_grad, n_cells_ext*n_f, cs_real_3_t);
+
+    for (cs_lnum_t k = 0; k < n_f; k++) {
+
+      const cs_field_t *_f = f[b_field_id[k]];
+
+      bc_coeff_a[k] = NULL;
+      bc_coeff_b[k] = NULL;
+      if (_f->bc_coeffs != NULL) {
+        bc_coeff_a[k] = _f->bc_coeffs->a;
+        bc_coeff_b[k] = _f->bc_coeffs->b;
+      }
+
+      const cs_real_t *f_var = (use_previous_t) ? _f->val_pre : _f->val;
+
+#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+        var[c_id*n_f + k] = f_var[c_id];
+
+    }
+
+    char name[64];
+    snprintf(name, 63, "%s (+%d)", f[b_field_id[0]]->name, n_b_fields - 1);
+    name[63] = '\0';
+
+    cs_gradient_scalar_multi(name,
+                             gradient_type,
+                             halo_type,
+                             inc,
+                             recompute_cocg,
+                             eqp->nswrgr,
+                             verbosity,
+                             eqp->imligr,
+                             eqp->epsrgr,
+                             eqp->climgr,
+                             n_b_fields,
+                             bc_coeff_a,
+                             bc_coeff_b,
+                             var,
+                             _grad);
+
+    /* Scatter gradients, and synchronized ghost values as would
+       be done for single fields */
+
+    const cs_lnum_t n_cells = m->n_cells;
+
+    for (cs_lnum_t k = 0; k < n_f; k++) {
+      const cs_field_t *_f = f[b_field_id[k]];
+      cs_real_t *f_var = (use_previous_t) ? _f->val_pre : _f->val;
+      for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++)
+        f_var[c_id] = var[c_id*n_f + k];
+
+      cs_real_3_t *restrict f_grad = grad[b_field_id[k]];
+#     pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          f_grad[c_id][ll] = _grad[c_id*n_f + k][ll];
+      }
+    }
+
+    BFT_FREE(_grad);
+    BFT_FREE(var);
+    BFT_FREE(bc_coeff_b);
+    BFT_FREE(bc_coeff_a);
+
+  }
+  else
+    n_b_fields = 0;
+
+  /* Remaining fields */
+
+  for (int i = 0, j = 0; i < n_fields; i++) {
+    if (j < n_b_fields && b_field_id[j] == i) {
+      j++;
+      continue;
+    }
+    cs_field_gradient_scalar(f[i],
+                             use_previous_t,
+                             inc,
+                             recompute_cocg,
+                             grad[i]);
+  }
+
+  BFT_FREE(b_field_id);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
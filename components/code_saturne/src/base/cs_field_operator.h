@@ -81,6 +81,31 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                          bool                       recompute_cocg,
                          cs_real_3_t      *restrict grad);
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalar fields.
+ *
+ * Fields sharing the same gradient options, and requiring neither
+ * gradient weighting nor internal coupling, are handled together, so that
+ * face geometric quantities are loaded and halos are exchanged only once
+ * for all those fields.
+ *
+ * parameters:
+ *   n_fields       <-- number of fields
+ *   f              <-- pointers to fields
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   recompute_cocg <-- should COCG FV quantities be recomputed ?
+ *   grad           --> gradient for each field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar_multi(int                        n_fields,
+                               const cs_field_t    *const f[],
+                               bool                       use_previous_t,
+                               int                        inc,
+                               bool                       recompute_cocg,
+                               cs_real_3_t         *const grad[]);
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient of scalar field or component of vector or
  * tensor field.
@@ -463,6 +463,77 @@ _update_cell_vertices(cs_mesh_adjacencies_t  *ma,
   BFT_REALLOC(c2v->ids, c2v->idx[n_cells], cs_lnum_t);
 }
 
+/*----------------------------------------------------------------------------
+ * Update cells -> interior faces signed connectivity
+ *
+ * Only local (non-ghost) cells are handled; for each cell, faces are
+ * ordered by increasing id.
+ *
+ * parameters:
+ *   ma <-> mesh adjacecies structure to update
+ *   m  <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_cell_i_faces(cs_mesh_adjacencies_t  *ma,
+                     const cs_mesh_t        *m)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  if (ma->c2i == NULL)
+    ma->c2i = cs_adjacency_create(CS_ADJACENCY_SIGNED, -1, n_cells);
+
+  cs_adjacency_t *c2i = ma->c2i;
+
+  if (c2i->n_elts != n_cells) {
+    BFT_REALLOC(c2i->idx, n_cells+1, cs_lnum_t);
+    c2i->n_elts = n_cells;
+  }
+
+  /* Count faces per cell */
+
+  for (cs_lnum_t i = 0; i < n_cells+1; i++)
+    c2i->idx[i] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (cs_lnum_t j = 0; j < 2; j++) {
+      cs_lnum_t c_id = i_face_cells[f_id][j];
+      if (c_id < n_cells)
+        c2i->idx[c_id + 1] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    c2i->idx[i+1] += c2i->idx[i];
+
+  /* Add faces (in increasing id order, as faces are looped on in order) */
+
+  BFT_REALLOC(c2i->ids, c2i->idx[n_cells], cs_lnum_t);
+  BFT_REALLOC(c2i->sgn, c2i->idx[n_cells], short int);
+
+  cs_lnum_t *c2i_count;
+  BFT_MALLOC(c2i_count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    c2i_count[i] = c2i->idx[i];
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (cs_lnum_t j = 0; j < 2; j++) {
+      cs_lnum_t c_id = i_face_cells[f_id][j];
+      if (c_id < n_cells) {
+        c2i->ids[c2i_count[c_id]] = f_id;
+        c2i->sgn[c2i_count[c_id]] = (j == 0) ? 1 : -1;
+        c2i_count[c_id] += 1;
+      }
+    }
+  }
+
+  BFT_FREE(c2i_count);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -492,6 +563,8 @@ cs_mesh_adjacencies_initialize(void)
   ma->c2v = NULL;
   ma->_c2v = NULL;
 
+  ma->c2i = NULL;
+
   cs_glob_mesh_adjacencies = ma;
 }
 
@@ -513,6 +586,7 @@ cs_mesh_adjacencies_finalize(void)
   BFT_FREE(ma->cell_b_faces);
 
   cs_adjacency_destroy(&(ma->_c2v));
+  cs_adjacency_destroy(&(ma->c2i));
 
   cs_glob_mesh_adjacencies = NULL;
 }
@@ -544,6 +618,11 @@ cs_mesh_adjacencies_update_mesh(void)
 
   if (ma->c2v != NULL)
     _update_cell_vertices(ma, cs_glob_mesh);
+
+  /* (re)build cell -> interior faces connectivities if present */
+
+  if (ma->c2i != NULL)
+    _update_cell_i_faces(ma, cs_glob_mesh);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -587,6 +666,35 @@ cs_mesh_adjacencies_cell_vertices(void)
   return ma->c2v;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return cell -> interior faces signed connectivity in
+ *         mesh adjacencies helper API relative to mesh.
+ *
+ * The sign is +1 if the cell is the first cell adjacent to the face
+ * (i.e. the face normal is outward), -1 otherwise. This allows face-based
+ * loops scattering values to both adjacent cells to be replaced by
+ * cell-based loops gathering face contributions, which are thread-safe
+ * without face group renumbering.
+ *
+ * This connectivity is built only when first requested, then updated later if
+ * needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_adjacency_t  *
+cs_mesh_adjacencies_cell_i_faces(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  cs_mesh_adjacencies_t *ma = &_cs_glob_mesh_adjacencies;
+
+  if (ma->c2i == NULL)
+    _update_cell_i_faces(ma, m);
+
+  return ma->c2i;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a cs_adjacency_t structure of size n_elts
@@ -107,6 +107,14 @@ typedef struct {
   cs_adjacency_t        *_c2v;         /*!< cells to vertices adjacency if owner,
                                          NULL otherwise */
 
+  /* cells -> interior faces connectivity */
+
+  cs_adjacency_t        *c2i;          /*!< cells to interior faces signed
+                                         adjacency (+1 if the cell is the
+                                         face's first adjacent cell, -1
+                                         otherwise), for gather-based face
+                                         loops; built on demand, or NULL */
+
 } cs_mesh_adjacencies_t;
 
 /*============================================================================
@@ -171,6 +179,19 @@ cs_mesh_adjacencies_update_cell_cells_e(void);
 const cs_adjacency_t  *
 cs_mesh_adjacencies_cell_vertices(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return cell -> interior faces signed connectivity in
+ *         mesh adjacencies helper API relative to mesh.
+ *
+ * This connectivity is built only when first requested, then updated later if
+ * needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_adjacency_t  *
+cs_mesh_adjacencies_cell_i_faces(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a cs_adjacency_t structure of size n_elts
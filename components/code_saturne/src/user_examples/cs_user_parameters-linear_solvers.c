@@ -295,6 +295,9 @@ cs_user_linear_solvers(void)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
+   *  CS_SLES_PIPELINED_PCG       (pipelined preconditioned conjugate gradient)
+   *  CS_SLES_PIPELINED_BICGSTAB  (pipelined Bi-conjugate gradient stabilized)
+   *  CS_SLES_CA_GMRES            (communication-avoiding GMRES)
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
    *  and coarse solver by default, but this behavior may be modified. */
@@ -320,6 +323,18 @@ cs_user_linear_solvers(void)
   }
   /*! [sles_user_1] */
 
+  /* Example: use a matrix-free operator for user variable (named user_1),
+     so that extra-diagonal terms are not assembled (only for solvers
+     with no multigrid or Gauss-Seidel based components) */
+  /*---------------------------------------------------------------------*/
+
+  /*! [sles_matrix_free] */
+  if (cvar_user_1 != NULL) {
+    cs_sles_t *sles_u1 = cs_sles_find_or_add(cvar_user_1->id, NULL);
+    cs_sles_set_matrix_free(sles_u1, true);
+  }
+  /*! [sles_matrix_free] */
+
   /* Example: increase verbosity parameters for pressure */
   /*-----------------------------------------------------*/
 
@@ -395,6 +410,21 @@ cs_user_linear_solvers(void)
   }
   /*! [sles_mg_parall] */
 
+  /* Reuse multigrid coarsening across time steps for pressure */
+  /*-----------------------------------------------------------*/
+
+  /*! [sles_mg_reuse] */
+  {
+    cs_multigrid_t *mg = cs_multigrid_define(CS_F_(p)->id,
+                                             NULL,
+                                             CS_MULTIGRID_V_CYCLE);
+
+    cs_multigrid_set_reuse_options(mg,
+                                   10,   /* full coarsening every 10 setups */
+                                   1.5); /* or when cycles increase by 50% */
+  }
+  /*! [sles_mg_reuse] */
+
   /* Example: conjugate gradient preconditioned by multigrid for pressure */
   /*----------------------------------------------------------------------*/
 
@@ -85,6 +85,12 @@ cs_user_matrix_tuning(void)
 
   cs_matrix_default_set_type(CS_MATRIX_BLOCK_D, CS_MATRIX_MSR);
 
+  /* Use sliced ELLPACK storage for scalar (non-symmetric) matrices, so
+     that its SIMD (AVX2 or AVX-512) variants are also tuned; note that
+     Gauss-Seidel type solvers revert to Jacobi with this storage */
+
+  cs_matrix_default_set_type(CS_MATRIX_SCALAR, CS_MATRIX_SELL);
+
   /* Also allow tuning for multigrid for all expected levels
    * (we rarely have more than 10 or 11 levels except for huge meshes). */
 
@@ -520,6 +520,453 @@ _free_base_data(void)
   BFT_FREE(_edges);
 }
 
+/*----------------------------------------------------------------------------
+ * Compare matrix.vector product results with reference values.
+ *
+ * parameters:
+ *   name  <-- name of tested variant
+ *   n     <-- number of values
+ *   tol   <-- tolerance, relative to the largest reference value
+ *   y_ref <-- reference values
+ *   y     <-- tested values
+ *
+ * returns:
+ *   0 if values match, 1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_spmv(const char       *name,
+              cs_lnum_t         n,
+              double            tol,
+              const cs_real_t   y_ref[],
+              const cs_real_t   y[])
+{
+  double d_max = 0., r_max = 0.;
+
+  for (cs_lnum_t i = 0; i < n; i++) {
+    d_max = CS_MAX(d_max, CS_ABS(y[i] - y_ref[i]));
+    r_max = CS_MAX(r_max, CS_ABS(y_ref[i]));
+  }
+
+  int retval = (d_max <= tol*CS_MAX(r_max, 1.)) ? 0 : 1;
+
+  bft_printf("  %-28s max. difference: %12.5e%s\n",
+             name, d_max, (retval == 0) ? "" : " (FAILED)");
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare each SELL-C-sigma matrix.vector product kernel with reference
+ * values.
+ *
+ * SIMD kernels are tested only when available in this build (using the
+ * same conditions as in cs_matrix.c). The last kernel tested is the
+ * default one.
+ *
+ * parameters:
+ *   m     <-> SELL-C-sigma matrix (product function is modified)
+ *   n     <-- number of values
+ *   tol   <-- tolerance, relative to the largest reference value
+ *   x     <-> multipliying vector values
+ *   y_ref <-- reference values
+ *   y     --- work array for tested values
+ *
+ * returns:
+ *   number of failed comparisons
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_sell_spmv(cs_matrix_t      *m,
+                cs_lnum_t         n,
+                double            tol,
+                cs_real_t         x[],
+                const cs_real_t   y_ref[],
+                cs_real_t         y[])
+{
+  const char *func_name[] = {"standard",
+#if !defined(HAVE_LONG_LNUM) && defined(__AVX2__)
+                             "avx2",
+#endif
+#if !defined(HAVE_LONG_LNUM) && defined(__AVX512F__)
+                             "avx512",
+#endif
+                             "default"};
+
+  const int n_funcs = sizeof(func_name) / sizeof(func_name[0]);
+
+  int n_fails = 0;
+
+  for (int f_id = 0; f_id < n_funcs; f_id++) {
+
+    cs_matrix_variant_t *mv = cs_matrix_variant_create(m);
+    cs_matrix_variant_set_func(mv,
+                               NULL,
+                               m->fill_type,
+                               2,
+                               func_name[f_id]);
+    cs_matrix_variant_apply(m, mv);
+    cs_matrix_variant_destroy(&mv);
+
+    char name[64];
+    snprintf(name, 63, "SELL-C-sigma, %s", func_name[f_id]);
+    name[63] = '\0';
+
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m, x, y);
+    n_fails += _compare_spmv(name, n, tol, y_ref, y);
+
+  }
+
+  return n_fails;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a local matrix (without halo) from an edge list.
+ *
+ * parameters:
+ *   type      <-- matrix type
+ *   symmetric <-- are coefficients symmetric ?
+ *   n_rows    <-- number of rows
+ *   n_edges   <-- number of edges
+ *   edges     <-- edges (row <-> column) connectivity
+ *   da        <-- diagonal values
+ *   xa        <-- extra-diagonal values
+ *   ms        --> associated matrix structure
+ *
+ * returns:
+ *   pointer to created matrix
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_t *
+_local_matrix(cs_matrix_type_t         type,
+              bool                     symmetric,
+              cs_lnum_t                n_rows,
+              cs_lnum_t                n_edges,
+              const cs_lnum_2_t        edges[],
+              const cs_real_t          da[],
+              const cs_real_t          xa[],
+              cs_matrix_structure_t  **ms)
+{
+  *ms = cs_matrix_structure_create(type,
+                                   true,
+                                   n_rows,
+                                   n_rows,
+                                   n_edges,
+                                   edges,
+                                   NULL,
+                                   NULL);
+
+  cs_matrix_t *m = cs_matrix_create(*ms);
+
+  cs_matrix_set_coefficients(m, symmetric, NULL, NULL,
+                             n_edges, edges, da, xa);
+
+  return m;
+}
+
+/*----------------------------------------------------------------------------
+ * Test matrix.vector product variants on a local system, comparing
+ * each with the native product of the same system.
+ *
+ * returns:
+ *   number of failed comparisons
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_local_spmv(void)
+{
+  const cs_lnum_t n_rows = 97;
+  const int n_vecs = 3;
+  const double tol = 1.e-12;
+
+  int n_fails = 0;
+
+  /* Local graph with varying row lengths (so that SELL-C-sigma slices
+     are sorted and padded) and both edge orientations */
+
+  cs_lnum_t n_edges = 0;
+  cs_lnum_2_t *edges;
+  BFT_MALLOC(edges, n_rows*3, cs_lnum_2_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    if (i + 1 < n_rows) {
+      edges[n_edges][0] = i; edges[n_edges][1] = i+1; n_edges++;
+    }
+    if (i%3 == 0 && i + 5 < n_rows) {
+      edges[n_edges][0] = i; edges[n_edges][1] = i+5; n_edges++;
+    }
+    if (i%7 == 0 && i + 11 < n_rows) {
+      edges[n_edges][0] = i+11; edges[n_edges][1] = i; n_edges++;
+    }
+  }
+
+  cs_real_t *da, *xa, *x, *y_ref, *y;
+  BFT_MALLOC(da, n_rows, cs_real_t);
+  BFT_MALLOC(xa, n_edges*2, cs_real_t);
+  BFT_MALLOC(x, n_rows*n_vecs, cs_real_t);
+  BFT_MALLOC(y_ref, n_rows*n_vecs, cs_real_t);
+  BFT_MALLOC(y, n_rows*n_vecs, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    da[i] = 4. + cos(i + 0.1);
+
+  for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+    xa[e_id*2]     = -0.5 - 0.25*sin(e_id + 0.1);
+    xa[e_id*2 + 1] = -0.5 + 0.25*cos(e_id + 0.3);
+  }
+
+  for (int k = 0; k < n_vecs; k++) {
+    for (cs_lnum_t i = 0; i < n_rows; i++)
+      x[k*n_rows + i] = sin(0.1*(i+1)*(k+1)) + 0.5;
+  }
+
+  for (int s_id = 0; s_id < 2; s_id++) {
+
+    bool symmetric = (s_id == 0) ? false : true;
+
+    bft_printf("\nLocal SpMV variants (%s)\n",
+               (symmetric) ? "symmetric" : "non-symmetric");
+
+    cs_matrix_structure_t *ms_ref, *ms_msr, *ms_sell;
+
+    cs_matrix_t *m_ref = _local_matrix(CS_MATRIX_NATIVE, symmetric,
+                                       n_rows, n_edges, edges, da, xa,
+                                       &ms_ref);
+    cs_matrix_t *m_msr = _local_matrix(CS_MATRIX_MSR, symmetric,
+                                       n_rows, n_edges, edges, da, xa,
+                                       &ms_msr);
+    cs_matrix_t *m_sell = _local_matrix(CS_MATRIX_SELL, symmetric,
+                                        n_rows, n_edges, edges, da, xa,
+                                        &ms_sell);
+
+    /* Native matrix sharing the reference structure, with
+       gather-based product */
+
+    cs_matrix_t *m_gather = cs_matrix_create(ms_ref);
+    cs_matrix_set_coefficients(m_gather, symmetric, NULL, NULL,
+                               n_edges, edges, da, xa);
+
+    cs_matrix_variant_t *mv = cs_matrix_variant_create(m_gather);
+    cs_matrix_variant_set_func(mv,
+                               NULL,
+                               cs_matrix_get_fill_type(symmetric, NULL, NULL),
+                               2,
+                               "gather");
+    cs_matrix_variant_apply(m_gather, mv);
+    cs_matrix_variant_destroy(&mv);
+
+    for (int k = 0; k < n_vecs; k++)
+      cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_ref,
+                                x + k*n_rows, y_ref + k*n_rows);
+
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_gather, x, y);
+    n_fails += _compare_spmv("native, gather", n_rows, tol, y_ref, y);
+
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_msr, x, y);
+    n_fails += _compare_spmv("MSR", n_rows, tol, y_ref, y);
+
+    n_fails += _test_sell_spmv(m_sell, n_rows, tol, x, y_ref, y);
+
+    /* Multiple vectors */
+
+    cs_matrix_vector_multiply_multi(CS_HALO_ROTATION_COPY, m_ref,
+                                    n_vecs, x, y);
+    n_fails += _compare_spmv("native, multiple vectors",
+                             n_rows*n_vecs, tol, y_ref, y);
+
+    cs_matrix_vector_multiply_multi(CS_HALO_ROTATION_COPY, m_msr,
+                                    n_vecs, x, y);
+    n_fails += _compare_spmv("MSR, multiple vectors",
+                             n_rows*n_vecs, tol, y_ref, y);
+
+    /* Single-precision extra-diagonal coefficients */
+
+    cs_matrix_set_msr_x_val_f(m_msr);
+
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_msr, x, y);
+    n_fails += _compare_spmv("MSR, float coefficients",
+                             n_rows, 1.e-6, y_ref, y);
+
+    cs_matrix_release_coefficients(m_gather);
+    cs_matrix_release_coefficients(m_sell);
+    cs_matrix_release_coefficients(m_msr);
+    cs_matrix_release_coefficients(m_ref);
+
+    cs_matrix_destroy(&m_gather);
+    cs_matrix_destroy(&m_sell);
+    cs_matrix_destroy(&m_msr);
+    cs_matrix_destroy(&m_ref);
+
+    cs_matrix_structure_destroy(&ms_sell);
+    cs_matrix_structure_destroy(&ms_msr);
+    cs_matrix_structure_destroy(&ms_ref);
+  }
+
+  /* SELL-C-sigma with 3x3 diagonal blocks (and scalar extra-diagonal
+     terms), compared to the native product of the same system */
+
+  {
+    const cs_lnum_t db_size[4] = {3, 3, 3, 9};
+
+    cs_real_t *b_da, *b_x, *b_y_ref, *b_y;
+    BFT_MALLOC(b_da, n_rows*9, cs_real_t);
+    BFT_MALLOC(b_x, n_rows*3, cs_real_t);
+    BFT_MALLOC(b_y_ref, n_rows*3, cs_real_t);
+    BFT_MALLOC(b_y, n_rows*3, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < n_rows; i++) {
+      for (cs_lnum_t k = 0; k < 3; k++) {
+        for (cs_lnum_t l = 0; l < 3; l++)
+          b_da[i*9 + k*3 + l] = (k == l) ?
+            4. + cos(i + 0.1*k) : 0.1*sin(i + k + l);
+        b_x[i*3 + k] = sin(0.1*(i+1)*(k+1)) + 0.5;
+      }
+    }
+
+    for (int s_id = 0; s_id < 2; s_id++) {
+
+      bool symmetric = (s_id == 0) ? false : true;
+
+      bft_printf("\nLocal SpMV variants, 3x3 diagonal blocks (%s)\n",
+                 (symmetric) ? "symmetric" : "non-symmetric");
+
+      cs_matrix_structure_t *ms_ref
+        = cs_matrix_structure_create(CS_MATRIX_NATIVE, true,
+                                     n_rows, n_rows, n_edges, edges,
+                                     NULL, NULL);
+      cs_matrix_structure_t *ms_sell
+        = cs_matrix_structure_create(CS_MATRIX_SELL, true,
+                                     n_rows, n_rows, n_edges, edges,
+                                     NULL, NULL);
+
+      cs_matrix_t *m_ref = cs_matrix_create(ms_ref);
+      cs_matrix_t *m_sell = cs_matrix_create(ms_sell);
+
+      cs_matrix_set_coefficients(m_ref, symmetric, db_size, NULL,
+                                 n_edges, edges, b_da, xa);
+      cs_matrix_set_coefficients(m_sell, symmetric, db_size, NULL,
+                                 n_edges, edges, b_da, xa);
+
+      cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_ref, b_x, b_y_ref);
+      n_fails += _test_sell_spmv(m_sell, n_rows*3, tol, b_x, b_y_ref, b_y);
+
+      cs_matrix_release_coefficients(m_sell);
+      cs_matrix_release_coefficients(m_ref);
+
+      cs_matrix_destroy(&m_sell);
+      cs_matrix_destroy(&m_ref);
+
+      cs_matrix_structure_destroy(&ms_sell);
+      cs_matrix_structure_destroy(&ms_ref);
+    }
+
+    BFT_FREE(b_y);
+    BFT_FREE(b_y_ref);
+    BFT_FREE(b_x);
+    BFT_FREE(b_da);
+  }
+
+  /* Matrix-free convection-diffusion operator, compared to the native
+     matrix built with the same upwind expressions */
+
+  const double thetap = 0.7;
+
+  cs_real_t *i_massflux, *i_visc, *xcpp;
+  BFT_MALLOC(i_massflux, n_edges, cs_real_t);
+  BFT_MALLOC(i_visc, n_edges, cs_real_t);
+  BFT_MALLOC(xcpp, n_rows, cs_real_t);
+
+  for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+    i_massflux[e_id] = sin(e_id + 0.2);
+    i_visc[e_id] = 1. + 0.5*cos(e_id + 0.4);
+  }
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    xcpp[i] = 1. + 0.1*i/n_rows;
+
+  for (int s_id = 0; s_id < 2; s_id++) {
+
+    bool symmetric = (s_id == 0) ? false : true;
+
+    bft_printf("\nMatrix-free convection-diffusion (%s)\n",
+               (symmetric) ? "symmetric" : "non-symmetric");
+
+    for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+      cs_lnum_t ii = edges[e_id][0];
+      cs_lnum_t jj = edges[e_id][1];
+      double m_ij = i_massflux[e_id];
+      if (symmetric)
+        xa[e_id] = -thetap*i_visc[e_id];
+      else {
+        xa[e_id*2]     = thetap*(  0.5*(m_ij - fabs(m_ij))*xcpp[ii]
+                                 - i_visc[e_id]);
+        xa[e_id*2 + 1] = thetap*(- 0.5*(m_ij + fabs(m_ij))*xcpp[jj]
+                                 - i_visc[e_id]);
+      }
+    }
+
+    cs_matrix_structure_t *ms_ref, *ms_cd;
+
+    cs_matrix_t *m_ref = _local_matrix(CS_MATRIX_NATIVE, symmetric,
+                                       n_rows, n_edges, edges, da, xa,
+                                       &ms_ref);
+
+    ms_cd = cs_matrix_structure_create(CS_MATRIX_CONV_DIFF,
+                                       true,
+                                       n_rows,
+                                       n_rows,
+                                       n_edges,
+                                       edges,
+                                       NULL,
+                                       NULL);
+
+    cs_matrix_t *m_cd = cs_matrix_create(ms_cd);
+
+    cs_matrix_set_conv_diff_coefficients(m_cd,
+                                         symmetric,
+                                         1,    /* iconvp */
+                                         1,    /* idiffp */
+                                         thetap,
+                                         da,
+                                         i_massflux,
+                                         i_visc,
+                                         xcpp);
+
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_ref, x, y_ref);
+    cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m_cd, x, y);
+    n_fails += _compare_spmv("convection-diffusion", n_rows, tol, y_ref, y);
+
+    cs_matrix_exdiag_vector_multiply(CS_HALO_ROTATION_COPY, m_ref, x, y_ref);
+    cs_matrix_exdiag_vector_multiply(CS_HALO_ROTATION_COPY, m_cd, x, y);
+    n_fails += _compare_spmv("convection-diffusion, exdiag",
+                             n_rows, tol, y_ref, y);
+
+    cs_matrix_release_coefficients(m_cd);
+    cs_matrix_release_coefficients(m_ref);
+
+    cs_matrix_destroy(&m_cd);
+    cs_matrix_destroy(&m_ref);
+
+    cs_matrix_structure_destroy(&ms_cd);
+    cs_matrix_structure_destroy(&ms_ref);
+  }
+
+  BFT_FREE(xcpp);
+  BFT_FREE(i_visc);
+  BFT_FREE(i_massflux);
+
+  BFT_FREE(y);
+  BFT_FREE(y_ref);
+  BFT_FREE(x);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+
+  bft_printf("\n");
+
+  return n_fails;
+}
+
 /*----------------------------------------------------------------------------*/
 
 int
@@ -563,6 +1010,10 @@ main (int argc, char *argv[])
   cs_system_info();
 #endif
 
+  /* Compare local matrix.vector product variants */
+
+  int n_fails = _test_local_spmv();
+
   _base_data(cs_glob_rank_id, cs_glob_n_ranks);
 
   /* Loop on assembler external/internal diagonal */
@@ -839,5 +1290,5 @@ main (int argc, char *argv[])
   }
 #endif /* HAVE_MPI */
 
-  exit (EXIT_SUCCESS);
+  exit ((n_fails > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
 }
@@ -0,0 +1,359 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_matrix.h"
+#include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+#include "cs_multigrid.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Structured 2D grid dimensions */
+
+#define _NX  48
+#define _NY  48
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build a structured 2D mesh and its quantities, assigned to the global
+ * mesh and mesh quantities pointers (as used by multigrid setup).
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(void)
+{
+  cs_mesh_t *m = cs_mesh_create();
+  cs_mesh_quantities_t *mq = cs_mesh_quantities_create();
+
+  const cs_lnum_t n_cells = _NX*_NY;
+  const cs_lnum_t n_i_faces = (_NX-1)*_NY + _NX*(_NY-1);
+
+  m->n_cells = n_cells;
+  m->n_cells_with_ghosts = n_cells;
+  m->n_g_cells = n_cells;
+  m->n_i_faces = n_i_faces;
+  m->n_g_i_faces = n_i_faces;
+
+  BFT_MALLOC(m->i_face_cells, n_i_faces, cs_lnum_2_t);
+  BFT_MALLOC(mq->cell_cen, n_cells*3, cs_real_t);
+  BFT_MALLOC(mq->cell_vol, n_cells, cs_real_t);
+  BFT_MALLOC(mq->i_face_normal, n_i_faces*3, cs_real_t);
+
+  for (cs_lnum_t j = 0; j < _NY; j++) {
+    for (cs_lnum_t i = 0; i < _NX; i++) {
+      cs_lnum_t c_id = j*_NX + i;
+      mq->cell_cen[c_id*3]     = i + 0.5;
+      mq->cell_cen[c_id*3 + 1] = j + 0.5;
+      mq->cell_cen[c_id*3 + 2] = 0.5;
+      mq->cell_vol[c_id] = 1.;
+    }
+  }
+
+  cs_lnum_t f_id = 0;
+
+  for (cs_lnum_t j = 0; j < _NY; j++) {
+    for (cs_lnum_t i = 0; i < _NX - 1; i++) {
+      m->i_face_cells[f_id][0] = j*_NX + i;
+      m->i_face_cells[f_id][1] = j*_NX + i + 1;
+      mq->i_face_normal[f_id*3]     = 1.;
+      mq->i_face_normal[f_id*3 + 1] = 0.;
+      mq->i_face_normal[f_id*3 + 2] = 0.;
+      f_id++;
+    }
+  }
+
+  for (cs_lnum_t j = 0; j < _NY - 1; j++) {
+    for (cs_lnum_t i = 0; i < _NX; i++) {
+      m->i_face_cells[f_id][0] = j*_NX + i;
+      m->i_face_cells[f_id][1] = (j+1)*_NX + i;
+      mq->i_face_normal[f_id*3]     = 0.;
+      mq->i_face_normal[f_id*3 + 1] = 1.;
+      mq->i_face_normal[f_id*3 + 2] = 0.;
+      f_id++;
+    }
+  }
+
+  assert(f_id == n_i_faces);
+
+  cs_glob_mesh = m;
+  cs_glob_mesh_quantities = mq;
+}
+
+/*----------------------------------------------------------------------------
+ * Free global mesh and mesh quantities.
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_mesh(void)
+{
+  cs_glob_mesh_quantities = cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+}
+
+/*----------------------------------------------------------------------------
+ * Set diffusion-type coefficients for a given time step.
+ *
+ * Face conductances vary slowly from one step to the next, as for a
+ * pressure system with evolving density; the diagonal includes a small
+ * shift so that the system is definite.
+ *
+ * parameters:
+ *   step <-- time step number
+ *   da   --> diagonal coefficients
+ *   xa   --> extra-diagonal coefficients
+ *----------------------------------------------------------------------------*/
+
+static void
+_step_coefficients(int         step,
+                   cs_real_t  *da,
+                   cs_real_t  *xa)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  for (cs_lnum_t c_id = 0; c_id < m->n_cells; c_id++)
+    da[c_id] = 1e-3;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    cs_lnum_t c0 = m->i_face_cells[f_id][0];
+    cs_lnum_t c1 = m->i_face_cells[f_id][1];
+    cs_real_t x = 0.5*(cell_cen[c0][0] + cell_cen[c1][0]) / _NX;
+    cs_real_t k = 1. + 0.5*sin(6.*x + 0.05*step);
+    xa[f_id] = -k;
+    da[c0] += k;
+    da[c1] += k;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a sequence of slowly-varying systems with a PCG solver using a
+ * multigrid preconditioner with coarsening reuse.
+ *
+ * Without reuse, mixed precision also frees the double-precision coarse
+ * coefficients after each setup, so this checks that solves only use the
+ * single-precision copy on coarse levels.
+ *
+ * parameters:
+ *   reuse_interval  <-- number of setups sharing a coarsening
+ *   mixed_precision <-- use single-precision coarse matrix coefficients
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_pc_reuse(int   reuse_interval,
+               bool  mixed_precision)
+{
+  int n_fails = 0;
+
+  const int n_steps = 8;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  cs_real_t *da, *xa, *rhs, *vx;
+  BFT_MALLOC(da, n_cells, cs_real_t);
+  BFT_MALLOC(xa, n_i_faces, cs_real_t);
+  BFT_MALLOC(rhs, n_cells, cs_real_t);
+  BFT_MALLOC(vx, n_cells, cs_real_t);
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_NATIVE,
+                                 true,
+                                 n_cells,
+                                 n_cells,
+                                 n_i_faces,
+                                 (const cs_lnum_2_t *)m->i_face_cells,
+                                 NULL,
+                                 NULL);
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_sles_it_t *c = cs_sles_it_create(CS_SLES_PCG, -1, 200, true);
+  cs_sles_pc_t *pc = cs_multigrid_pc_create(CS_MULTIGRID_V_CYCLE);
+  cs_multigrid_t *mg = cs_sles_pc_get_context(pc);
+
+  cs_multigrid_set_reuse_options(mg, reuse_interval, 1.5);
+  cs_multigrid_set_mixed_precision(mg, mixed_precision);
+
+  cs_sles_it_transfer_pc(c, &pc);
+
+  int n_iter_ref = -1;
+
+  for (int step = 0; step < n_steps; step++) {
+
+    _step_coefficients(step, da, xa);
+    cs_matrix_set_coefficients(a, true, NULL, NULL,
+                               n_i_faces,
+                               (const cs_lnum_2_t *)m->i_face_cells,
+                               da, xa);
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      rhs[c_id] = sin(0.1*c_id + step);
+      vx[c_id] = 0.;
+    }
+
+    int n_iter = 0;
+    double residue = -1;
+
+    cs_sles_it_setup(c, "mg_reuse", a, 0);
+
+    cs_sles_convergence_state_t cvg
+      = cs_sles_it_solve(c,
+                         "mg_reuse",
+                         a,
+                         0,
+                         CS_HALO_ROTATION_COPY,
+                         1e-8,
+                         1.,
+                         &n_iter,
+                         &residue,
+                         rhs,
+                         vx,
+                         0,
+                         NULL);
+
+    cs_sles_it_free(c);
+
+    if (cvg != CS_SLES_CONVERGED) {
+      bft_printf("  step %d: PCG with multigrid preconditioner did not "
+                 "converge (state %d, %d iterations).\n",
+                 step, (int)cvg, n_iter);
+      n_fails++;
+    }
+
+    /* Reused coarse grids must precondition about as well as new ones */
+
+    if (n_iter_ref < 0)
+      n_iter_ref = n_iter;
+    else if (n_iter > 2*n_iter_ref) {
+      bft_printf("  step %d: %d iterations, vs. %d for first step.\n",
+                 step, n_iter, n_iter_ref);
+      n_fails++;
+    }
+
+  }
+
+  /* Each setup except the full coarsening of each interval reuses grids */
+
+  unsigned n_reuse = cs_multigrid_get_n_reuse(mg);
+  unsigned n_reuse_expected = n_steps - (n_steps/reuse_interval);
+
+  bft_printf("  preconditioner reuse (interval: %d, mixed precision: %d): "
+             "%u of %d setups reused coarse grids.\n",
+             reuse_interval, (int)mixed_precision, n_reuse, n_steps);
+
+  if (n_reuse != n_reuse_expected) {
+    bft_printf("  expected %u setups reusing coarse grids.\n",
+               n_reuse_expected);
+    n_fails++;
+  }
+
+  cs_sles_it_destroy((void **)&c);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(vx);
+  BFT_FREE(rhs);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+
+  return n_fails;
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main program to check multigrid setup reuse
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  bft_mem_init(NULL);
+
+  (void)cs_timer_wtime();
+
+  _build_mesh();
+
+  int n_fails = 0;
+
+  n_fails += _test_pc_reuse(4, false);
+  n_fails += _test_pc_reuse(4, true);
+  n_fails += _test_pc_reuse(1, true);
+
+  _free_mesh();
+
+  cs_multigrid_finalize();
+
+  bft_mem_end();
+
+  if (n_fails > 0)
+    bft_printf("\n -->> Multigrid reuse tests: %d failure(s)\n", n_fails);
+  else
+    bft_printf("\n -->> Multigrid reuse tests (Done)\n");
+
+  exit((n_fails > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
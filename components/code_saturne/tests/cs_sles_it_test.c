@@ -0,0 +1,358 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2021 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_matrix.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Local Macro definitions
+ *============================================================================*/
+
+/* Structured 2D grid dimensions */
+
+#define _NX  40
+#define _NY  30
+
+/* Number of right-hand sides */
+
+#define _N_RHS  4
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build edges and coefficients of a diffusion-type system on a structured
+ * 2D grid, with varying face conductances.
+ *
+ * parameters:
+ *   n_edges --> number of edges
+ *   edges   --> edges (row <-> column) connectivity
+ *   da      --> diagonal coefficients
+ *   xa      --> extra-diagonal coefficients
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_system(cs_lnum_t     *n_edges,
+              cs_lnum_2_t  **edges,
+              cs_real_t    **da,
+              cs_real_t    **xa)
+{
+  const cs_lnum_t n_rows = _NX*_NY;
+  const cs_lnum_t _n_edges = (_NX-1)*_NY + _NX*(_NY-1);
+
+  cs_lnum_2_t *_edges;
+  cs_real_t *_da, *_xa;
+
+  BFT_MALLOC(_edges, _n_edges, cs_lnum_2_t);
+  BFT_MALLOC(_da, n_rows, cs_real_t);
+  BFT_MALLOC(_xa, _n_edges, cs_real_t);
+
+  cs_lnum_t e_id = 0;
+
+  for (cs_lnum_t j = 0; j < _NY; j++) {
+    for (cs_lnum_t i = 0; i < _NX - 1; i++) {
+      _edges[e_id][0] = j*_NX + i;
+      _edges[e_id][1] = j*_NX + i + 1;
+      e_id++;
+    }
+  }
+
+  for (cs_lnum_t j = 0; j < _NY - 1; j++) {
+    for (cs_lnum_t i = 0; i < _NX; i++) {
+      _edges[e_id][0] = j*_NX + i;
+      _edges[e_id][1] = (j+1)*_NX + i;
+      e_id++;
+    }
+  }
+
+  assert(e_id == _n_edges);
+
+  for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++)
+    _da[r_id] = 1e-2;
+
+  for (e_id = 0; e_id < _n_edges; e_id++) {
+    cs_lnum_t r0 = _edges[e_id][0];
+    cs_lnum_t r1 = _edges[e_id][1];
+    cs_real_t k = 1. + 0.5*sin(0.37*e_id);
+    _xa[e_id] = -k;
+    _da[r0] += k;
+    _da[r1] += k;
+  }
+
+  *n_edges = _n_edges;
+  *edges = _edges;
+  *da = _da;
+  *xa = _xa;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize right-hand sides and their norms.
+ *
+ * parameters:
+ *   n_rows <-- number of rows
+ *   rhs    --> right-hand sides (size: _N_RHS*n_rows)
+ *   r_norm --> residue normalization for each system
+ *----------------------------------------------------------------------------*/
+
+static void
+_init_rhs(cs_lnum_t   n_rows,
+          cs_real_t   rhs[],
+          double      r_norm[])
+{
+  for (int k = 0; k < _N_RHS; k++) {
+    double s = 0;
+    for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++) {
+      cs_real_t v = sin(0.05*(k+1)*r_id) + 0.1*k;
+      rhs[k*n_rows + r_id] = v;
+      s += v*v;
+    }
+    r_norm[k] = sqrt(s);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compare solutions of grouped and individual solves.
+ *
+ * parameters:
+ *   name   <-- name of tested path
+ *   n_rows <-- number of rows
+ *   vx     <-- solutions of grouped solve
+ *   vx_ref <-- solutions of individual solves
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_solutions(const char       *name,
+                   cs_lnum_t         n_rows,
+                   const cs_real_t   vx[],
+                   const cs_real_t   vx_ref[])
+{
+  int n_fails = 0;
+
+  for (int k = 0; k < _N_RHS; k++) {
+    double d_max = 0, v_max = 0;
+    for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++) {
+      double d = fabs(vx[k*n_rows + r_id] - vx_ref[k*n_rows + r_id]);
+      d_max = CS_MAX(d_max, d);
+      v_max = CS_MAX(v_max, fabs(vx_ref[k*n_rows + r_id]));
+    }
+    if (d_max > 1e-6*v_max) {
+      bft_printf("  %s, system %d: max. difference %12.5g "
+                 "(max. value %12.5g)\n", name, k, d_max, v_max);
+      n_fails++;
+    }
+  }
+
+  return n_fails;
+}
+
+/*----------------------------------------------------------------------------
+ * Check multiple right-hand side solves with PCG against solving each
+ * system alone.
+ *
+ * returns:
+ *   number of failed checks
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_solve_multi(void)
+{
+  int n_fails = 0;
+
+  const cs_lnum_t n_rows = _NX*_NY;
+  const double precision = 1e-10;
+
+  cs_lnum_t n_edges;
+  cs_lnum_2_t *edges;
+  cs_real_t *da, *xa;
+
+  _build_system(&n_edges, &edges, &da, &xa);
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_NATIVE,
+                                 true,
+                                 n_rows,
+                                 n_rows,
+                                 n_edges,
+                                 (const cs_lnum_2_t *)edges,
+                                 NULL,
+                                 NULL);
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a, true, NULL, NULL,
+                             n_edges, (const cs_lnum_2_t *)edges,
+                             da, xa);
+
+  cs_real_t *rhs, *vx, *vx_ref;
+  BFT_MALLOC(rhs, _N_RHS*n_rows, cs_real_t);
+  BFT_MALLOC(vx, _N_RHS*n_rows, cs_real_t);
+  BFT_MALLOC(vx_ref, _N_RHS*n_rows, cs_real_t);
+
+  double r_norm[_N_RHS], residue[_N_RHS];
+  int n_iter[_N_RHS];
+
+  _init_rhs(n_rows, rhs, r_norm);
+
+  /* Reference: solve each system alone */
+
+  cs_sles_it_t *c_ref = cs_sles_it_create(CS_SLES_PCG, 0, 1000, false);
+
+  for (int k = 0; k < _N_RHS; k++) {
+    for (cs_lnum_t r_id = 0; r_id < n_rows; r_id++)
+      vx_ref[k*n_rows + r_id] = 0.;
+    cs_sles_convergence_state_t cvg
+      = cs_sles_it_solve(c_ref, "single_rhs", a, 0,
+                         CS_HALO_ROTATION_COPY, precision, r_norm[k],
+                         n_iter + k, residue + k,
+                         rhs + k*n_rows, vx_ref + k*n_rows,
+                         0, NULL);
+    if (cvg != CS_SLES_CONVERGED) {
+      bft_printf("  reference PCG did not converge for system %d.\n", k);
+      n_fails++;
+    }
+  }
+
+  cs_sles_it_destroy((void **)&c_ref);
+
+  /* Grouped PCG solve, calling the iterative solver directly */
+
+  cs_sles_it_t *c = cs_sles_it_create(CS_SLES_PCG, 0, 1000, true);
+
+  for (cs_lnum_t i = 0; i < _N_RHS*n_rows; i++)
+    vx[i] = 0.;
+
+  cs_sles_convergence_state_t cvg
+    = cs_sles_it_solve_multi(c, "multi_rhs", a, 0,
+                             CS_HALO_ROTATION_COPY, precision,
+                             _N_RHS, r_norm, n_iter, residue,
+                             rhs, vx, 0, NULL);
+
+  if (cvg != CS_SLES_CONVERGED) {
+    bft_printf("  grouped PCG did not converge (state %d).\n", (int)cvg);
+    n_fails++;
+  }
+
+  n_fails += _compare_solutions("cs_sles_it_solve_multi",
+                                n_rows, vx, vx_ref);
+
+  cs_sles_it_destroy((void **)&c);
+
+  /* Grouped PCG solve through the generic solver API */
+
+  cs_sles_it_define(-1, "multi_rhs", CS_SLES_PCG, 0, 1000);
+  cs_sles_t *sc = cs_sles_find(-1, "multi_rhs");
+
+  for (cs_lnum_t i = 0; i < _N_RHS*n_rows; i++)
+    vx[i] = 0.;
+
+  cvg = cs_sles_solve_multi(sc, a, CS_HALO_ROTATION_COPY, precision,
+                            _N_RHS, r_norm, n_iter, residue,
+                            rhs, vx, 0, NULL);
+
+  if (cvg != CS_SLES_CONVERGED) {
+    bft_printf("  cs_sles_solve_multi did not converge (state %d).\n",
+               (int)cvg);
+    n_fails++;
+  }
+
+  n_fails += _compare_solutions("cs_sles_solve_multi",
+                                n_rows, vx, vx_ref);
+
+  cs_sles_free(sc);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(vx_ref);
+  BFT_FREE(vx);
+  BFT_FREE(rhs);
+
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+
+  return n_fails;
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Main program to check multiple right-hand side solves
+ *
+ * \param[in]    argc
+ * \param[in]    argv
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  bft_mem_init(NULL);
+
+  (void)cs_timer_wtime();
+
+  int n_fails = _test_solve_multi();
+
+  cs_sles_finalize();
+
+  bft_mem_end();
+
+  if (n_fails > 0)
+    bft_printf("\n -->> Multiple RHS solve tests: %d failure(s)\n", n_fails);
+  else
+    bft_printf("\n -->> Multiple RHS solve tests (Done)\n");
+
+  exit((n_fails > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS